@@ -0,0 +1,72 @@
+/*
+ * Arduino.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <chrono>
+#include <cstdarg>
+#include <mutex>
+#include <thread>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+static const auto mStartTime = std::chrono::steady_clock::now();
+static std::mutex mLogMutex;
+
+unsigned long millis(void)
+{
+    return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - mStartTime).count());
+}
+
+unsigned long micros(void)
+{
+    return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - mStartTime).count());
+}
+
+void delay(uint32_t aMs)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(aMs));
+}
+
+void delayMicroseconds(uint32_t aUs)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(aUs));
+}
+
+void yield(void)
+{
+    std::this_thread::yield();
+}
+
+int HardwareSerial::available(void)
+{
+    struct pollfd wPollFd = { STDIN_FILENO, POLLIN, 0 };
+    return (poll(&wPollFd, 1, 0) > 0) && ((wPollFd.revents & POLLIN) != 0) ? 1 : 0;
+}
+
+int HardwareSerial::read(void)
+{
+    uint8_t wByte;
+    return (available() && (::read(STDIN_FILENO, &wByte, 1) == 1)) ? wByte : -1;
+}
+
+int log_printf(const char* apFormat, ...)
+{
+    std::lock_guard<std::mutex> wLock(mLogMutex);
+
+    va_list wArgs;
+    va_start(wArgs, apFormat);
+    int wLen = vprintf(apFormat, wArgs);
+    va_end(wArgs);
+    fflush(stdout);
+
+    return wLen;
+}
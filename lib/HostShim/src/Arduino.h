@@ -0,0 +1,186 @@
+/*
+ * Arduino.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host (POSIX) replacement of the Arduino-ESP32 core subset used by the application.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+#include <sys/time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/timers.h"
+
+#include "esp32-hal-log.h"
+
+#define PROGMEM
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+
+typedef uint8_t byte;
+
+
+/******************************************************************************
+    String
+ *****************************************************************************/
+
+/** @brief Minimal Arduino String on top of std::string */
+class String
+{
+public:
+    String() = default;
+    String(const char* apStr) : mString((apStr != nullptr) ? apStr : "") {}
+    String(const std::string& arStr) : mString(arStr) {}
+    String(char aChar) : mString(1, aChar) {}
+    String(int aValue)           : mString(std::to_string(aValue)) {}
+    String(unsigned int aValue)  : mString(std::to_string(aValue)) {}
+    String(long aValue)          : mString(std::to_string(aValue)) {}
+    String(unsigned long aValue) : mString(std::to_string(aValue)) {}
+    String(float aValue, unsigned int aDecimals = 2)  { SetFloat(aValue, aDecimals); }
+    String(double aValue, unsigned int aDecimals = 2) { SetFloat(aValue, aDecimals); }
+
+    const char* c_str(void) const { return mString.c_str(); }
+    unsigned int length(void) const { return mString.length(); }
+    bool isEmpty(void) const { return mString.empty(); }
+
+    int toInt(void) const { return atoi(mString.c_str()); }
+    float toFloat(void) const { return atof(mString.c_str()); }
+
+    int indexOf(char aChar, unsigned int aFrom = 0) const
+    {
+        size_t wPos = mString.find(aChar, aFrom);
+        return (wPos == std::string::npos) ? -1 : static_cast<int>(wPos);
+    }
+    String substring(unsigned int aBegin, unsigned int aEnd = 0xFFFFFFFF) const
+    {
+        return String(mString.substr(aBegin, (aEnd == 0xFFFFFFFF) ? std::string::npos : (aEnd - aBegin)));
+    }
+
+    String& operator+=(const String& arOther) { mString += arOther.mString; return *this; }
+    String& operator+=(const char* apOther)   { mString += apOther; return *this; }
+    String& operator+=(char aChar)            { mString += aChar; return *this; }
+
+    friend String operator+(const String& arLeft, const String& arRight) { return String(arLeft.mString + arRight.mString); }
+    friend String operator+(const String& arLeft, const char* apRight)   { return String(arLeft.mString + apRight); }
+
+    bool operator==(const String& arOther) const { return mString == arOther.mString; }
+    bool operator==(const char* apOther) const   { return mString == apOther; }
+    bool operator!=(const String& arOther) const { return mString != arOther.mString; }
+    bool operator!=(const char* apOther) const   { return mString != apOther; }
+    char operator[](unsigned int aIndex) const   { return mString[aIndex]; }
+
+private:
+    std::string mString;
+
+    void SetFloat(double aValue, unsigned int aDecimals)
+    {
+        char wBuffer[32];
+        snprintf(wBuffer, sizeof(wBuffer), "%.*f", aDecimals, aValue);
+        mString = wBuffer;
+    }
+};
+
+
+/******************************************************************************
+    Serial
+ *****************************************************************************/
+
+/** @brief Serial port mapped to stdin/stdout */
+class HardwareSerial
+{
+public:
+    void begin(unsigned long aBaud) { (void) aBaud; }
+    void setDebugOutput(bool aEnable) { (void) aEnable; }
+
+    int available(void);
+    int read(void);
+
+    size_t write(uint8_t aByte) { return fwrite(&aByte, 1, 1, stdout); }
+    size_t write(const uint8_t* apBuffer, size_t aSize) { return fwrite(apBuffer, 1, aSize, stdout); }
+
+    size_t print(const char* apStr)     { return fputs(apStr, stdout), strlen(apStr); }
+    size_t print(const String& arStr)   { return print(arStr.c_str()); }
+    size_t println(const char* apStr = "") { size_t wLen = print(apStr); fputs("\r\n", stdout); fflush(stdout); return wLen + 2; }
+    size_t println(const String& arStr) { return println(arStr.c_str()); }
+
+    template<typename... Args>
+    size_t printf(const char* apFormat, Args... aArgs)
+    {
+        int wLen = ::printf(apFormat, aArgs...);
+        fflush(stdout);
+        return (wLen > 0) ? wLen : 0;
+    }
+
+    void flush(void) { fflush(stdout); }
+};
+
+extern HardwareSerial Serial;
+
+
+/******************************************************************************
+    Core functions
+ *****************************************************************************/
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(uint32_t aMs);
+void delayMicroseconds(uint32_t aUs);
+void yield(void);
+
+inline long map(long aValue, long aInMin, long aInMax, long aOutMin, long aOutMax)
+{
+    return (aValue - aInMin) * (aOutMax - aOutMin) / (aInMax - aInMin) + aOutMin;
+}
+
+#ifndef constrain
+#define constrain(amt, low, high)   ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+inline int64_t esp_timer_get_time(void)
+{
+    return static_cast<int64_t>(micros());
+}
+
+typedef enum
+{
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t esp_reset_reason(void)
+{
+    return ESP_RST_POWERON;
+}
+
+typedef int esp_err_t;
+#define ESP_OK      0
+#define ESP_FAIL    -1
+
+/* Application entry points implemented by the sketch */
+void setup(void);
+void loop(void);
@@ -0,0 +1,9 @@
+/*
+ * ArduinoJson.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Placeholder: the application includes ArduinoJson but does not use it yet.
+ */
+#pragma once
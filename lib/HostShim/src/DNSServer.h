@@ -0,0 +1,21 @@
+/*
+ * DNSServer.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "WiFiGeneric.h"
+
+class DNSServer
+{
+public:
+    bool start(uint16_t aPort, const String& arDomainName, const IPAddress& arResolvedIP)
+    {
+        (void) aPort; (void) arDomainName; (void) arResolvedIP;
+        return true;
+    }
+    void processNextRequest(void) {}
+    void stop(void) {}
+};
@@ -0,0 +1,63 @@
+/*
+ * ESPNtpClient.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the ESPNtpClient library. The host system clock is
+ * considered to be NTP synchronized: begin() raises a timeSyncd event.
+ */
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum
+{
+    timeSyncd,
+    noResponse,
+    invalidAddress,
+    invalidPort,
+    requestSent,
+    partlySync,
+    syncNotNeeded,
+    accuracyError,
+    responseReceived
+} NTPEventTypes_t;
+
+typedef struct
+{
+    NTPEventTypes_t event;
+} NTPEvent_t;
+
+typedef std::function<void(NTPEvent_t)> onSyncEvent_t;
+
+class NTPClient
+{
+public:
+    bool begin(const char* apNtpServerName = "pool.ntp.org", bool aManageWifi = false);
+    bool stop(void) { mIsRunning = false; return true; }
+
+    void onNTPSyncEvent(onSyncEvent_t aHandler) { mOnSyncEvent = aHandler; }
+
+    bool setTimeZone(const char* apTimeZone);
+    bool setInterval(uint32_t aInterval) { (void) aInterval; return true; }
+    bool setNTPTimeout(uint16_t aMilliseconds) { (void) aMilliseconds; return true; }
+    void setMinSyncAccuracy(uint32_t aAccuracy) { (void) aAccuracy; }
+    void settimeSyncThreshold(uint32_t aThreshold) { (void) aThreshold; }
+
+    time_t getLastNTPSync(void) const { return mLastSync; }
+
+    char* getTimeStr(void) { return getTimeStr(time(nullptr)); }
+    char* getTimeStr(time_t aMoment);
+    char* getDateStr(void) { return getDateStr(time(nullptr)); }
+    char* getDateStr(time_t aMoment);
+    char* getTimeDateString(time_t aMoment, const char* apFormat = "%02H:%02M:%02S %02d/%02m/%04Y");
+
+private:
+    onSyncEvent_t mOnSyncEvent = nullptr;
+    time_t        mLastSync    = 0;
+    bool          mIsRunning   = false;
+    char          mStrBuffer[32];
+};
+
+extern NTPClient NTP;
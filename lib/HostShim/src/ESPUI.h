@@ -0,0 +1,130 @@
+/*
+ * ESPUI.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the ESPUI library: controls are kept in memory,
+ * nothing is served over HTTP.
+ */
+#pragma once
+
+#include <map>
+#include <mutex>
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+/* Event types passed to control callbacks */
+#define B_DOWN          -1
+#define B_UP            1
+#define S_ACTIVE        -7
+#define S_INACTIVE      7
+#define SL_VALUE        8
+#define T_VALUE         10
+#define S_VALUE         11
+
+enum class Verbosity : uint8_t
+{
+    Quiet = 0,
+    Verbose,
+    VerboseJSON
+};
+
+class Control
+{
+public:
+    typedef uint16_t ControlId_t;
+
+    enum Type : uint8_t
+    {
+        Title = 0, Pad, PadWithCenter, Button, Label, Switcher, Slider, Number, Text,
+        Graph, GraphPoint, Tab, Select, Option, Min, Max, Step, Gauge, Accel, Separator, Time
+    };
+
+    enum Color : uint8_t
+    {
+        Turquoise, Emerald, Peterriver, Wetasphalt, Sunflower, Carrot, Alizarin, Dark, None = 0xFF
+    };
+
+    static constexpr ControlId_t noParent = 0xFFFF;
+
+    typedef void (*Callback_t)(Control*, int);
+
+    Type        type;
+    String      label;
+    String      value;
+    Color       color;
+    ControlId_t parentControl;
+    Callback_t  callback;
+    bool        enabled = true;
+    bool        visible = true;
+    String      inputType;
+
+    ControlId_t GetId(void) const { return mId; }
+
+private:
+    friend class ESPUIClass;
+    ControlId_t mId = 0;
+};
+
+class ESPUIClass
+{
+public:
+    bool captivePortal = false;
+
+    void setVerbosity(Verbosity aVerbosity) { (void) aVerbosity; }
+    void begin(const char* apTitle, const char* apUser = nullptr, const char* apPassword = nullptr, uint16_t aPort = 80);
+
+    Control::ControlId_t addControl(Control::Type aType, const char* apLabel, const String& arValue = String(""),
+            Control::Color aColor = Control::Color::Turquoise, Control::ControlId_t aParent = Control::noParent,
+            Control::Callback_t aCallback = nullptr);
+    bool removeControl(Control::ControlId_t aId, bool aForceReloadUI = false);
+    Control* getControl(Control::ControlId_t aId);
+
+    Control::ControlId_t label(const char* apLabel, Control::Color aColor, const String& arValue = "")
+    {
+        return addControl(Control::Type::Label, apLabel, arValue, aColor);
+    }
+    Control::ControlId_t button(const char* apLabel, Control::Callback_t aCallback, Control::Color aColor, const String& arValue = "")
+    {
+        return addControl(Control::Type::Button, apLabel, arValue, aColor, Control::noParent, aCallback);
+    }
+    Control::ControlId_t switcher(const char* apLabel, Control::Callback_t aCallback, Control::Color aColor, bool aStartState = false)
+    {
+        return addControl(Control::Type::Switcher, apLabel, aStartState ? "1" : "0", aColor, Control::noParent, aCallback);
+    }
+    Control::ControlId_t slider(const char* apLabel, Control::Callback_t aCallback, Control::Color aColor, int aValue, int aMin = 0, int aMax = 100)
+    {
+        (void) aMin; (void) aMax;
+        return addControl(Control::Type::Slider, apLabel, String(aValue), aColor, Control::noParent, aCallback);
+    }
+    Control::ControlId_t text(const char* apLabel, Control::Callback_t aCallback, Control::Color aColor, const String& arValue = "")
+    {
+        return addControl(Control::Type::Text, apLabel, arValue, aColor, Control::noParent, aCallback);
+    }
+
+    void updateControlValue(Control::ControlId_t aId, const String& arValue, int aClientId = -1);
+    void updateLabel(Control::ControlId_t aId, const String& arValue) { updateControlValue(aId, arValue); }
+    void updateText(Control::ControlId_t aId, const String& arValue) { updateControlValue(aId, arValue); }
+    void updateSelect(Control::ControlId_t aId, const String& arValue) { updateControlValue(aId, arValue); }
+    void updateSwitcher(Control::ControlId_t aId, bool aValue) { updateControlValue(aId, aValue ? "1" : "0"); }
+    void updateSlider(Control::ControlId_t aId, int aValue) { updateControlValue(aId, String(aValue)); }
+
+    void setEnabled(Control::ControlId_t aId, bool aEnabled, int aClientId = -1);
+    void updateVisibility(Control::ControlId_t aId, bool aVisibility, int aClientId = -1);
+    void setInputType(Control::ControlId_t aId, const String& arType, int aClientId = -1);
+
+    void jsonReload(void) {}
+    void jsonDom(uint16_t aStartIndex) { (void) aStartIndex; }
+
+    /** @brief Host helper: simulate a user interaction with a control */
+    void trigger(Control::ControlId_t aId, const String& arValue, int aType);
+
+private:
+    std::recursive_mutex mMutex;
+    std::map<Control::ControlId_t, Control> mControls;
+    Control::ControlId_t mNextId = 1;
+};
+
+extern ESPUIClass ESPUI;
@@ -0,0 +1,22 @@
+/*
+ * ESP_MultiResetDetector.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the ESP_MultiResetDetector library: never detects a multi reset.
+ */
+#pragma once
+
+#include "Arduino.h"
+
+class MultiResetDetector
+{
+public:
+    MultiResetDetector(int aTimeout, int aAddress) { (void) aTimeout; (void) aAddress; }
+
+    bool detectMultiReset(void) { return false; }
+    bool waitingForMRD(void) { return false; }
+    void loop(void) {}
+    void stop(void) {}
+};
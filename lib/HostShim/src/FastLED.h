@@ -0,0 +1,140 @@
+/*
+ * FastLED.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the FastLED subset used by the application: CRGB,
+ * fill_solid() and a controller that records the shown frames.
+ */
+#pragma once
+
+#include "Arduino.h"
+
+typedef uint8_t fract8;
+
+inline constexpr uint8_t scale8(uint8_t aValue, fract8 aScale)
+{
+    return static_cast<uint8_t>((static_cast<uint16_t>(aValue) * (1 + static_cast<uint16_t>(aScale))) >> 8);
+}
+
+inline constexpr uint8_t scale8_video(uint8_t aValue, fract8 aScale)
+{
+    return static_cast<uint8_t>(((static_cast<uint16_t>(aValue) * aScale) >> 8) + (((aValue != 0) && (aScale != 0)) ? 1 : 0));
+}
+
+struct CRGB
+{
+    union
+    {
+        struct
+        {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    typedef enum
+    {
+        Black   = 0x000000,
+        White   = 0xFFFFFF,
+        Red     = 0xFF0000,
+        Green   = 0x008000,
+        Lime    = 0x00FF00,
+        Blue    = 0x0000FF,
+        Orange  = 0xFFA500,
+        Yellow  = 0xFFFF00,
+    } HTMLColorCode;
+
+    constexpr CRGB() : r(0), g(0), b(0) {}
+    constexpr CRGB(uint8_t aR, uint8_t aG, uint8_t aB) : r(aR), g(aG), b(aB) {}
+    constexpr CRGB(uint32_t aColor) : r((aColor >> 16) & 0xFF), g((aColor >> 8) & 0xFF), b(aColor & 0xFF) {}
+    constexpr CRGB(HTMLColorCode aColor) : CRGB(static_cast<uint32_t>(aColor)) {}
+
+    uint8_t& operator[](uint8_t aIndex) { return raw[aIndex]; }
+    const uint8_t& operator[](uint8_t aIndex) const { return raw[aIndex]; }
+
+    bool operator==(const CRGB& arOther) const { return (r == arOther.r) && (g == arOther.g) && (b == arOther.b); }
+    bool operator!=(const CRGB& arOther) const { return !(*this == arOther); }
+
+    CRGB& nscale8(uint8_t aScale)
+    {
+        r = ::scale8(r, aScale);
+        g = ::scale8(g, aScale);
+        b = ::scale8(b, aScale);
+        return *this;
+    }
+
+    CRGB scale8(uint8_t aScale) const
+    {
+        return CRGB(::scale8(r, aScale), ::scale8(g, aScale), ::scale8(b, aScale));
+    }
+
+    explicit operator bool() const { return (r | g | b) != 0; }
+};
+
+/* LED chipsets, color orders and corrections accepted by addLeds() */
+enum ESPIChipsets { WS2812, WS2812B, WS2811, SK6812 };
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum LEDColorCorrection { TypicalLEDStrip = 0xFFB0F0, TypicalPixelString = 0xFFE08C, UncorrectedColor = 0xFFFFFF };
+
+#define BINARY_DITHER   0x01
+#define DISABLE_DITHER  0x00
+
+inline void fill_solid(CRGB* apLeds, int aNumber, const CRGB& arColor)
+{
+    for (int wI = 0; wI < aNumber; wI++)
+    {
+        apLeds[wI] = arColor;
+    }
+}
+
+/** @brief LED controller: keeps the output buffer and counts frames */
+class CFastLED
+{
+public:
+    template<ESPIChipsets CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CFastLED& addLeds(CRGB* apLeds, int aNumber)
+    {
+        mpLeds   = apLeds;
+        mNumLeds = aNumber;
+        return *this;
+    }
+
+    void setDither(uint8_t aDither) { mDither = aDither; }
+    void setCorrection(LEDColorCorrection aCorrection) { (void) aCorrection; }
+    void setBrightness(uint8_t aBrightness) { mBrightness = aBrightness; }
+    uint8_t getBrightness(void) const { return mBrightness; }
+    void setMaxRefreshRate(uint16_t aRefresh, bool aConstrain = false) { (void) aRefresh; (void) aConstrain; }
+
+    void clear(bool aWriteData = false)
+    {
+        if (mpLeds != nullptr)
+        {
+            fill_solid(mpLeds, mNumLeds, CRGB::Black);
+        }
+        if (aWriteData)
+        {
+            show();
+        }
+    }
+
+    /** @brief Takes as long as the WS2812 transfer, 30 us per LED plus the 50 us reset */
+    void show(void) { delayMicroseconds((mNumLeds * 30) + 50); mFrameCount++; }
+    void show(uint8_t aBrightness) { mBrightness = aBrightness; show(); }
+
+    int size(void) const { return mNumLeds; }
+    CRGB* leds(void) { return mpLeds; }
+    uint32_t getFrameCount(void) const { return mFrameCount; }
+
+private:
+    CRGB*    mpLeds      = nullptr;
+    int      mNumLeds    = 0;
+    uint8_t  mBrightness = 255;
+    uint8_t  mDither     = BINARY_DITHER;
+    uint32_t mFrameCount = 0;
+};
+
+extern CFastLED FastLED;
@@ -0,0 +1,15 @@
+/*
+ * FreeRTOScpp.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the FreeRTOScpp wrapper library (same API subset).
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+namespace FreeRTOScpp
+{
+}
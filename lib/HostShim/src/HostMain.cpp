@@ -0,0 +1,56 @@
+/*
+ * HostMain.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Entry point of the host build: runs setup() and loop() like the
+ * Arduino-ESP32 loopTask does. The process terminates after
+ * HOST_RUN_TIME_MS milliseconds if this environment variable is set.
+ * Not built for the unit tests in test/, they have their own main().
+ */
+#ifndef PIO_UNIT_TESTING
+
+#include <cstdlib>
+#include <thread>
+
+#include "Arduino.h"
+
+/* Optional hook to prepare the host environment (e.g. preset settings) before setup() */
+extern void HostPreSetup(void) __attribute__((weak));
+
+int main(int argc, char* argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    const char* wpRunTime = getenv("HOST_RUN_TIME_MS");
+    if (wpRunTime != nullptr)
+    {
+        uint32_t wRunTimeMs = static_cast<uint32_t>(strtoul(wpRunTime, nullptr, 10));
+        std::thread([wRunTimeMs]()
+        {
+            delay(wRunTimeMs);
+            fflush(stdout);
+            std::_Exit(EXIT_SUCCESS);
+        }).detach();
+    }
+
+    /* Start the kernel, then run the sketch in the "loopTask" context */
+    vTaskStartScheduler();
+
+    if (HostPreSetup != nullptr)
+    {
+        HostPreSetup();
+    }
+
+    setup();
+    for (;;)
+    {
+        loop();
+    }
+
+    return EXIT_SUCCESS;
+}
+
+#endif /* PIO_UNIT_TESTING */
@@ -0,0 +1,374 @@
+/*
+ * HostShim.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Implementation of the simulated peripherals (LEDs, WiFi, web UI, NTP, task watchdog) of the host build.
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+
+#include "FastLED.h"
+#include "WiFi.h"
+#include "ESPUI.h"
+#include "ESPNtpClient.h"
+#include "esp_task_wdt.h"
+
+
+/******************************************************************************
+    FastLED
+ *****************************************************************************/
+CFastLED FastLED;
+
+
+/******************************************************************************
+    WiFi
+ *****************************************************************************/
+WiFiClass WiFi;
+
+/* Simulated scan results */
+struct tSimulatedNetwork
+{
+    const char*      mSsid;
+    int32_t          mRssi;
+    wifi_auth_mode_t mAuthMode;
+};
+
+static const tSimulatedNetwork mSimulatedNetworks[] =
+{
+    { "HostNetwork",  -42, WIFI_AUTH_WPA2_PSK },
+    { "GuestNetwork", -67, WIFI_AUTH_OPEN     },
+    { "Neighbour",    -81, WIFI_AUTH_WPA2_PSK },
+};
+static constexpr int16_t mSimulatedNetworksCount = sizeof(mSimulatedNetworks) / sizeof(mSimulatedNetworks[0]);
+
+void WiFiClass::onEvent(WiFiEventFuncCb aCallback)
+{
+    std::lock_guard<std::mutex> wLock(mCallbacksMutex);
+    mCallbacks.push_back(aCallback);
+}
+
+void WiFiClass::RaiseEvent(WiFiEvent_t aEvent, uint32_t aDelayMs)
+{
+    /* Events are delivered from a separate context like the ESP32 event loop */
+    std::thread([this, aEvent, aDelayMs]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(aDelayMs));
+
+        std::vector<WiFiEventFuncCb> wCallbacks;
+        {
+            std::lock_guard<std::mutex> wLock(mCallbacksMutex);
+            wCallbacks = mCallbacks;
+        }
+        for (auto& wCallback : wCallbacks)
+        {
+            wCallback(aEvent);
+        }
+    }).detach();
+}
+
+wl_status_t WiFiClass::begin(const char* apSsid, const char* apPassword)
+{
+    (void) apPassword;
+
+    if ((apSsid == nullptr) || (strlen(apSsid) == 0))
+    {
+        mStatus = WL_NO_SSID_AVAIL;
+        return mStatus;
+    }
+
+    mStatus = WL_CONNECTED;
+    RaiseEvent(ARDUINO_EVENT_WIFI_STA_CONNECTED, 200);
+    RaiseEvent(ARDUINO_EVENT_WIFI_STA_GOT_IP, 400);
+
+    return mStatus;
+}
+
+bool WiFiClass::reconnect(void)
+{
+    return mStatus == WL_CONNECTED;
+}
+
+bool WiFiClass::disconnect(bool aWifiOff)
+{
+    (void) aWifiOff;
+
+    if (mStatus == WL_CONNECTED)
+    {
+        mStatus = WL_DISCONNECTED;
+        RaiseEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, 0);
+    }
+    return true;
+}
+
+bool WiFiClass::softAP(const char* apSsid, const char* apPassword)
+{
+    (void) apSsid;
+    (void) apPassword;
+
+    mIsApActive = true;
+    RaiseEvent(ARDUINO_EVENT_WIFI_AP_START, 100);
+    return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool aWifiOff)
+{
+    (void) aWifiOff;
+
+    if (mIsApActive)
+    {
+        mIsApActive = false;
+        RaiseEvent(ARDUINO_EVENT_WIFI_AP_STOP, 0);
+    }
+    return true;
+}
+
+int16_t WiFiClass::scanNetworks(bool aAsync)
+{
+    if (aAsync)
+    {
+        mScanResult = WIFI_SCAN_RUNNING;
+        std::thread([this]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+            mScanResult = mSimulatedNetworksCount;
+        }).detach();
+        RaiseEvent(ARDUINO_EVENT_WIFI_SCAN_DONE, 1600);
+        return WIFI_SCAN_RUNNING;
+    }
+
+    mScanResult = mSimulatedNetworksCount;
+    return mScanResult;
+}
+
+String WiFiClass::SSID(uint8_t aIndex) const
+{
+    return (aIndex < mSimulatedNetworksCount) ? String(mSimulatedNetworks[aIndex].mSsid) : String();
+}
+
+int32_t WiFiClass::RSSI(uint8_t aIndex) const
+{
+    return (aIndex < mSimulatedNetworksCount) ? mSimulatedNetworks[aIndex].mRssi : 0;
+}
+
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t aIndex) const
+{
+    return (aIndex < mSimulatedNetworksCount) ? mSimulatedNetworks[aIndex].mAuthMode : WIFI_AUTH_OPEN;
+}
+
+
+/******************************************************************************
+    ESPUI
+ *****************************************************************************/
+ESPUIClass ESPUI;
+
+void ESPUIClass::begin(const char* apTitle, const char* apUser, const char* apPassword, uint16_t aPort)
+{
+    (void) apUser;
+    (void) apPassword;
+
+    log_printf("[ESPUI] '%s' started on port %u (%u controls, captive portal %d)\r\n",
+            apTitle, aPort, static_cast<unsigned>(mControls.size()), captivePortal);
+}
+
+Control::ControlId_t ESPUIClass::addControl(Control::Type aType, const char* apLabel, const String& arValue,
+        Control::Color aColor, Control::ControlId_t aParent, Control::Callback_t aCallback)
+{
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
+    Control wControl;
+    wControl.type          = aType;
+    wControl.label         = apLabel;
+    wControl.value         = arValue;
+    wControl.color         = aColor;
+    wControl.parentControl = aParent;
+    wControl.callback      = aCallback;
+    wControl.mId           = mNextId++;
+
+    mControls[wControl.mId] = wControl;
+    return wControl.mId;
+}
+
+bool ESPUIClass::removeControl(Control::ControlId_t aId, bool aForceReloadUI)
+{
+    (void) aForceReloadUI;
+
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+    return mControls.erase(aId) > 0;
+}
+
+Control* ESPUIClass::getControl(Control::ControlId_t aId)
+{
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
+    auto wIterator = mControls.find(aId);
+    return (wIterator != mControls.end()) ? &wIterator->second : nullptr;
+}
+
+void ESPUIClass::updateControlValue(Control::ControlId_t aId, const String& arValue, int aClientId)
+{
+    (void) aClientId;
+
+    Control* wpControl = getControl(aId);
+    if (wpControl != nullptr)
+    {
+        wpControl->value = arValue;
+    }
+}
+
+void ESPUIClass::setEnabled(Control::ControlId_t aId, bool aEnabled, int aClientId)
+{
+    (void) aClientId;
+
+    Control* wpControl = getControl(aId);
+    if (wpControl != nullptr)
+    {
+        wpControl->enabled = aEnabled;
+    }
+}
+
+void ESPUIClass::updateVisibility(Control::ControlId_t aId, bool aVisibility, int aClientId)
+{
+    (void) aClientId;
+
+    Control* wpControl = getControl(aId);
+    if (wpControl != nullptr)
+    {
+        wpControl->visible = aVisibility;
+    }
+}
+
+void ESPUIClass::setInputType(Control::ControlId_t aId, const String& arType, int aClientId)
+{
+    (void) aClientId;
+
+    Control* wpControl = getControl(aId);
+    if (wpControl != nullptr)
+    {
+        wpControl->inputType = arType;
+    }
+}
+
+void ESPUIClass::trigger(Control::ControlId_t aId, const String& arValue, int aType)
+{
+    Control* wpControl = getControl(aId);
+    if ((wpControl != nullptr) && (wpControl->callback != nullptr))
+    {
+        wpControl->value = arValue;
+        wpControl->callback(wpControl, aType);
+    }
+}
+
+
+/******************************************************************************
+    NTP
+ *****************************************************************************/
+NTPClient NTP;
+
+bool NTPClient::begin(const char* apNtpServerName, bool aManageWifi)
+{
+    (void) apNtpServerName;
+    (void) aManageWifi;
+
+    mIsRunning = true;
+
+    /* The host clock is already synchronized, report it asynchronously */
+    std::thread([this]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        mLastSync = time(nullptr);
+        if (mIsRunning && mOnSyncEvent)
+        {
+            NTPEvent_t wEvent = { timeSyncd };
+            mOnSyncEvent(wEvent);
+        }
+    }).detach();
+
+    return true;
+}
+
+bool NTPClient::setTimeZone(const char* apTimeZone)
+{
+    setenv("TZ", apTimeZone, 1);
+    tzset();
+    return true;
+}
+
+char* NTPClient::getTimeStr(time_t aMoment)
+{
+    struct tm wLocalTime;
+    localtime_r(&aMoment, &wLocalTime);
+    strftime(mStrBuffer, sizeof(mStrBuffer), "%H:%M:%S", &wLocalTime);
+    return mStrBuffer;
+}
+
+char* NTPClient::getDateStr(time_t aMoment)
+{
+    struct tm wLocalTime;
+    localtime_r(&aMoment, &wLocalTime);
+    strftime(mStrBuffer, sizeof(mStrBuffer), "%d/%m/%Y", &wLocalTime);
+    return mStrBuffer;
+}
+
+char* NTPClient::getTimeDateString(time_t aMoment, const char* apFormat)
+{
+    (void) apFormat;
+
+    struct tm wLocalTime;
+    localtime_r(&aMoment, &wLocalTime);
+    strftime(mStrBuffer, sizeof(mStrBuffer), "%H:%M:%S %d/%m/%Y", &wLocalTime);
+    return mStrBuffer;
+}
+
+
+/******************************************************************************
+    Task watchdog
+ *****************************************************************************/
+/* Timeout of the task watchdog, default of the ESP-IDF configuration */
+static constexpr uint32_t mTaskWatchdogTimeoutMs = 5000;
+
+static std::atomic<bool>     mTaskWatchdogSubscribed(false);
+static std::atomic<uint32_t> mTaskWatchdogResetMs(0);
+
+esp_err_t esp_task_wdt_add(TaskHandle_t aTask)
+{
+    (void) aTask;
+
+    mTaskWatchdogResetMs = millis();
+    if (mTaskWatchdogSubscribed.exchange(true) == false)
+    {
+        /* Simulate the watchdog interrupt, which resets the device */
+        std::thread([]()
+        {
+            for (;;)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                if (mTaskWatchdogSubscribed && ((millis() - mTaskWatchdogResetMs) >= mTaskWatchdogTimeoutMs))
+                {
+                    log_printf("[WDT] Task watchdog got triggered, restarting\r\n");
+                    fflush(stdout);
+                    _exit(1);
+                }
+            }
+        }).detach();
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_task_wdt_delete(TaskHandle_t aTask)
+{
+    (void) aTask;
+
+    mTaskWatchdogSubscribed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_task_wdt_reset(void)
+{
+    mTaskWatchdogResetMs = millis();
+    return ESP_OK;
+}
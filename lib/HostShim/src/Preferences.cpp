@@ -0,0 +1,90 @@
+/*
+ * Preferences.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <mutex>
+
+#include "Preferences.h"
+
+/* Storage: namespace -> key -> raw value */
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> mStorage;
+static std::mutex mStorageMutex;
+
+bool Preferences::begin(const char* apName, bool aReadOnly)
+{
+    (void) aReadOnly;
+
+    mNamespace = apName;
+    mIsOpen    = true;
+    return true;
+}
+
+void Preferences::end(void)
+{
+    mIsOpen = false;
+}
+
+bool Preferences::clear(void)
+{
+    std::lock_guard<std::mutex> wLock(mStorageMutex);
+    mStorage[mNamespace].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* apKey)
+{
+    std::lock_guard<std::mutex> wLock(mStorageMutex);
+    return mStorage[mNamespace].erase(apKey) > 0;
+}
+
+bool Preferences::isKey(const char* apKey)
+{
+    std::lock_guard<std::mutex> wLock(mStorageMutex);
+    return mStorage[mNamespace].count(apKey) > 0;
+}
+
+String Preferences::getString(const char* apKey, String aDefault)
+{
+    std::vector<uint8_t> wValue;
+    if (Find(apKey, wValue) && !wValue.empty())
+    {
+        return String(reinterpret_cast<const char*>(wValue.data()));
+    }
+    return aDefault;
+}
+
+size_t Preferences::getBytes(const char* apKey, void* apBuffer, size_t aMaxLength)
+{
+    std::vector<uint8_t> wValue;
+    if (Find(apKey, wValue) && (wValue.size() <= aMaxLength))
+    {
+        memcpy(apBuffer, wValue.data(), wValue.size());
+        return wValue.size();
+    }
+    return 0;
+}
+
+size_t Preferences::Put(const char* apKey, const void* apValue, size_t aLength)
+{
+    std::lock_guard<std::mutex> wLock(mStorageMutex);
+
+    const uint8_t* wpValue = static_cast<const uint8_t*>(apValue);
+    mStorage[mNamespace][apKey] = std::vector<uint8_t>(wpValue, wpValue + aLength);
+    return aLength;
+}
+
+bool Preferences::Find(const char* apKey, std::vector<uint8_t>& arValue)
+{
+    std::lock_guard<std::mutex> wLock(mStorageMutex);
+
+    auto& wNamespace = mStorage[mNamespace];
+    auto  wIterator  = wNamespace.find(apKey);
+    if (wIterator == wNamespace.end())
+    {
+        return false;
+    }
+    arValue = wIterator->second;
+    return true;
+}
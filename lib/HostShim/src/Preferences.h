@@ -0,0 +1,70 @@
+/*
+ * Preferences.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the ESP32 Preferences (NVS) library: an in-memory
+ * key/value store per namespace, shared by all Preferences instances.
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+class Preferences
+{
+public:
+    bool begin(const char* apName, bool aReadOnly = false);
+    void end(void);
+
+    bool clear(void);
+    bool remove(const char* apKey);
+    bool isKey(const char* apKey);
+
+    size_t putBool(const char* apKey, bool aValue)            { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putChar(const char* apKey, int8_t aValue)          { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putUChar(const char* apKey, uint8_t aValue)        { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putShort(const char* apKey, int16_t aValue)        { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putUShort(const char* apKey, uint16_t aValue)      { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putInt(const char* apKey, int32_t aValue)          { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putUInt(const char* apKey, uint32_t aValue)        { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putFloat(const char* apKey, float aValue)          { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putDouble(const char* apKey, double aValue)        { return Put(apKey, &aValue, sizeof(aValue)); }
+    size_t putString(const char* apKey, const char* apValue)  { return Put(apKey, apValue, strlen(apValue) + 1); }
+    size_t putString(const char* apKey, String aValue)        { return putString(apKey, aValue.c_str()); }
+    size_t putBytes(const char* apKey, const void* apValue, size_t aLength) { return Put(apKey, apValue, aLength); }
+
+    bool     getBool(const char* apKey, bool aDefault = false)        { return Get(apKey, aDefault); }
+    int8_t   getChar(const char* apKey, int8_t aDefault = 0)          { return Get(apKey, aDefault); }
+    uint8_t  getUChar(const char* apKey, uint8_t aDefault = 0)        { return Get(apKey, aDefault); }
+    int16_t  getShort(const char* apKey, int16_t aDefault = 0)        { return Get(apKey, aDefault); }
+    uint16_t getUShort(const char* apKey, uint16_t aDefault = 0)      { return Get(apKey, aDefault); }
+    int32_t  getInt(const char* apKey, int32_t aDefault = 0)         { return Get(apKey, aDefault); }
+    uint32_t getUInt(const char* apKey, uint32_t aDefault = 0)        { return Get(apKey, aDefault); }
+    float    getFloat(const char* apKey, float aDefault = NAN)        { return Get(apKey, aDefault); }
+    double   getDouble(const char* apKey, double aDefault = NAN)      { return Get(apKey, aDefault); }
+    String   getString(const char* apKey, String aDefault = String());
+    size_t   getBytes(const char* apKey, void* apBuffer, size_t aMaxLength);
+
+private:
+    std::string mNamespace;
+    bool        mIsOpen = false;
+
+    size_t Put(const char* apKey, const void* apValue, size_t aLength);
+    bool   Find(const char* apKey, std::vector<uint8_t>& arValue);
+
+    template<typename T>
+    T Get(const char* apKey, T aDefault)
+    {
+        std::vector<uint8_t> wValue;
+        if (Find(apKey, wValue) && (wValue.size() == sizeof(T)))
+        {
+            memcpy(&aDefault, wValue.data(), sizeof(T));
+        }
+        return aDefault;
+    }
+};
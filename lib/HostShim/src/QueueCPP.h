@@ -0,0 +1,60 @@
+/*
+ * QueueCPP.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "FreeRTOScpp.h"
+#include "freertos/queue.h"
+
+namespace FreeRTOScpp
+{
+    class QueueBase
+    {
+    protected:
+        explicit QueueBase(QueueHandle_t aHandle) : mHandle(aHandle) {}
+
+    public:
+        virtual ~QueueBase() { vQueueDelete(mHandle); }
+
+        UBaseType_t waiting(void) const { return uxQueueMessagesWaiting(mHandle); }
+        UBaseType_t available(void) const { return uxQueueSpacesAvailable(mHandle); }
+        void reset(void) { xQueueReset(mHandle); }
+        bool full(void) { return available() == 0; }
+        bool empty(void) { return waiting() == 0; }
+
+        operator QueueHandle_t(void) const { return mHandle; }
+
+    protected:
+        QueueHandle_t mHandle;
+    };
+
+    template<class T>
+    class QueueTypeBase : public QueueBase
+    {
+    protected:
+        explicit QueueTypeBase(QueueHandle_t aHandle) : QueueBase(aHandle) {}
+
+    public:
+        bool push(T const& arItem, TickType_t aTicks = portMAX_DELAY) { return xQueueSendToFront(mHandle, &arItem, aTicks) == pdPASS; }
+        bool add(T const& arItem, TickType_t aTicks = portMAX_DELAY) { return xQueueSendToBack(mHandle, &arItem, aTicks) == pdPASS; }
+        bool pop(T& arVar, TickType_t aTicks = portMAX_DELAY) { return xQueueReceive(mHandle, &arVar, aTicks) == pdPASS; }
+        bool peek(T& arVar, TickType_t aTicks = 0) { return xQueuePeek(mHandle, &arVar, aTicks) == pdPASS; }
+
+        bool addFromISR(T const& arItem, BaseType_t* apWaken = nullptr) { (void) apWaken; return add(arItem, 0); }
+        bool popFromISR(T& arVar, BaseType_t* apWaken = nullptr) { (void) apWaken; return pop(arVar, 0); }
+    };
+
+    template<class T, unsigned QueueLength>
+    class Queue : public QueueTypeBase<T>
+    {
+    public:
+        explicit Queue(char const* apName = nullptr)
+            : QueueTypeBase<T>(xQueueCreate(QueueLength, sizeof(T)))
+        {
+            (void) apName;
+        }
+    };
+}
@@ -0,0 +1,89 @@
+/*
+ * TaskCPP.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "FreeRTOScpp.h"
+#include "freertos/task.h"
+
+namespace FreeRTOScpp
+{
+    enum TaskPriority
+    {
+        TaskPrio_Idle    = 0,
+        TaskPrio_Low     = 1,
+        TaskPrio_HMI     = TaskPrio_Low + 1,
+        TaskPrio_Mid     = configMAX_PRIORITIES / 2,
+        TaskPrio_High    = configMAX_PRIORITIES - 1 - 1,
+        TaskPrio_Highest = configMAX_PRIORITIES - 1,
+    };
+
+    class TaskBase
+    {
+    protected:
+        TaskBase() = default;
+
+    public:
+        virtual ~TaskBase()
+        {
+            if (mTaskHandle != nullptr)
+            {
+                vTaskDelete(mTaskHandle);
+            }
+        }
+
+        TaskHandle_t getTaskHandle(void) const { return mTaskHandle; }
+
+        void give(void) { xTaskNotifyGive(mTaskHandle); }
+        void notify(uint32_t aValue, eNotifyAction aAction) { xTaskNotify(mTaskHandle, aValue, aAction); }
+
+        static uint32_t take(bool aClear = true, TickType_t aTicks = portMAX_DELAY)
+        {
+            return ulTaskNotifyTake(aClear ? pdTRUE : pdFALSE, aTicks);
+        }
+
+        static bool wait(uint32_t aClearEnter, uint32_t aClearExit = 0xFFFFFFFF,
+                uint32_t* apValue = nullptr, TickType_t aTicks = portMAX_DELAY)
+        {
+            return xTaskNotifyWait(aClearEnter, aClearExit, apValue, aTicks) == pdPASS;
+        }
+
+        static void delay(TickType_t aTicks) { vTaskDelay(aTicks); }
+        static void yield(void) { taskYIELD(); }
+
+    protected:
+        TaskHandle_t mTaskHandle = nullptr;
+    };
+
+    /**
+     * @brief Task wrapper with virtual task() function.
+     *
+     * The task is created in the constructor and blocks on a notification
+     * before calling task(), so the derived class can finish its construction
+     * (and initialization) before it is started with give().
+     */
+    template<uint32_t StackSize = 0>
+    class TaskClassS : public TaskBase
+    {
+    public:
+        TaskClassS(char const* apName, TaskPriority aPriority, unsigned aStackDepth = StackSize)
+        {
+            xTaskCreate(&TaskClassS::taskfun, apName, aStackDepth, this, aPriority, &mTaskHandle);
+        }
+
+        virtual void task(void) = 0;
+
+    private:
+        static void taskfun(void* apParameter)
+        {
+            TaskClassS* wpTask = static_cast<TaskClassS*>(apParameter);
+
+            /* Wait for start trigger */
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            wpTask->task();
+        }
+    };
+}
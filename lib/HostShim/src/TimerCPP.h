@@ -0,0 +1,43 @@
+/*
+ * TimerCPP.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "FreeRTOScpp.h"
+#include "freertos/timers.h"
+
+namespace FreeRTOScpp
+{
+    class TimerClass
+    {
+    public:
+        TimerClass(char const* apName, TickType_t aPeriod, bool aReload)
+        {
+            mHandle = xTimerCreate(apName, aPeriod, aReload ? pdTRUE : pdFALSE, this, &TimerClass::timerCallback);
+        }
+
+        virtual ~TimerClass() { xTimerDelete(mHandle, portMAX_DELAY); }
+
+        bool active(void) { return xTimerIsTimerActive(mHandle) != pdFALSE; }
+        bool start(TickType_t aTicks = portMAX_DELAY) { return xTimerStart(mHandle, aTicks) == pdPASS; }
+        bool stop(TickType_t aTicks = portMAX_DELAY) { return xTimerStop(mHandle, aTicks) == pdPASS; }
+        bool reset(TickType_t aTicks = portMAX_DELAY) { return xTimerReset(mHandle, aTicks) == pdPASS; }
+        bool period(TickType_t aNewPeriod, TickType_t aTicks = portMAX_DELAY) { return xTimerChangePeriod(mHandle, aNewPeriod, aTicks) == pdPASS; }
+
+        bool startFromISR(BaseType_t* apWaken) { (void) apWaken; return start(0); }
+        bool stopFromISR(BaseType_t* apWaken) { (void) apWaken; return stop(0); }
+
+        virtual void timer(void) = 0;
+
+    private:
+        TimerHandle_t mHandle;
+
+        static void timerCallback(TimerHandle_t aHandle)
+        {
+            static_cast<TimerClass*>(pvTimerGetTimerID(aHandle))->timer();
+        }
+    };
+}
@@ -0,0 +1,58 @@
+/*
+ * WiFi.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host replacement of the Arduino-ESP32 WiFi class. Connecting, starting the
+ * access point and scanning are simulated: the corresponding events are raised
+ * asynchronously from an event thread, like the ESP32 event loop task does.
+ */
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "WiFiGeneric.h"
+#include "WiFiClient.h"
+#include "esp_wifi.h"
+
+class WiFiClass
+{
+public:
+    void onEvent(WiFiEventFuncCb aCallback);
+
+    bool mode(wifi_mode_t aMode) { mMode = aMode; return true; }
+    wifi_mode_t getMode(void) const { return mMode; }
+    void persistent(bool aPersistent) { (void) aPersistent; }
+
+    wl_status_t begin(const char* apSsid, const char* apPassword = nullptr);
+    bool reconnect(void);
+    bool disconnect(bool aWifiOff = false);
+    wl_status_t status(void) const { return mStatus; }
+
+    bool softAP(const char* apSsid, const char* apPassword = nullptr);
+    bool softAPdisconnect(bool aWifiOff = false);
+    IPAddress softAPIP(void) const { return IPAddress(192, 168, 4, 1); }
+    IPAddress localIP(void) const { return IPAddress(192, 168, 1, 42); }
+
+    int16_t scanNetworks(bool aAsync = false);
+    int16_t scanComplete(void) const { return mScanResult.load(); }
+    String SSID(uint8_t aIndex) const;
+    int32_t RSSI(uint8_t aIndex) const;
+    wifi_auth_mode_t encryptionType(uint8_t aIndex) const;
+
+private:
+    wifi_mode_t     mMode       = WIFI_OFF;
+    wl_status_t     mStatus     = WL_DISCONNECTED;
+    bool            mIsApActive = false;
+    std::atomic<int16_t> mScanResult { WIFI_SCAN_FAILED };
+
+    std::mutex                   mCallbacksMutex;
+    std::vector<WiFiEventFuncCb> mCallbacks;
+
+    void RaiseEvent(WiFiEvent_t aEvent, uint32_t aDelayMs);
+};
+
+extern WiFiClass WiFi;
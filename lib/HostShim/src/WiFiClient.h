@@ -0,0 +1,22 @@
+/*
+ * WiFiClient.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "WiFiGeneric.h"
+
+/** @brief TCP client; connect() succeeds immediately on the host */
+class WiFiClient
+{
+public:
+    void setTimeout(uint32_t aTimeoutMs) { (void) aTimeoutMs; }
+    int  connect(const char* apHost, uint16_t aPort) { (void) apHost; (void) aPort; mConnected = true; return 1; }
+    void stop(void) { mConnected = false; }
+    uint8_t connected(void) const { return mConnected ? 1 : 0; }
+
+private:
+    bool mConnected = false;
+};
@@ -0,0 +1,55 @@
+/*
+ * WiFiGeneric.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "WiFiType.h"
+
+typedef enum
+{
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_AP_START,
+    ARDUINO_EVENT_WIFI_AP_STOP,
+    ARDUINO_EVENT_WIFI_AP_STACONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STADISCONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STAIPASSIGNED,
+    ARDUINO_EVENT_WIFI_AP_PROBEREQRECVED,
+    ARDUINO_EVENT_WIFI_AP_GOT_IP6,
+    ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+
+typedef std::function<void(WiFiEvent_t aEvent)> WiFiEventFuncCb;
+
+/** @brief IPv4 address */
+class IPAddress
+{
+public:
+    IPAddress() = default;
+    IPAddress(uint8_t aA, uint8_t aB, uint8_t aC, uint8_t aD) : mAddress{aA, aB, aC, aD} {}
+
+    String toString(void) const
+    {
+        char wBuffer[16];
+        snprintf(wBuffer, sizeof(wBuffer), "%u.%u.%u.%u", mAddress[0], mAddress[1], mAddress[2], mAddress[3]);
+        return String(wBuffer);
+    }
+
+    uint8_t operator[](int aIndex) const { return mAddress[aIndex]; }
+
+private:
+    uint8_t mAddress[4] = { 0, 0, 0, 0 };
+};
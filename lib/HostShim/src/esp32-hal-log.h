@@ -0,0 +1,29 @@
+/*
+ * esp32-hal-log.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+
+typedef enum
+{
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+/** @brief Print to stdout (the log output of the host build) */
+int log_printf(const char* apFormat, ...) __attribute__((format(printf, 1, 2)));
+
+inline const char* pathToFileName(const char* apPath)
+{
+    const char* wpName = strrchr(apPath, '/');
+    return (wpName != nullptr) ? (wpName + 1) : apPath;
+}
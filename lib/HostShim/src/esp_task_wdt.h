@@ -0,0 +1,14 @@
+/*
+ * esp_task_wdt.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "Arduino.h"
+
+/* Simulated task watchdog, restarts the host build if a subscribed task is not reset in time */
+esp_err_t esp_task_wdt_add(TaskHandle_t aTask);
+esp_err_t esp_task_wdt_delete(TaskHandle_t aTask);
+esp_err_t esp_task_wdt_reset(void);
@@ -0,0 +1,637 @@
+/*
+ * FreeRTOS.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host (POSIX) implementation of the FreeRTOS kernel subset declared in
+ * freertos/FreeRTOS.h, freertos/task.h, freertos/queue.h and freertos/timers.h.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/timers.h"
+
+
+/******************************************************************************
+    Tasks
+ *****************************************************************************/
+
+struct tskTaskControlBlock
+{
+    std::string             mName;
+    UBaseType_t             mPriority  = 0;
+    BaseType_t              mCoreId    = tskNO_AFFINITY;
+    UBaseType_t             mNumber    = 0;
+
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+    uint32_t                mNotifyValue   = 0;
+    bool                    mNotifyPending = false;
+
+    TaskFunction_t          mFunction   = nullptr;
+    void*                   mpParameter = nullptr;
+    std::thread             mThread;
+};
+
+static std::mutex                          mTaskListMutex;
+static std::condition_variable             mSchedulerStarted;
+static bool                                mIsSchedulerRunning = false;
+static std::vector<tskTaskControlBlock*>   mTaskList;
+
+static const auto mStartTime = std::chrono::steady_clock::now();
+
+static thread_local tskTaskControlBlock* mpCurrentTask = nullptr;
+
+static tskTaskControlBlock* GetCurrentTask(void)
+{
+    if (mpCurrentTask == nullptr)
+    {
+        /* First call from a thread not created by the kernel (e.g. main) */
+        mpCurrentTask = new tskTaskControlBlock();
+        mpCurrentTask->mName = "loopTask";
+
+        std::lock_guard<std::mutex> wLock(mTaskListMutex);
+        mpCurrentTask->mNumber = mTaskList.size();
+        mTaskList.push_back(mpCurrentTask);
+    }
+    return mpCurrentTask;
+}
+
+static void TaskEntry(tskTaskControlBlock* apTask)
+{
+    mpCurrentTask = apTask;
+
+    /* Tasks created before the scheduler start wait for it */
+    {
+        std::unique_lock<std::mutex> wLock(mTaskListMutex);
+        mSchedulerStarted.wait(wLock, [] { return mIsSchedulerRunning; });
+    }
+
+    apTask->mFunction(apTask->mpParameter);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, TaskHandle_t* apCreatedTask, BaseType_t aCoreId)
+{
+    (void) aStackDepth;
+
+    tskTaskControlBlock* wpTask = new tskTaskControlBlock();
+    wpTask->mName       = (apName != nullptr) ? apName : "";
+    wpTask->mPriority   = aPriority;
+    wpTask->mCoreId     = aCoreId;
+    wpTask->mFunction   = aFunction;
+    wpTask->mpParameter = apParameters;
+
+    {
+        std::lock_guard<std::mutex> wLock(mTaskListMutex);
+        wpTask->mNumber = mTaskList.size();
+        mTaskList.push_back(wpTask);
+    }
+
+    if (apCreatedTask != nullptr)
+    {
+        *apCreatedTask = wpTask;
+    }
+
+    wpTask->mThread = std::thread(TaskEntry, wpTask);
+    wpTask->mThread.detach();
+
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, TaskHandle_t* apCreatedTask)
+{
+    return xTaskCreatePinnedToCore(aFunction, apName, aStackDepth, apParameters, aPriority, apCreatedTask, tskNO_AFFINITY);
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, StackType_t* apStack, StaticTask_t* apTaskBuffer, BaseType_t aCoreId)
+{
+    (void) apStack;
+    (void) apTaskBuffer;
+
+    TaskHandle_t wHandle = nullptr;
+    xTaskCreatePinnedToCore(aFunction, apName, aStackDepth, apParameters, aPriority, &wHandle, aCoreId);
+    return wHandle;
+}
+
+void vTaskDelete(TaskHandle_t aTask)
+{
+    (void) aTask;
+    /* Host threads are detached and terminate with the process */
+}
+
+void vTaskStartScheduler(void)
+{
+    {
+        std::lock_guard<std::mutex> wLock(mTaskListMutex);
+        mIsSchedulerRunning = true;
+    }
+    mSchedulerStarted.notify_all();
+}
+
+void vTaskDelay(const TickType_t aTicksToDelay)
+{
+    if (aTicksToDelay == portMAX_DELAY)
+    {
+        /* Block this thread forever */
+        std::mutex wMutex;
+        std::unique_lock<std::mutex> wLock(wMutex);
+        std::condition_variable().wait(wLock, [] { return false; });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(aTicksToDelay));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return static_cast<TickType_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - mStartTime).count());
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return GetCurrentTask();
+}
+
+char* pcTaskGetName(TaskHandle_t aTask)
+{
+    tskTaskControlBlock* wpTask = (aTask != nullptr) ? aTask : GetCurrentTask();
+    return const_cast<char*>(wpTask->mName.c_str());
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void)
+{
+    std::lock_guard<std::mutex> wLock(mTaskListMutex);
+    return mTaskList.size();
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t* apTaskStatusArray, const UBaseType_t aArraySize, uint32_t* apTotalRunTime)
+{
+    std::lock_guard<std::mutex> wLock(mTaskListMutex);
+
+    UBaseType_t wCount = std::min<UBaseType_t>(aArraySize, mTaskList.size());
+    for (UBaseType_t wI = 0; wI < wCount; wI++)
+    {
+        memset(&apTaskStatusArray[wI], 0, sizeof(TaskStatus_t));
+        apTaskStatusArray[wI].xHandle           = mTaskList[wI];
+        apTaskStatusArray[wI].pcTaskName        = mTaskList[wI]->mName.c_str();
+        apTaskStatusArray[wI].xTaskNumber       = mTaskList[wI]->mNumber;
+        apTaskStatusArray[wI].uxCurrentPriority = mTaskList[wI]->mPriority;
+        apTaskStatusArray[wI].uxBasePriority    = mTaskList[wI]->mPriority;
+        apTaskStatusArray[wI].xCoreID           = mTaskList[wI]->mCoreId;
+    }
+
+    if (apTotalRunTime != nullptr)
+    {
+        /* Run time statistics are not available on the host */
+        *apTotalRunTime = 0;
+    }
+
+    return wCount;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t aTask)
+{
+    (void) aTask;
+    return 0;
+}
+
+void taskYIELD(void)
+{
+    std::this_thread::yield();
+}
+
+BaseType_t xTaskGenericNotify(TaskHandle_t aTask, uint32_t aValue, eNotifyAction aAction, uint32_t* apPreviousValue)
+{
+    BaseType_t wRetValue = pdPASS;
+
+    if (aTask == nullptr)
+    {
+        return pdFAIL;
+    }
+
+    {
+        std::lock_guard<std::mutex> wLock(aTask->mMutex);
+
+        if (apPreviousValue != nullptr)
+        {
+            *apPreviousValue = aTask->mNotifyValue;
+        }
+
+        switch (aAction)
+        {
+            case eSetBits:
+                aTask->mNotifyValue |= aValue;
+                break;
+            case eIncrement:
+                aTask->mNotifyValue++;
+                break;
+            case eSetValueWithOverwrite:
+                aTask->mNotifyValue = aValue;
+                break;
+            case eSetValueWithoutOverwrite:
+                if (aTask->mNotifyPending)
+                {
+                    wRetValue = pdFAIL;
+                }
+                else
+                {
+                    aTask->mNotifyValue = aValue;
+                }
+                break;
+            case eNoAction:
+            default:
+                break;
+        }
+
+        aTask->mNotifyPending = true;
+    }
+    aTask->mCondition.notify_one();
+
+    return wRetValue;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t aBitsToClearOnEntry, uint32_t aBitsToClearOnExit,
+        uint32_t* apNotificationValue, TickType_t aTicksToWait)
+{
+    tskTaskControlBlock* wpTask = GetCurrentTask();
+    std::unique_lock<std::mutex> wLock(wpTask->mMutex);
+
+    if (!wpTask->mNotifyPending)
+    {
+        wpTask->mNotifyValue &= ~aBitsToClearOnEntry;
+
+        auto wPredicate = [wpTask] { return wpTask->mNotifyPending; };
+        if (aTicksToWait == portMAX_DELAY)
+        {
+            wpTask->mCondition.wait(wLock, wPredicate);
+        }
+        else
+        {
+            wpTask->mCondition.wait_for(wLock, std::chrono::milliseconds(aTicksToWait), wPredicate);
+        }
+    }
+
+    if (apNotificationValue != nullptr)
+    {
+        *apNotificationValue = wpTask->mNotifyValue;
+    }
+
+    if (!wpTask->mNotifyPending)
+    {
+        return pdFAIL;
+    }
+
+    wpTask->mNotifyValue  &= ~aBitsToClearOnExit;
+    wpTask->mNotifyPending = false;
+
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t aClearCountOnExit, TickType_t aTicksToWait)
+{
+    tskTaskControlBlock* wpTask = GetCurrentTask();
+    std::unique_lock<std::mutex> wLock(wpTask->mMutex);
+
+    auto wPredicate = [wpTask] { return wpTask->mNotifyValue != 0; };
+    if (aTicksToWait == portMAX_DELAY)
+    {
+        wpTask->mCondition.wait(wLock, wPredicate);
+    }
+    else
+    {
+        wpTask->mCondition.wait_for(wLock, std::chrono::milliseconds(aTicksToWait), wPredicate);
+    }
+
+    uint32_t wValue = wpTask->mNotifyValue;
+    if (wValue != 0)
+    {
+        wpTask->mNotifyValue = (aClearCountOnExit != pdFALSE) ? 0 : (wValue - 1);
+    }
+    wpTask->mNotifyPending = false;
+
+    return wValue;
+}
+
+
+/******************************************************************************
+    Queues
+ *****************************************************************************/
+
+struct QueueDefinition
+{
+    UBaseType_t             mLength;
+    UBaseType_t             mItemSize;
+    std::deque<std::vector<uint8_t>> mItems;
+
+    std::mutex              mMutex;
+    std::condition_variable mNotEmpty;
+    std::condition_variable mNotFull;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t aLength, UBaseType_t aItemSize)
+{
+    QueueDefinition* wpQueue = new QueueDefinition();
+    wpQueue->mLength   = aLength;
+    wpQueue->mItemSize = aItemSize;
+    return wpQueue;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t aLength, UBaseType_t aItemSize, uint8_t* apStorage, StaticQueue_t* apQueueBuffer)
+{
+    (void) apStorage;
+    (void) apQueueBuffer;
+    return xQueueCreate(aLength, aItemSize);
+}
+
+void vQueueDelete(QueueHandle_t aQueue)
+{
+    delete aQueue;
+}
+
+static BaseType_t QueueSend(QueueHandle_t aQueue, const void* apItem, TickType_t aTicksToWait, bool aToFront)
+{
+    std::unique_lock<std::mutex> wLock(aQueue->mMutex);
+
+    auto wHasSpace = [aQueue] { return aQueue->mItems.size() < aQueue->mLength; };
+    if (aTicksToWait == portMAX_DELAY)
+    {
+        aQueue->mNotFull.wait(wLock, wHasSpace);
+    }
+    else if (aTicksToWait == 0)
+    {
+        /* Do not enter a timed wait if the call shall not block */
+        if (!wHasSpace())
+        {
+            return pdFAIL;
+        }
+    }
+    else if (!aQueue->mNotFull.wait_for(wLock, std::chrono::milliseconds(aTicksToWait), wHasSpace))
+    {
+        return pdFAIL;
+    }
+
+    const uint8_t* wpItem = static_cast<const uint8_t*>(apItem);
+    std::vector<uint8_t> wItem(wpItem, wpItem + aQueue->mItemSize);
+    if (aToFront)
+    {
+        aQueue->mItems.push_front(std::move(wItem));
+    }
+    else
+    {
+        aQueue->mItems.push_back(std::move(wItem));
+    }
+
+    wLock.unlock();
+    aQueue->mNotEmpty.notify_one();
+
+    return pdPASS;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t aQueue, const void* apItem, TickType_t aTicksToWait)
+{
+    return QueueSend(aQueue, apItem, aTicksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t aQueue, const void* apItem, TickType_t aTicksToWait)
+{
+    return QueueSend(aQueue, apItem, aTicksToWait, true);
+}
+
+static BaseType_t QueueReceive(QueueHandle_t aQueue, void* apBuffer, TickType_t aTicksToWait, bool aRemove)
+{
+    std::unique_lock<std::mutex> wLock(aQueue->mMutex);
+
+    auto wHasItem = [aQueue] { return !aQueue->mItems.empty(); };
+    if (aTicksToWait == portMAX_DELAY)
+    {
+        aQueue->mNotEmpty.wait(wLock, wHasItem);
+    }
+    else if (aTicksToWait == 0)
+    {
+        /* Do not enter a timed wait if the call shall not block */
+        if (!wHasItem())
+        {
+            return pdFAIL;
+        }
+    }
+    else if (!aQueue->mNotEmpty.wait_for(wLock, std::chrono::milliseconds(aTicksToWait), wHasItem))
+    {
+        return pdFAIL;
+    }
+
+    memcpy(apBuffer, aQueue->mItems.front().data(), aQueue->mItemSize);
+    if (aRemove)
+    {
+        aQueue->mItems.pop_front();
+        wLock.unlock();
+        aQueue->mNotFull.notify_one();
+    }
+
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t aQueue, void* apBuffer, TickType_t aTicksToWait)
+{
+    return QueueReceive(aQueue, apBuffer, aTicksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t aQueue, void* apBuffer, TickType_t aTicksToWait)
+{
+    return QueueReceive(aQueue, apBuffer, aTicksToWait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t aQueue)
+{
+    {
+        std::lock_guard<std::mutex> wLock(aQueue->mMutex);
+        aQueue->mItems.clear();
+    }
+    aQueue->mNotFull.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t aQueue)
+{
+    std::lock_guard<std::mutex> wLock(aQueue->mMutex);
+    return aQueue->mItems.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(const QueueHandle_t aQueue)
+{
+    std::lock_guard<std::mutex> wLock(aQueue->mMutex);
+    return aQueue->mLength - aQueue->mItems.size();
+}
+
+
+/******************************************************************************
+    Software timers (single daemon thread like the FreeRTOS timer service)
+ *****************************************************************************/
+
+struct tmrTimerControl
+{
+    std::string             mName;
+    TickType_t              mPeriod;
+    bool                    mAutoReload;
+    void*                   mpTimerId;
+    TimerCallbackFunction_t mCallback;
+
+    bool                    mIsActive = false;
+    TickType_t              mExpiry   = 0;
+};
+
+static std::mutex               mTimerMutex;
+static std::condition_variable  mTimerCondition;
+static std::list<TimerHandle_t> mTimerList;
+static bool                     mIsTimerDaemonStarted = false;
+
+static void TimerDaemon(void)
+{
+    /* The timer service runs as a kernel task too */
+    GetCurrentTask()->mName = "Tmr Svc";
+
+    std::unique_lock<std::mutex> wLock(mTimerMutex);
+
+    for (;;)
+    {
+        /* Find the next expiring timer */
+        TimerHandle_t wpNext = nullptr;
+        for (TimerHandle_t wpTimer : mTimerList)
+        {
+            if (wpTimer->mIsActive &&
+                ((wpNext == nullptr) || (static_cast<int32_t>(wpTimer->mExpiry - wpNext->mExpiry) < 0)))
+            {
+                wpNext = wpTimer;
+            }
+        }
+
+        if (wpNext == nullptr)
+        {
+            mTimerCondition.wait(wLock);
+            continue;
+        }
+
+        int32_t wRemaining = static_cast<int32_t>(wpNext->mExpiry - xTaskGetTickCount());
+        if (wRemaining > 0)
+        {
+            mTimerCondition.wait_for(wLock, std::chrono::milliseconds(wRemaining));
+            continue;
+        }
+
+        /* Timer expired */
+        if (wpNext->mAutoReload)
+        {
+            wpNext->mExpiry += wpNext->mPeriod;
+        }
+        else
+        {
+            wpNext->mIsActive = false;
+        }
+
+        /* Run callback without holding the timer lock */
+        wLock.unlock();
+        wpNext->mCallback(wpNext);
+        wLock.lock();
+    }
+}
+
+TimerHandle_t xTimerCreate(const char* apName, const TickType_t aPeriod, const UBaseType_t aAutoReload,
+        void* const apTimerId, TimerCallbackFunction_t aCallback)
+{
+    TimerHandle_t wpTimer = new tmrTimerControl();
+    wpTimer->mName       = (apName != nullptr) ? apName : "";
+    wpTimer->mPeriod     = (aPeriod > 0) ? aPeriod : 1;
+    wpTimer->mAutoReload = (aAutoReload != pdFALSE);
+    wpTimer->mpTimerId   = apTimerId;
+    wpTimer->mCallback   = aCallback;
+
+    std::lock_guard<std::mutex> wLock(mTimerMutex);
+    mTimerList.push_back(wpTimer);
+
+    if (!mIsTimerDaemonStarted)
+    {
+        mIsTimerDaemonStarted = true;
+        std::thread(TimerDaemon).detach();
+    }
+
+    return wpTimer;
+}
+
+BaseType_t xTimerStart(TimerHandle_t aTimer, TickType_t aTicksToWait)
+{
+    (void) aTicksToWait;
+    {
+        std::lock_guard<std::mutex> wLock(mTimerMutex);
+        aTimer->mIsActive = true;
+        aTimer->mExpiry   = xTaskGetTickCount() + aTimer->mPeriod;
+    }
+    mTimerCondition.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t aTimer, TickType_t aTicksToWait)
+{
+    return xTimerStart(aTimer, aTicksToWait);
+}
+
+BaseType_t xTimerStop(TimerHandle_t aTimer, TickType_t aTicksToWait)
+{
+    (void) aTicksToWait;
+    {
+        std::lock_guard<std::mutex> wLock(mTimerMutex);
+        aTimer->mIsActive = false;
+    }
+    mTimerCondition.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t aTimer, TickType_t aNewPeriod, TickType_t aTicksToWait)
+{
+    {
+        std::lock_guard<std::mutex> wLock(mTimerMutex);
+        aTimer->mPeriod = (aNewPeriod > 0) ? aNewPeriod : 1;
+    }
+    /* Like FreeRTOS, changing the period also starts the timer */
+    return xTimerStart(aTimer, aTicksToWait);
+}
+
+BaseType_t xTimerDelete(TimerHandle_t aTimer, TickType_t aTicksToWait)
+{
+    (void) aTicksToWait;
+    {
+        std::lock_guard<std::mutex> wLock(mTimerMutex);
+        mTimerList.remove(aTimer);
+    }
+    mTimerCondition.notify_all();
+    delete aTimer;
+    return pdPASS;
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t aTimer)
+{
+    std::lock_guard<std::mutex> wLock(mTimerMutex);
+    return aTimer->mIsActive ? pdTRUE : pdFALSE;
+}
+
+void* pvTimerGetTimerID(const TimerHandle_t aTimer)
+{
+    return aTimer->mpTimerId;
+}
@@ -0,0 +1,55 @@
+/*
+ * FreeRTOS.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host (POSIX) replacement of the FreeRTOS kernel API used by the application.
+ * Tasks are mapped to std::thread, task notifications to a condition variable,
+ * critical sections to a recursive mutex and one tick is one millisecond.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t  StackType_t;
+
+#define pdFALSE                     ((BaseType_t) 0)
+#define pdTRUE                      ((BaseType_t) 1)
+#define pdPASS                      (pdTRUE)
+#define pdFAIL                      (pdFALSE)
+
+#define portMAX_DELAY               ((TickType_t) 0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS          ((TickType_t) 1)
+#define configTICK_RATE_HZ          (1000)
+#define configMAX_PRIORITIES        (25)
+#define configMINIMAL_STACK_SIZE    (768)
+#define configSUPPORT_STATIC_ALLOCATION     (1)
+#define configGENERATE_RUN_TIME_STATS       (0)
+#define tskNO_AFFINITY              ((BaseType_t) 0x7FFFFFFF)
+#define portNUM_PROCESSORS          (2)
+
+#define pdMS_TO_TICKS(xTimeInMs)    ((TickType_t) (xTimeInMs))
+
+/** @brief Spinlock replacement: a recursive mutex */
+typedef struct
+{
+    std::recursive_mutex mMutex;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    {}
+
+#define portENTER_CRITICAL(mux)         ((mux)->mMutex.lock())
+#define portEXIT_CRITICAL(mux)          ((mux)->mMutex.unlock())
+#define portENTER_CRITICAL_ISR(mux)     portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)      portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux)         portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux)          portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR(x)           ((void) (x))
+
+#include "freertos/task.h"
@@ -0,0 +1,37 @@
+/*
+ * queue.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+/** @brief Opaque queue of the host kernel */
+struct QueueDefinition;
+typedef QueueDefinition* QueueHandle_t;
+
+/** @brief Placeholder for the statically allocated queue control block */
+typedef struct
+{
+    uint8_t mDummy;
+} StaticQueue_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t aLength, UBaseType_t aItemSize);
+QueueHandle_t xQueueCreateStatic(UBaseType_t aLength, UBaseType_t aItemSize, uint8_t* apStorage, StaticQueue_t* apQueueBuffer);
+void vQueueDelete(QueueHandle_t aQueue);
+
+BaseType_t xQueueSendToBack(QueueHandle_t aQueue, const void* apItem, TickType_t aTicksToWait);
+BaseType_t xQueueSendToFront(QueueHandle_t aQueue, const void* apItem, TickType_t aTicksToWait);
+BaseType_t xQueueReceive(QueueHandle_t aQueue, void* apBuffer, TickType_t aTicksToWait);
+BaseType_t xQueuePeek(QueueHandle_t aQueue, void* apBuffer, TickType_t aTicksToWait);
+BaseType_t xQueueReset(QueueHandle_t aQueue);
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t aQueue);
+UBaseType_t uxQueueSpacesAvailable(const QueueHandle_t aQueue);
+
+#define xQueueSend(queue, item, ticks)      xQueueSendToBack((queue), (item), (ticks))
+#define xQueueSendFromISR(queue, item, woken) \
+                                            (((void) (woken)), xQueueSendToBack((queue), (item), 0))
+#define xQueueReceiveFromISR(queue, buffer, woken) \
+                                            (((void) (woken)), xQueueReceive((queue), (buffer), 0))
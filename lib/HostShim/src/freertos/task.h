@@ -0,0 +1,87 @@
+/*
+ * task.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+/** @brief Opaque task control block of the host scheduler */
+struct tskTaskControlBlock;
+typedef tskTaskControlBlock* TaskHandle_t;
+
+typedef void (*TaskFunction_t)(void*);
+
+/** @brief Placeholder for the statically allocated task control block */
+typedef struct
+{
+    uint8_t mDummy;
+} StaticTask_t;
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+typedef enum
+{
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid
+} eTaskState;
+
+/** @brief Task status as returned by uxTaskGetSystemState() */
+typedef struct
+{
+    TaskHandle_t xHandle;
+    const char*  pcTaskName;
+    UBaseType_t  xTaskNumber;
+    eTaskState   eCurrentState;
+    UBaseType_t  uxCurrentPriority;
+    UBaseType_t  uxBasePriority;
+    uint32_t     ulRunTimeCounter;
+    StackType_t* pxStackBase;
+    uint32_t     usStackHighWaterMark;
+    BaseType_t   xCoreID;
+} TaskStatus_t;
+
+BaseType_t xTaskCreate(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, TaskHandle_t* apCreatedTask);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, TaskHandle_t* apCreatedTask, BaseType_t aCoreId);
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t aFunction, const char* apName, uint32_t aStackDepth,
+        void* apParameters, UBaseType_t aPriority, StackType_t* apStack, StaticTask_t* apTaskBuffer, BaseType_t aCoreId);
+void vTaskDelete(TaskHandle_t aTask);
+
+void vTaskDelay(const TickType_t aTicksToDelay);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char* pcTaskGetName(TaskHandle_t aTask);
+UBaseType_t uxTaskGetNumberOfTasks(void);
+UBaseType_t uxTaskGetSystemState(TaskStatus_t* apTaskStatusArray, const UBaseType_t aArraySize, uint32_t* apTotalRunTime);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t aTask);
+void taskYIELD(void);
+
+BaseType_t xTaskGenericNotify(TaskHandle_t aTask, uint32_t aValue, eNotifyAction aAction, uint32_t* apPreviousValue);
+BaseType_t xTaskNotifyWait(uint32_t aBitsToClearOnEntry, uint32_t aBitsToClearOnExit,
+        uint32_t* apNotificationValue, TickType_t aTicksToWait);
+uint32_t ulTaskNotifyTake(BaseType_t aClearCountOnExit, TickType_t aTicksToWait);
+
+#define xTaskNotify(task, value, action)        xTaskGenericNotify((task), (value), (action), nullptr)
+#define xTaskNotifyGive(task)                   xTaskGenericNotify((task), 0, eIncrement, nullptr)
+#define xTaskNotifyFromISR(task, value, action, woken) \
+                                                (((void) (woken)), xTaskGenericNotify((task), (value), (action), nullptr))
+#define vTaskNotifyGiveFromISR(task, woken)     ((void) (woken), (void) xTaskGenericNotify((task), 0, eIncrement, nullptr))
+
+/** @brief Releases all tasks created so far (called once setup() has returned) */
+void vTaskStartScheduler(void);
@@ -0,0 +1,28 @@
+/*
+ * timers.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+/** @brief Opaque software timer of the host timer daemon */
+struct tmrTimerControl;
+typedef tmrTimerControl* TimerHandle_t;
+
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t aTimer);
+
+TimerHandle_t xTimerCreate(const char* apName, const TickType_t aPeriod, const UBaseType_t aAutoReload,
+        void* const apTimerId, TimerCallbackFunction_t aCallback);
+BaseType_t xTimerStart(TimerHandle_t aTimer, TickType_t aTicksToWait);
+BaseType_t xTimerStop(TimerHandle_t aTimer, TickType_t aTicksToWait);
+BaseType_t xTimerReset(TimerHandle_t aTimer, TickType_t aTicksToWait);
+BaseType_t xTimerChangePeriod(TimerHandle_t aTimer, TickType_t aNewPeriod, TickType_t aTicksToWait);
+BaseType_t xTimerDelete(TimerHandle_t aTimer, TickType_t aTicksToWait);
+BaseType_t xTimerIsTimerActive(TimerHandle_t aTimer);
+void* pvTimerGetTimerID(const TimerHandle_t aTimer);
+
+#define xTimerStartFromISR(timer, woken)    (((void) (woken)), xTimerStart((timer), 0))
+#define xTimerStopFromISR(timer, woken)     (((void) (woken)), xTimerStop((timer), 0))
@@ -6,7 +6,10 @@
  */
 
 #include "Application.h"
-#include "Serialize.h"
+#include "BufferPool.h"
+#include "BusRecorder.h"
+#include "MessagePayload.h"
+#include "TaskSupervisor.h"
 
 namespace ApplicationNS
 {
@@ -40,6 +43,16 @@ void TaskNotification::Notify(void)
     xTaskNotify(mTaskHandle, mNotification, eSetBits);
 }
 
+/**
+ * @brief Notifies the associated task with the given notification bits from a normal (non-ISR) context.
+ *
+ * @param aNotification Notification bits to set instead of the bits of the object.
+ */
+void TaskNotification::Notify(uint32_t aNotification)
+{
+    xTaskNotify(mTaskHandle, aNotification, eSetBits);
+}
+
 /**
  * @brief Notifies the associated task from an ISR context.
  *
@@ -82,8 +95,10 @@ MessageReceiver::~MessageReceiver()
  *
  * @param apMessageQueue Pointer to the message queue to be used.
  * @param apNotification Pointer to the TaskNotification object for task signaling.
+ * @param apCoalescer Optional pointer to the coalescer of the queued messages.
  */
-void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskNotification * apNotification)
+void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskNotification * apNotification,
+        MessageCoalescer* apCoalescer)
 {
     /* Ensure valid parameters */
     assert(apMessageQueue != nullptr);
@@ -92,22 +107,26 @@ void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskNotification * apNo
     /* Store parameters */
     mpMessageQueue = apMessageQueue;
     mpNotification = apNotification;
+    mpCoalescer    = apCoalescer;
 }
 
 /**
  * @brief Initializes the MessageReceiver with a message queue and task notification parameters.
  *
  * @details
- * This overload creates a new TaskNotification object using the provided task handle and
- * notification bits, then delegates initialization to the main Init function.
+ * This overload sets up the TaskNotification object of the receiver using the provided task handle
+ * and notification bits, then delegates initialization to the main Init function.
  *
  * @param apMessageQueue Pointer to the message queue to be used.
  * @param aTaskHandle Handle of the task to be notified.
  * @param aNotificationBitsToSet Notification bits to set when signaling the task.
+ * @param apCoalescer Optional pointer to the coalescer of the queued messages.
  */
-void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet)
+void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet,
+        MessageCoalescer* apCoalescer)
 {
-    Init(apMessageQueue, new TaskNotification(aTaskHandle, aNotificationBitsToSet));
+    mNotification = TaskNotification(aTaskHandle, aNotificationBitsToSet);
+    Init(apMessageQueue, &mNotification, apCoalescer);
 }
 
 /**
@@ -116,118 +135,135 @@ void MessageReceiver::Init(MessageQueue* apMessageQueue, TaskHandle_t aTaskHandl
  * @details
  * This function adds the provided message to the message queue and then sends a notification
  * to the associated task using the TaskNotification object. This mechanism is used to signal
- * the task that a new message is available for processing.
+ * the task that a new message is available for processing. If the queue is full, the message
+ * is dropped and the buffer reference it holds is released. If a coalescer is set, a message
+ * merged into a pending one with the same ID is not queued.
  *
  * @param arMessage The message to be added to the queue.
  */
 void MessageReceiver::NotifyMessage(const MessageNS::Message & arMessage)
 {
-    mpMessageQueue->add(arMessage, 0);
-    mpNotification->Notify();
+    bool wNotify;
+
+    if ((mpCoalescer != nullptr) && (mpCoalescer->Coalesce(arMessage) == false))
+    {
+        /* Message merged into a pending one */
+        return;
+    }
+
+    if (mpMessageQueue->Add(arMessage, wNotify) == false)
+    {
+        MessageNS::Message wDropped = arMessage;
+
+        if (mpCoalescer != nullptr)
+        {
+            /* Drop the latest message merged meanwhile, it holds the only buffer reference */
+            mpCoalescer->Cancel(wDropped);
+        }
+
+        LOG_WITH_REF(LOG_WARN, LOG_LEVEL_APPLICATION_NS,
+                "MessageReceiver::NotifyMessage() Queue full, message %d from %s dropped",
+                static_cast<int>(wDropped.mId), MessageNS::AddressToString(wDropped.mSource));
+
+        /* Message dropped, release its buffer */
+        BufferPool.Release(BufferPoolNS::GetBuffer(wDropped));
+        return;
+    }
+
+    if (wNotify)
+    {
+        mpNotification->Notify();
+    }
 }
 
 
 /**
+ * @brief Signals a fast event to the associated task.
  *
- * Implementation of the ApplicationNS::TastTimes class
+ * @details
+ * Only the notification bit of the event is set, the message queue is not used.
  *
+ * @param aEvent The fast event to signal.
  */
-TaskTimer::TaskTimer(uint32_t aTimerId, TickType_t aPeriod, bool aReload)
-    : FreeRTOScpp::TimerClass(nullptr, aPeriod, aReload)
+void MessageReceiver::NotifyFastEvent(MessageNS::tFastEvent aEvent)
 {
-    mTimerId = aTimerId;
+    mpNotification->Notify(FastEventNotification(aEvent));
 }
 
-TaskTimer::~TaskTimer()
-{
-    /* Clear object pointers */
-    delete mpTaskNotification;
-    mpTaskNotification = nullptr;
-    mpTaskTimerObjects = nullptr;
-}
 
 /**
- * @brief Initializes the TaskTimer with the provided timer objects.
  *
- * @details
- * This function sets up the TaskTimer by storing the provided timer objects pointer and
- * creating a TaskNotification object for signaling the associated task. All required pointers
- * in the timer objects structure must be valid and non-null.
+ * Implementation of the ApplicationNS::Task class
  *
- * @param apTaskTimerObjects Pointer to the structure containing task handle and message queue.
  */
-void TaskTimer::Init(tTaskTimerObjects* apTaskTimerObjects)
+Task::Task(char const* apName, tTaskPriority aPriority, const uint32_t aStackSize)
+    : mpName(apName), mPriority(aPriority), mStackSize(aStackSize)
 {
-    /* Ensure valid parameters */
-    assert(apTaskTimerObjects != nullptr);
-    assert(apTaskTimerObjects->mTaskHandle != nullptr);
-    assert(apTaskTimerObjects->mpTaskMessagesQueue != nullptr);
-
-    /* Store task timer objects */
-    mpTaskTimerObjects = apTaskTimerObjects;
+    // do nothing
+}
 
-    /* Create task notification object */
-    mpTaskNotification = new TaskNotification(
-            mpTaskTimerObjects->mTaskHandle, mTaskNotificationMsgQueue);
+Task::~Task()
+{
+    if (mTaskHandle != nullptr)
+    {
+        vTaskDelete(mTaskHandle);
+    }
 }
 
 /**
- * @brief Timer callback function for TaskTimer.
+ * @brief Creates the FreeRTOS task in statically allocated memory.
  *
  * @details
- * This function is called when the timer expires. It creates a timeout message, serializes
- * the timer ID into the message payload, adds the message to the task's message queue, and
- * notifies the associated task. If serialization fails, error handling should be implemented.
+ * The task waits for the start trigger (mTaskNotificationStart) before it runs task(), so it
+ * can be initialized with Init() after it was created.
+ *
+ * @param apStack Stack of the task, at least the stack size passed to the constructor.
+ * @param apTaskBuffer Control block of the task.
+ * @param aCore Core the task is pinned to, tskNO_AFFINITY to run on any core.
+ * @return true if the task was created, false otherwise.
  */
-void TaskTimer::timer(void)
+bool Task::Create(StackType_t* apStack, StaticTask_t* apTaskBuffer, BaseType_t aCore)
 {
-    if (mpTaskTimerObjects)
-    {
-        /* Create message for task */
-        MessageNS::Message wMessage;
-        wMessage.mSource      = MessageNS::tAddress::TASK_TIMER;
-        wMessage.mDestination = MessageNS::tAddress::TASK;
+    assert(mTaskHandle == nullptr);
 
-        wMessage.mId   = MessageNS::tMessageId::MSG_EVENT_SW_TIMER_TIMEOUT;
-
-        /* Serialize timer id into message payload */
-        if (SerializeNS::SerializeData(mTimerId, wMessage.mPayload) == sizeof(mTimerId))
-        {
-            /* Set payload length */
-            wMessage.mPayloadLength = sizeof(mTimerId);
+    mTaskHandle = xTaskCreateStaticPinnedToCore(&Task::TaskFunction, mpName, mStackSize, this,
+            mPriority, apStack, apTaskBuffer, aCore);
 
-            /* Add message to the task queue */
-            mpTaskTimerObjects->mpTaskMessagesQueue->add(wMessage);
-
-            /* Notify task */
-            mpTaskNotification->Notify();
-        }
-        else
-        {
-            //TODO handle serialization error
-        }
-
-    }
+    return mTaskHandle != nullptr;
 }
 
-
 /**
+ * @brief Entry function of the FreeRTOS task, waits for the start trigger and runs task().
  *
- * Implementation of the ApplicationNS::Task class
- *
+ * @param apParameter The Task object.
  */
-Task::Task(char const* apName, tTaskPriority aPriority, const uint32_t aStackSize)
-    : FreeRTOScpp::TaskClassS<0>(apName, aPriority, aStackSize)
+void Task::TaskFunction(void* apParameter)
 {
-    // do nothing
+    Task*    wpTask = static_cast<Task*>(apParameter);
+    uint32_t wNotificationValue = 0;
+
+    /* Wait for start trigger, other notification bits set meanwhile stay pending */
+    while ((wNotificationValue & mTaskNotificationStart) == 0)
+    {
+        xTaskNotifyWait(0, mTaskNotificationStart, &wNotificationValue, portMAX_DELAY);
+    }
+
+    if ((wNotificationValue & ~mTaskNotificationStart) != 0)
+    {
+        /* Mark the pending bits as received, so the first wait of task() returns them */
+        xTaskNotify(wpTask->getTaskHandle(), 0, eNoAction);
+    }
+
+    wpTask->task();
 }
 
 /**
  * @brief Initializes the Task with the provided task objects structure.
  *
  * @details
- * This function sets up the Task by storing the provided task objects pointer.
- * It asserts that all required pointers in the structure are valid and non-null.
+ * This function sets up the Task by storing the provided task objects pointer and registers
+ * the task at the timer service. It asserts that all required pointers in the structure are
+ * valid and non-null.
  *
  * @param apTaskObjects Pointer to the structure containing message queue and communication manager.
  */
@@ -240,6 +276,19 @@ void Task::Init(tTaskObjects* apTaskObjects)
 
     /* Store task objects pointer */
     mpTaskObjects = apTaskObjects;
+
+    /* Register the task at the timer service */
+    mTimerClient = TimerService.RegisterClient(getTaskHandle(), mTaskNotificationTimer);
+
+#if (USE_HANDLER_PROFILER == true)
+    /* Register the task at the handler profiler */
+    mProfilerTask = HandlerProfiler.RegisterTask(getTaskHandle());
+#endif /* (USE_HANDLER_PROFILER == true) */
+
+#if (USE_TASK_SUPERVISOR == true)
+    /* Register the task at the task supervisor */
+    mSupervisedTask = TaskSupervisor.RegisterTask(pcTaskGetName(getTaskHandle()), mpTaskObjects->mpMessageQueue);
+#endif /* (USE_TASK_SUPERVISOR == true) */
 }
 
 /**
@@ -247,54 +296,173 @@ void Task::Init(tTaskObjects* apTaskObjects)
  *
  * @details
  * This function implements the main execution loop for the task. It waits for notifications,
- * processes messages from the queue, distinguishes between timer and regular messages,
- * and handles unknown notifications. The loop runs indefinitely.
+ * processes fast events, messages from the queue and expired timers, and handles unknown notifications.
+ * The loop runs indefinitely.
+ *
+ * Messages are taken lane by lane, highest priority first, as one batch of up to the batch budget
+ * per wake-up. Responses to pending requests are completed first, the other messages of the batch
+ * are passed to ProcessMessageBatch(). If messages are left when the budget is used up, the task
+ * notifies itself and yields.
+ *
+ * While requests are pending, the wait for notifications is bounded by the next request
+ * timeout, so expired requests are completed without any timer.
  */
 void Task::task(void)
 {
     uint32_t wNotificationValue;
-    MessageNS::Message wMessage;
+    MessageNS::Message wBatch[mMaxMessageBatchBudget];
+
+    /* Budget is limited by the batch buffer */
+    const uint8_t wBudget = (mpTaskObjects->mMessageBatchBudget < mMaxMessageBatchBudget) ?
+            mpTaskObjects->mMessageBatchBudget : mMaxMessageBatchBudget;
 
     /* Task execution code */
     for (;;)
     {
-        /* Wait to be notified */
-        if (wait(0, 0xFFFFFFFF, &wNotificationValue) == pdPASS)
+        /* Complete expired requests and wait to be notified, at most until the next request expires */
+        if (xTaskNotifyWait(0, 0xFFFFFFFF, &wNotificationValue, mRpcClient.ProcessTimeouts()) == pdPASS)
         {
+            if ((wNotificationValue & mTaskNotificationFastEvents) != 0)
+            {
+                uint32_t wFastEvents = wNotificationValue & mTaskNotificationFastEvents;
+
+                /* Clear notification bits */
+                wNotificationValue &= ~mTaskNotificationFastEvents;
+
+                /* Process fast events ahead of the queued messages, lowest event first */
+                while (wFastEvents != 0)
+                {
+                    MessageNS::tFastEvent wEvent = static_cast<MessageNS::tFastEvent>(
+                            __builtin_ctz(wFastEvents) - mTaskNotificationFastEventShift);
+                    wFastEvents &= (wFastEvents - 1);
+
+                    TASK_SUPERVISOR_ENTER(mSupervisedTask, HandlerProfilerNS::mHandlerFastEvent);
+                    HANDLER_PROFILE_START(wStartUs);
+                    ProcessFastEvent(wEvent);
+                    HANDLER_PROFILE_STOP(mProfilerTask, HandlerProfilerNS::mHandlerFastEvent, wStartUs);
+                    TASK_SUPERVISOR_LEAVE(mSupervisedTask);
+                }
+            }
+
             if ((wNotificationValue & mTaskNotificationMsgQueue) != 0)
             {
                 /* Clear notification bit */
                 wNotificationValue &= ~mTaskNotificationMsgQueue;
 
-                /* Process all messages in the queue */
-                while (mpTaskObjects->mpMessageQueue->pop(wMessage, 0))
+                /* Take a batch of messages */
+                uint8_t wCount    = mpTaskObjects->mpMessageQueue->PopBatch(wBatch, wBudget);
+                uint8_t wIncoming = 0;
+
+                for (uint8_t wI = 0; wI < wCount; wI++)
                 {
-                    /* Check if message is from timer */
-                    if ((wMessage.mSource == MessageNS::tAddress::TASK_TIMER) &&
-                        (wMessage.mDestination == MessageNS::tAddress::TASK))
+                    /* Take the latest version of a coalesced message */
+                    if (mpTaskObjects->mpMessageCoalescer != nullptr)
+                    {
+                        mpTaskObjects->mpMessageCoalescer->Resolve(wBatch[wI]);
+                    }
+
+                    BUS_RECORD(BusRecorderNS::RECORD_DISPATCH, wBatch[wI]);
+
+                    /* Keep incoming messages in the batch, unless they complete a pending request */
+                    if (mRpcClient.HandleResponse(wBatch[wI]) == false)
                     {
-                        ProcessIncomingTimerMessage(wMessage);
+                        wBatch[wIncoming++] = wBatch[wI];
                     }
                     else
                     {
-                        /* Process incoming message */
-                        ProcessIncomingMessage(wMessage);
+                        /* Release the buffer reference held by the response */
+                        BufferPool.Release(BufferPoolNS::GetBuffer(wBatch[wI]));
                     }
+                }
+
+                if (wIncoming > 0)
+                {
+                    /* Process incoming messages */
+                    TASK_SUPERVISOR_ENTER(mSupervisedTask, wBatch[0].mId);
+                    ProcessMessageBatch(wBatch, wIncoming);
+                    TASK_SUPERVISOR_LEAVE(mSupervisedTask);
+
+                    /* Release the buffer references held by the messages */
+                    for (uint8_t wI = 0; wI < wIncoming; wI++)
+                    {
+                        BufferPool.Release(BufferPoolNS::GetBuffer(wBatch[wI]));
+                    }
+                }
+
+                if ((wCount == wBudget) && (mpTaskObjects->mpMessageQueue->Empty() == false))
+                {
+                    /* Budget used up, continue with the next batch after other tasks ran */
+                    xTaskNotify(mTaskHandle, mTaskNotificationMsgQueue, eSetBits);
+                    taskYIELD();
+                }
+            }
+
+            if ((wNotificationValue & mTaskNotificationTimer) != 0)
+            {
+                /* Clear notification bit */
+                wNotificationValue &= ~mTaskNotificationTimer;
 
-                    /* Allow other tasks to run */
-                    yield();
+                /* Process expired timers */
+                uint32_t wTimerId;
+                while (TimerService.PopExpired(mTimerClient, wTimerId))
+                {
+                    TASK_SUPERVISOR_ENTER(mSupervisedTask, HandlerProfilerNS::mHandlerTimer);
+                    HANDLER_PROFILE_START(wStartUs);
+                    if ((wTimerId & mCoroutineTimerIdFlag) != 0)
+                    {
+                        /* Resume the waiting coroutine */
+                        uint32_t wIndex = wTimerId & ~mCoroutineTimerIdFlag;
+                        if ((wIndex < mMaxTaskCoroutines) && (mCoroutines[wIndex] != nullptr))
+                        {
+                            ResumeCoroutine(*mCoroutines[wIndex]);
+                        }
+                    }
+                    else
+                    {
+                        ProcessTimerEvent(wTimerId);
+                    }
+                    HANDLER_PROFILE_STOP(mProfilerTask, HandlerProfilerNS::mHandlerTimer, wStartUs);
+                    TASK_SUPERVISOR_LEAVE(mSupervisedTask);
                 }
             }
 
             /* Process any other notifications */
             if (wNotificationValue != 0)
             {
+                TASK_SUPERVISOR_ENTER(mSupervisedTask, HandlerProfilerNS::mHandlerNotification);
+                HANDLER_PROFILE_START(wStartUs);
                 ProcessUnknownNotification(wNotificationValue);
+                HANDLER_PROFILE_STOP(mProfilerTask, HandlerProfilerNS::mHandlerNotification, wStartUs);
+                TASK_SUPERVISOR_LEAVE(mSupervisedTask);
             }
         }
     }
 }
 
+/**
+ * @brief Processes a batch of incoming messages.
+ *
+ * @details
+ * The messages are in the order they were taken from the queue, highest lane first. The default
+ * implementation passes each message to ProcessIncomingMessage(). Derived classes can override
+ * this function to deduplicate or merge the messages of a batch, the message buffers are valid
+ * until the function returns.
+ *
+ * @param apMessages The incoming messages.
+ * @param aCount Number of messages, at least one.
+ */
+void Task::ProcessMessageBatch(const MessageNS::Message* apMessages, uint8_t aCount)
+{
+    for (uint8_t wI = 0; wI < aCount; wI++)
+    {
+        /* Report each message to the task supervisor, the batch is left by the task loop */
+        TASK_SUPERVISOR_ENTER(mSupervisedTask, apMessages[wI].mId);
+        HANDLER_PROFILE_START(wStartUs);
+        ProcessIncomingMessage(apMessages[wI]);
+        HANDLER_PROFILE_STOP(mProfilerTask, apMessages[wI].mId, wStartUs);
+    }
+}
+
 /**
  * @brief Processes an incoming message.
  *
@@ -315,42 +483,6 @@ void Task::ProcessIncomingMessage(const MessageNS::Message &arMessage)
     // to be implemented by derived class
 }
 
-/**
- * @brief Processes an incoming timer message.
- *
- * @details
- * This function handles messages from the timer. It deserializes the timer ID from the
- * message payload and calls ProcessTimerEvent. If deserialization fails, it logs an error.
- *
- * @param arMessage The timer message to process.
- */
-void Task::ProcessIncomingTimerMessage(const MessageNS::Message &arMessage)
-{
-    if (arMessage.mId == MessageNS::tMessageId::MSG_EVENT_SW_TIMER_TIMEOUT)
-    {
-        /* Retrieve timer ID from message payload */
-        uint32_t wTimerId;
-        if (SerializeNS::DeserializeData(arMessage.mPayload, &wTimerId) == sizeof(wTimerId))
-        {
-            ProcessTimerEvent(wTimerId);
-        }
-        else
-        {
-            //TODO handle serialization error
-            LOG_WITH_REF(LOG_ERROR, LOG_LEVEL_APPLICATION_NS,
-                    "%s::task() Error deserializing timer ID from message payload",
-                    pcTaskGetName(NULL));
-        }
-    }
-    else
-    {
-        //TODO handle unknown timer message ID
-        LOG_WITH_REF(LOG_ERROR, LOG_LEVEL_APPLICATION_NS,
-                "%s::task() Unknown timer message ID %d",
-                pcTaskGetName(NULL), static_cast<int>(arMessage.mId));
-    }
-}
-
 /**
  * @brief Processes a timer event.
  *
@@ -371,6 +503,26 @@ void Task::ProcessTimerEvent(const uint32_t aTimerId)
     // to be implemented by derived class
 }
 
+/**
+ * @brief Processes a fast event.
+ *
+ * @details
+ * This function is called for each signalled fast event the task subscribed to, before the
+ * queued messages are processed. Derived classes should override this function to provide
+ * specific fast event handling logic.
+ *
+ * @param aEvent The signalled fast event.
+ */
+void Task::ProcessFastEvent(MessageNS::tFastEvent aEvent)
+{
+#if (LOG_LEVEL_APPLI_NS == LOG_VERBOSE)
+    LOG_WITH_REF(LOG_VERBOSE, LOG_LEVEL_APPLICATION_NS,
+            "%s::ProcessFastEvent() Fast event %d",
+            pcTaskGetName(NULL), aEvent);
+#endif
+    // to be implemented by derived class
+}
+
 /**
  * @brief Processes unknown notification values.
  *
@@ -407,4 +559,193 @@ void Task::SendMessage(const MessageNS::Message &arMessage)
     }
 }
 
+/**
+ * @brief Publishes a message to all subscribers via the communication manager.
+ *
+ * @details
+ * The destination of the message is ignored, the communication manager delivers the
+ * message to all modules subscribed to the message ID.
+ *
+ * @param arMessage The message to publish.
+ */
+void Task::PublishMessage(const MessageNS::Message &arMessage)
+{
+    if (mpTaskObjects && mpTaskObjects->mpCommunicationManager)
+    {
+        mpTaskObjects->mpCommunicationManager->PublishMessage(arMessage);
+    }
+}
+
+/**
+ * @brief Publishes a fast event to all subscribers via the communication manager.
+ *
+ * @details
+ * The subscribers are signalled through their task notification, see ProcessFastEvent().
+ * May be called from any task, e.g. from callbacks of libraries running in their own task.
+ *
+ * @param aEvent The fast event to publish.
+ */
+void Task::PublishFastEvent(MessageNS::tFastEvent aEvent)
+{
+    if (mpTaskObjects && mpTaskObjects->mpCommunicationManager)
+    {
+        mpTaskObjects->mpCommunicationManager->PublishFastEvent(aEvent);
+    }
+}
+
+/**
+ * @brief Sends a request to another task.
+ *
+ * @details
+ * The response is sent back to the source address of the request. The callback is called in
+ * the context of this task, either with the response or on timeout.
+ *
+ * Usage: Request(MakeMessage<tMessageId::REQ_WIFI_STATUS>(wOwnAddress, tAddress::WIFI_MANAGER),
+ *                ResponseId<tMessageId::REQ_WIFI_STATUS>, pdMS_TO_TICKS(500), wCallback)
+ *
+ * @param arRequest The request message, the source must be the address of this task.
+ * @param aResponseId Message ID of the expected response.
+ * @param aTimeout Timeout in ticks.
+ * @param aCallback Completion callback.
+ * @return Handle of the pending request, mInvalidRpcHandle if the request was not sent.
+ */
+tRpcHandle Task::Request(const MessageNS::Message &arRequest, MessageNS::tMessageId aResponseId,
+        TickType_t aTimeout, tRpcCallback aCallback)
+{
+    if (mpTaskObjects == nullptr)
+    {
+        return mInvalidRpcHandle;
+    }
+
+    return mRpcClient.Request(mpTaskObjects->mpCommunicationManager, arRequest, aResponseId, aTimeout, aCallback);
+}
+
+/**
+ * @brief Cancels a pending request, its callback is not called.
+ *
+ * @param aHandle Handle returned by Request().
+ * @return true if the request was pending, false otherwise.
+ */
+bool Task::CancelRequest(tRpcHandle aHandle)
+{
+    return mRpcClient.Cancel(aHandle);
+}
+
+/**
+ * @brief Starts a timer of the task on the timer service.
+ *
+ * @param aTimerId ID passed to ProcessTimerEvent() on expiration.
+ * @param aPeriodMs Period or delay in milliseconds.
+ * @param aPeriodic true for a periodic timer, false for a one-shot timer.
+ * @return Handle of the timer, TimerServiceNS::mInvalidTimerHandle if no timer is available.
+ */
+TimerServiceNS::tTimerHandle Task::StartTimer(uint32_t aTimerId, uint32_t aPeriodMs, bool aPeriodic)
+{
+    return aPeriodic ? TimerService.StartPeriodic(mTimerClient, aTimerId, aPeriodMs) :
+                       TimerService.StartOneShot(mTimerClient, aTimerId, aPeriodMs);
+}
+
+/**
+ * @brief Starts a one-shot timer of the task expiring at a point in time.
+ *
+ * @param aTimerId ID passed to ProcessTimerEvent() on expiration.
+ * @param aDeadlineMs Expiration time as millis() value.
+ * @return Handle of the timer, TimerServiceNS::mInvalidTimerHandle if no timer is available.
+ */
+TimerServiceNS::tTimerHandle Task::StartTimerAt(uint32_t aTimerId, uint32_t aDeadlineMs)
+{
+    return TimerService.StartAt(mTimerClient, aTimerId, aDeadlineMs);
+}
+
+/**
+ * @brief Stops a timer of the task, a pending expiration is not passed to ProcessTimerEvent().
+ *
+ * @param aHandle Handle returned by StartTimer() or StartTimerAt().
+ * @return true if the timer was stopped, false if it already expired or the handle is invalid.
+ */
+bool Task::StopTimer(TimerServiceNS::tTimerHandle aHandle)
+{
+    return TimerService.Stop(aHandle);
+}
+
+/**
+ * @brief Starts a coroutine of the task, a running coroutine is started again from the beginning.
+ *
+ * @details
+ * The body runs until its first wait within this call, the rest of the body is resumed by
+ * the task loop.
+ *
+ * @param arCoroutine Coroutine to start, a member of the task.
+ * @return true if the coroutine was started, false if the task has no free coroutine slot.
+ */
+bool Task::StartCoroutine(Coroutine& arCoroutine)
+{
+    if (arCoroutine.mIndex == Coroutine::mNotRegistered)
+    {
+        /* Register the coroutine in a free slot */
+        for (uint8_t wI = 0; wI < mMaxTaskCoroutines; wI++)
+        {
+            if (mCoroutines[wI] == nullptr)
+            {
+                mCoroutines[wI]    = &arCoroutine;
+                arCoroutine.mIndex = wI;
+                break;
+            }
+        }
+
+        if (arCoroutine.mIndex == Coroutine::mNotRegistered)
+        {
+            LOG_WITH_REF(LOG_ERROR, LOG_LEVEL_APPLICATION_NS,
+                    "%s::StartCoroutine() No free coroutine slot", mpName);
+            return false;
+        }
+    }
+
+    /* Cancel a pending resume and run the body from the beginning */
+    StopCoroutine(arCoroutine);
+    arCoroutine.mResumePoint = 0;
+    ResumeCoroutine(arCoroutine);
+
+    return true;
+}
+
+/**
+ * @brief Stops a coroutine of the task, a waiting body is not resumed anymore.
+ *
+ * @param arCoroutine Coroutine to stop.
+ */
+void Task::StopCoroutine(Coroutine& arCoroutine)
+{
+    StopTimer(arCoroutine.mTimer);
+    arCoroutine.mTimer       = TimerServiceNS::mInvalidTimerHandle;
+    arCoroutine.mResumePoint = Coroutine::mNotRunning;
+}
+
+/**
+ * @brief Runs the body of a coroutine until its next wait and arms the timer resuming it.
+ *
+ * @param arCoroutine Coroutine to resume.
+ */
+void Task::ResumeCoroutine(Coroutine& arCoroutine)
+{
+    arCoroutine.mTimer = TimerServiceNS::mInvalidTimerHandle;
+
+    if (arCoroutine.IsRunning())
+    {
+        arCoroutine.mBody(arCoroutine);
+    }
+
+    if (arCoroutine.IsRunning())
+    {
+        /* Body waits, resume it after the delay */
+        arCoroutine.mTimer = StartTimer(mCoroutineTimerIdFlag | arCoroutine.mIndex, arCoroutine.mResumeDelayMs, false);
+        if (arCoroutine.mTimer == TimerServiceNS::mInvalidTimerHandle)
+        {
+            LOG_WITH_REF(LOG_ERROR, LOG_LEVEL_APPLICATION_NS,
+                    "%s::ResumeCoroutine() No timer available, coroutine stopped", mpName);
+            arCoroutine.mResumePoint = Coroutine::mNotRunning;
+        }
+    }
+}
+
 };  /* end of namespace ApplicationNS */
\ No newline at end of file
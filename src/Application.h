@@ -17,6 +17,13 @@
 
 #include "Message.h"
 #include "Communication.h"
+#include "Coroutine.h"
+#include "HandlerProfiler.h"
+#include "MessageCoalescer.h"
+#include "MessageQueue.h"
+#include "RpcClient.h"
+#include "TaskSupervisor.h"
+#include "TimerService.h"
 
 
 /* Log level for this module */
@@ -48,19 +55,72 @@ namespace ApplicationNS
     static constexpr uint32_t mTaskNotificationMsgQueue = 0x01; //binary: 00000000 00000000 00000000 00000001
 
     /**
-     * @brief Definition of the message queue for application tasks.
+     * @brief Notification bitmask for expired timers of the task.
      *
      * @details
-     * The message queue is used for inter-task communication, allowing tasks to exchange
-     * MessageNS::Message objects. The queue size is defined by mMessageQueueSize, which
-     * specifies the maximum number of messages that can be stored in the queue at any time.
-     * MessageQueueBase provides the base type for the queue, while MessageQueue is a
-     * type alias for a statically sized queue of MessageNS::Message objects.
+     * Set by the TimerServiceNS::TimerService when timers of the task expired, the task then takes
+     * the expired timer IDs from the timer service and passes them to ProcessTimerEvent().
      */
-    static constexpr uint8_t mMessageQueueSize = 10;
+    static constexpr uint32_t mTaskNotificationTimer = 0x02;    //binary: 00000000 00000000 00000000 00000010
 
-    using MessageQueueBase = FreeRTOScpp::QueueTypeBase<MessageNS::Message>;
-    using MessageQueue     = FreeRTOScpp::Queue<MessageNS::Message, mMessageQueueSize>;
+    /**
+     * @brief Notification bitmask of the start trigger.
+     *
+     * @details
+     * Set once by TaskGraph::Start() after all tasks are initialized. The task waits for this bit
+     * only, so message and timer notifications arriving during the initialization stay pending
+     * and are processed by the first pass of the task loop.
+     */
+    static constexpr uint32_t mTaskNotificationStart = 0x80000000; //binary: 10000000 00000000 00000000 00000000
+
+    /**
+     * @brief First notification bit of the fast events.
+     *
+     * @details
+     * Fast event N sets the notification bit (mTaskNotificationFastEventShift + N). The bits below
+     * are used for the message queue and the timers, the highest bit for the start trigger, so up
+     * to 29 fast events are available.
+     */
+    static constexpr uint8_t mTaskNotificationFastEventShift = 2;
+
+    static_assert(MessageNS::tFastEvent::NB_OF_FAST_EVENTS <= (31 - mTaskNotificationFastEventShift),
+            "Not enough task notification bits for all fast events");
+
+    /** @brief Notification bitmask of all fast events */
+    static constexpr uint32_t mTaskNotificationFastEvents =
+            ((static_cast<uint32_t>(1) << MessageNS::tFastEvent::NB_OF_FAST_EVENTS) - 1) << mTaskNotificationFastEventShift;
+
+    /**
+     * @brief Returns the notification bit of a fast event.
+     */
+    constexpr uint32_t FastEventNotification(MessageNS::tFastEvent aEvent)
+    {
+        return static_cast<uint32_t>(1) << (aEvent + mTaskNotificationFastEventShift);
+    }
+
+    /** @brief Maximal number of coroutines of a task */
+    static constexpr uint8_t mMaxTaskCoroutines = 2;
+
+    /**
+     * @brief Timer ID flag of the timers resuming coroutines.
+     *
+     * @details
+     * Timer IDs with this bit set are reserved for the coroutines of the task, the lower bits
+     * are the index of the coroutine. These timers are not passed to ProcessTimerEvent().
+     */
+    static constexpr uint32_t mCoroutineTimerIdFlag = 0x80000000;
+
+    /**
+     * @brief Default number of messages a task processes per wake-up.
+     *
+     * @details
+     * When the budget is used up and messages are left, the task notifies itself and yields,
+     * so tasks with the same priority get the CPU between two batches.
+     */
+    static constexpr uint8_t mDefaultMessageBatchBudget = 4;
+
+    /** @brief Maximal number of messages a task processes per wake-up, size of the batch buffer */
+    static constexpr uint8_t mMaxMessageBatchBudget = 8;
 
 
     /**
@@ -75,10 +135,11 @@ namespace ApplicationNS
     class TaskNotification
     {
     public:
-        TaskNotification(TaskHandle_t aTaskHandle, uint32_t aNotification);
+        TaskNotification(TaskHandle_t aTaskHandle = nullptr, uint32_t aNotification = 0);
         virtual ~TaskNotification();
 
         void Notify(void);
+        void Notify(uint32_t aNotification);
         void NotifyFromISR(BaseType_t* apHigherPriorityTaskWoken);
 
     private:
@@ -95,7 +156,8 @@ namespace ApplicationNS
      * It provides initialization methods to set up the message queue and notification mechanism, either
      * by passing an existing TaskNotification object or by creating one from a task handle and notification bits.
      * The NotifyMessage method adds a message to the queue and notifies the associated task, enabling
-     * efficient inter-task communication and event-driven processing.
+     * efficient inter-task communication and event-driven processing. The NotifyFastEvent method only
+     * sets the notification bit of the fast event, without touching the queue.
      */
     class MessageReceiver : public CommunicationNS::NotificationCallback
     {
@@ -103,58 +165,20 @@ namespace ApplicationNS
         MessageReceiver();
         virtual ~MessageReceiver();
 
-        void Init(MessageQueue* apMessageQueue, TaskNotification * apNotification);
-        void Init(MessageQueue* apMessageQueue, TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet);
+        void Init(MessageQueue* apMessageQueue, TaskNotification * apNotification,
+                MessageCoalescer* apCoalescer = nullptr);
+        void Init(MessageQueue* apMessageQueue, TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet,
+                MessageCoalescer* apCoalescer = nullptr);
         void NotifyMessage(const MessageNS::Message & arMessage);
+        void NotifyFastEvent(MessageNS::tFastEvent aEvent);
 
     private:
         MessageQueue*     mpMessageQueue = nullptr;
         TaskNotification* mpNotification = nullptr;
-    };
-
-
-    /**
-     * @brief Structure containing objects required for task timer initialization.
-     *
-     * @details
-     * The tTaskTimerObjects structure holds references to the task handle and the message queue
-     * used by a timer-driven task. It is used to initialize timer-related functionality, ensuring
-     * that the timer can signal the correct task and deliver messages to the appropriate queue.
-     */
-    struct tTaskTimerObjects
-    {
-        /** @brief Task handle */
-        TaskHandle_t mTaskHandle;
-
-        /** @brief Task messages queue */
-        MessageQueueBase* mpTaskMessagesQueue;
-    };
-
-    /**
-     * @brief TaskTimer class for managing timer-driven task signaling.
-     *
-     * @details
-     * The TaskTimer class extends FreeRTOScpp::TimerClass to provide timer functionality for tasks.
-     * It stores a timer identifier, manages references to the associated task and its message queue,
-     * and uses a TaskNotification object to signal the task when the timer expires. The timer callback
-     * method creates and sends timeout messages to the task, enabling event-driven processing based on timer events.
-     */
-    class TaskTimer : public FreeRTOScpp::TimerClass
-    {
-    public:
-        TaskTimer(uint32_t aTimerId, TickType_t aPeriod, bool aReload);
-        virtual ~TaskTimer();
-
-        void Init(tTaskTimerObjects* apTaskTimerObjects);
-
-    private:
-        /** @brief Timer identifier */
-        uint32_t mTimerId;
-
-        tTaskTimerObjects* mpTaskTimerObjects = nullptr;
-        TaskNotification*  mpTaskNotification = nullptr;
+        MessageCoalescer* mpCoalescer    = nullptr;
 
-        void timer(void) override;
+        /** @brief Notification of the task, used if created from a task handle */
+        TaskNotification  mNotification;
     };
 
 
@@ -171,7 +195,46 @@ namespace ApplicationNS
         /** @brief Communication manager */
         CommunicationNS::CommunicationManager* mpCommunicationManager;
         /** @brief Queue for incoming internal messages */
-        MessageQueueBase* mpMessageQueue;
+        MessageQueue* mpMessageQueue;
+        /** @brief Coalescer of the queued messages (optional, shared with the message receiver) */
+        MessageCoalescer* mpMessageCoalescer = nullptr;
+        /** @brief Maximal number of messages processed per wake-up */
+        uint8_t mMessageBatchBudget = mDefaultMessageBatchBudget;
+    };
+
+
+    /**
+     * @brief Compile-time configuration of an application task.
+     *
+     * @details
+     * The configurations are declared constexpr in ConfigNS and passed as template arguments to
+     * ApplicationNS::StaticTask, which allocates the task, its stack and its message objects statically.
+     * Each lane of the message queue holds mMessageLaneSize messages.
+     */
+    struct tTaskConfig
+    {
+        /** @brief Name of the task */
+        const char*                  mpName;
+        /** @brief Address of the task on the message bus */
+        MessageNS::tAddress          mAddress;
+        /** @brief Priority of the task */
+        tTaskPriority                mPriority;
+        /** @brief Stack size in StackType_t units (bytes on the ESP32) */
+        uint32_t                     mStackSize;
+        /** @brief Core the task is pinned to, tskNO_AFFINITY for any core */
+        BaseType_t                   mCore;
+        /** @brief Maximal number of messages processed per wake-up */
+        uint8_t                      mMessageBatchBudget;
+        /** @brief Number of messages per lane of the message queue */
+        uint8_t                      mMessageLaneSize;
+        /** @brief Published messages the task subscribes to */
+        const MessageNS::tMessageId* mpSubscriptions;
+        /** @brief Number of subscriptions */
+        uint8_t                      mSubscriptionCount;
+        /** @brief Fast events the task subscribes to */
+        const MessageNS::tFastEvent* mpFastEventSubscriptions;
+        /** @brief Number of fast event subscriptions */
+        uint8_t                      mFastEventSubscriptionCount;
     };
 
 
@@ -179,28 +242,95 @@ namespace ApplicationNS
      * @brief Base class for application tasks.
      *
      * @details
-     * The Task class extends FreeRTOScpp::TaskClassS<0> to provide a framework for application tasks.
-     * It includes methods for initialization, message processing, timer event handling, and notification
-     * processing. Derived classes should implement specific task logic by overriding the provided virtual methods.
+     * The Task class provides a framework for application tasks. It includes methods for initialization,
+     * message processing, timer event handling, and notification processing. Derived classes should
+     * implement specific task logic by overriding the provided virtual methods.
+     *
+     * The FreeRTOS task is created by Create() in a stack and control block provided by the caller,
+     * see ApplicationNS::StaticTask, and waits for a notification before it runs task().
+     *
+     * Messages are taken from the queue in batches of up to the batch budget and passed together to
+     * ProcessMessageBatch(), which calls ProcessIncomingMessage() for each of them. Tasks override it to
+     * deduplicate or merge the messages of a batch, e.g. to render once for several changes.
+     *
+     * Requests to other tasks are sent with Request(), their responses are taken from the message queue
+     * and passed to the completion callback before the rest of the batch is processed.
+     *
+     * Timers are started with StartTimer() on the shared TimerServiceNS::TimerService, their expirations
+     * are passed to ProcessTimerEvent().
+     *
+     * Fast events are published with PublishFastEvent(), they only set a notification bit of the
+     * subscribed tasks and are passed to ProcessFastEvent() ahead of the queued messages.
+     *
+     * Sequences with waits are written as ApplicationNS::Coroutine and started with StartCoroutine(),
+     * the task keeps processing messages and timers while a coroutine waits.
+     *
+     * With the build flag USE_HANDLER_PROFILER=true the execution time of every handler invocation
+     * is measured by the HandlerProfilerNS::HandlerProfiler, with USE_TASK_SUPERVISOR=true every
+     * handler invocation is reported to the TaskSupervisorNS::TaskSupervisor to detect stalls.
      */
-    class Task : public FreeRTOScpp::TaskClassS<0>
+    class Task
     {
     public:
         Task(char const* apName, tTaskPriority aPriority, const uint32_t aStackSize);
+        virtual ~Task();
+
+        bool Create(StackType_t* apStack, StaticTask_t* apTaskBuffer, BaseType_t aCore);
         virtual void Init(tTaskObjects* apTaskObjects);
 
+        /** @brief Returns the handle of the FreeRTOS task, nullptr before Create() */
+        TaskHandle_t getTaskHandle(void) const { return mTaskHandle; }
+
     protected:
         tTaskObjects* mpTaskObjects;
 
-        /* FreeRTOScpp::TaskClassS<0>::task */
-        virtual void task(void) override;
+        virtual void task(void);
 
+        virtual void ProcessMessageBatch(const MessageNS::Message* apMessages, uint8_t aCount);
         virtual void ProcessIncomingMessage(const MessageNS::Message &arMessage);
-        virtual void ProcessIncomingTimerMessage(const MessageNS::Message &arMessage);
         virtual void ProcessTimerEvent(const uint32_t aTimerId = 0);
+        virtual void ProcessFastEvent(MessageNS::tFastEvent aEvent);
         virtual void ProcessUnknownNotification(const uint32_t aNotificationValue);
 
         void SendMessage(const MessageNS::Message &arMessage);
+        void PublishMessage(const MessageNS::Message &arMessage);
+        void PublishFastEvent(MessageNS::tFastEvent aEvent);
+
+        tRpcHandle Request(const MessageNS::Message &arRequest, MessageNS::tMessageId aResponseId,
+                TickType_t aTimeout, tRpcCallback aCallback);
+        bool CancelRequest(tRpcHandle aHandle);
+
+        TimerServiceNS::tTimerHandle StartTimer(uint32_t aTimerId, uint32_t aPeriodMs, bool aPeriodic = true);
+        TimerServiceNS::tTimerHandle StartTimerAt(uint32_t aTimerId, uint32_t aDeadlineMs);
+        bool StopTimer(TimerServiceNS::tTimerHandle aHandle);
+
+        bool StartCoroutine(Coroutine& arCoroutine);
+        void StopCoroutine(Coroutine& arCoroutine);
+
+    private:
+        char const*   mpName;
+        tTaskPriority mPriority;
+        uint32_t      mStackSize;
+        TaskHandle_t  mTaskHandle = nullptr;
+
+        /** @brief Pending requests of the task */
+        RpcClient mRpcClient;
+
+        /** @brief Client of the task at the timer service */
+        TimerServiceNS::tTimerClient mTimerClient = TimerServiceNS::mInvalidTimerClient;
+
+        /** @brief Started coroutines of the task, indexed by Coroutine::mIndex */
+        Coroutine* mCoroutines[mMaxTaskCoroutines] = {};
+
+        /** @brief Task at the handler profiler (USE_HANDLER_PROFILER=true) */
+        HandlerProfilerNS::tProfilerTask mProfilerTask = HandlerProfilerNS::mInvalidProfilerTask;
+
+        /** @brief Task at the task supervisor (USE_TASK_SUPERVISOR=true) */
+        TaskSupervisorNS::tSupervisedTask mSupervisedTask = TaskSupervisorNS::mInvalidSupervisedTask;
+
+        void ResumeCoroutine(Coroutine& arCoroutine);
+
+        static void TaskFunction(void* apParameter);
     };
 
 }; /* end of namespace ApplicationNS */
@@ -9,322 +9,360 @@
 
 #include <Arduino.h>
 
+
+/**
+ * @brief Matrix of aWidth x aHeight bits, stored row by row in 32 bit words.
+ *
+ * @details
+ * Bit (row, column) has the index row * aWidth + column, bit N is bit N % 32 of word N / 32.
+ * The matrix has a fixed size and no heap storage, all functions are constexpr, so masks can
+ * be built at compile time. Lines and areas are set word by word with masks, rows are flipped
+ * by reversing their bits if the rows do not cross word boundaries (32 is a multiple of the
+ * width). ForEachSetBit() visits only the set bits.
+ */
+template<uint16_t aWidth, uint16_t aHeight>
 class BitMatrix
 {
 public:
-    BitMatrix(uint16_t aWidth, const uint16_t aHeight)
-        : mWidth(aWidth), mHeight(aHeight)
-    {
-        /* Calculate number of bits and array size */
-        mNumbOfBits = mWidth * mHeight;
-        mArraySize = (mNumbOfBits + mBitsInUint8 - 1) / mBitsInUint8;
+    static_assert((aWidth > 0) && (aHeight > 0), "BitMatrix must not be empty");
 
-        /* Create array of uint8_t elements */
-        mpArray = new uint8_t[mArraySize];
-    }
+    /** @brief Number of bits in uint32_t type */
+    static constexpr uint8_t  mBitsInWord = 32U;
+    /** @brief Number of bits of the matrix */
+    static constexpr uint32_t mNumbOfBits = static_cast<uint32_t>(aWidth) * aHeight;
+    /** @brief Number of words of the matrix */
+    static constexpr uint32_t mNumbOfWords = (mNumbOfBits + mBitsInWord - 1) / mBitsInWord;
 
-    virtual ~BitMatrix()
+    constexpr BitMatrix() : mWords{}
     {
-        delete[] mpArray;
-        mpArray = nullptr;
+        // do nothing
     }
 
-    /** @brief Get number of emenents */
-    uint32_t GetSize(void) const
+    /** @brief Get number of elements */
+    static constexpr uint32_t GetSize(void)
     {
         return mNumbOfBits;
-    };
+    }
 
     /** @brief Get matrix width */
-    uint16_t GetWidth(void) const
+    static constexpr uint16_t GetWidth(void)
     {
-        return mWidth;
-    };
+        return aWidth;
+    }
 
     /** @brief Get matrix height */
-    uint16_t GetHeight(void) const
+    static constexpr uint16_t GetHeight(void)
     {
-        return mHeight;
-    };
+        return aHeight;
+    }
+
+    /** @brief Get a word of the bit array */
+    constexpr uint32_t GetWord(const uint32_t aWordIndex) const
+    {
+        return (aWordIndex < mNumbOfWords) ? mWords[aWordIndex] : 0;
+    }
 
     /** @brief Set all (sets every bit in the bit array to 1) */
-    void SetAll(void)
+    constexpr void SetAll(void)
     {
-        for (uint32_t wI = 0; wI < mArraySize; wI++)
-        {
-            mpArray[wI] = 0xFF;
-        }
+        SetRange(0, mNumbOfBits);
     }
 
     /** @brief Clear all (sets every bit in the bit array to 0) */
-    void ClearAll(void)
+    constexpr void ClearAll(void)
     {
-        for (uint32_t wI = 0; wI < mArraySize; wI++)
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
         {
-            mpArray[wI] = 0;
+            mWords[wI] = 0;
         }
     }
 
     /** @brief Checks if the bit at the specified index is set (1) */
-    bool IsBitSet(const uint32_t aIndex)
+    constexpr bool IsBitSet(const uint32_t aIndex) const
     {
-        uint32_t wByteOffset;
-        uint32_t wBitIndex;
-        bool     wBitIsSet = false;
-
-        if (aIndex < mNumbOfBits)
-        {
-            wByteOffset = (aIndex / mBitsInUint8);
-            wBitIndex   = (aIndex % mBitsInUint8);
-
-            wBitIsSet = (*(static_cast<uint8_t*>(mpArray + wByteOffset)) & static_cast<uint8_t>(1 << wBitIndex)) != 0;
-        }
-
-        return wBitIsSet;
+        return (aIndex < mNumbOfBits) &&
+               ((mWords[aIndex / mBitsInWord] & (1UL << (aIndex % mBitsInWord))) != 0);
     }
 
     /** @brief Check if a bit is set in the matrix at specified row and column */
-    bool IsBitSet(const uint16_t aRow, const uint16_t aCol)
+    constexpr bool IsBitSet(const uint16_t aRow, const uint16_t aCol) const
     {
-        bool wBitIsSet = false;
-
-        /* Check input parameters */
-        if ((aRow < mHeight) &&
-            (aCol < mWidth))
-        {
-            /* Calculate bit index */
-            uint32_t wBitIndex = (aRow * mHeight) + aCol;
-            /* Get bit state */
-            wBitIsSet = IsBitSet(wBitIndex);
-        }
-
-        return wBitIsSet;
+        return (aRow < aHeight) && (aCol < aWidth) && IsBitSet(GetIndex(aRow, aCol));
     }
 
     /** @brief Clear bit at specific position in bit array */
-    void ClearBit(const uint32_t aIndex)
+    constexpr void ClearBit(const uint32_t aIndex)
     {
-        uint32_t wByteOffset;
-        uint32_t wBitIndex;
-
         if (aIndex < mNumbOfBits)
         {
-            wByteOffset = (aIndex / mBitsInUint8);
-            wBitIndex   = (aIndex % mBitsInUint8);
-
-            *(static_cast<uint8_t*>(mpArray + wByteOffset)) &= ~(static_cast<uint8_t>(1 << wBitIndex));
+            mWords[aIndex / mBitsInWord] &= ~static_cast<uint32_t>(1UL << (aIndex % mBitsInWord));
         }
     }
 
     /** @brief Set the bit at a specific position in bit array */
-    void SetBit(const uint32_t aIndex)
+    constexpr void SetBit(const uint32_t aIndex)
     {
-        uint32_t wByteOffset;
-        uint32_t wBitIndex;
-
         if (aIndex < mNumbOfBits)
         {
-            wByteOffset = (aIndex / mBitsInUint8);
-            wBitIndex   = (aIndex % mBitsInUint8);
-
-            *(static_cast<uint8_t*>(mpArray + wByteOffset)) |= static_cast<uint8_t>(1 << wBitIndex);
+            mWords[aIndex / mBitsInWord] |= static_cast<uint32_t>(1UL << (aIndex % mBitsInWord));
         }
     }
 
     /** @brief Set a bit in the matrix at specified row and column */
-    void SetBit(const uint16_t aRow, const uint16_t aCol)
+    constexpr void SetBit(const uint16_t aRow, const uint16_t aCol)
     {
         /* Check input parameters */
-        if ((aRow < mHeight) &&
-            (aCol < mWidth))
+        if ((aRow < aHeight) &&
+            (aCol < aWidth))
         {
-            /* Calculate bit index */
-            uint32_t wBitIndex = (aRow * mHeight) + aCol;
-            /* Set bit */
-            SetBit(wBitIndex);
+            SetBit(GetIndex(aRow, aCol));
         }
     }
 
     /** @brief Set a line of bits in the matrix */
-    void SetLine(const uint16_t aRow, const uint16_t aCol, const uint16_t aLength)
+    constexpr void SetLine(const uint16_t aRow, const uint16_t aCol, const uint16_t aLength)
     {
         /* Check input parameters */
-        if ((aLength > 0) && (aRow < mHeight) &&
-            (aCol < mWidth)  && ((aCol + aLength) <= mWidth))
+        if ((aLength > 0) && (aRow < aHeight) &&
+            (aCol < aWidth)  && ((aCol + aLength) <= aWidth))
         {
-            for (uint16_t wI = 0; wI < aLength; wI++)
-            {
-                SetBit(aRow, (aCol + wI));
-            }
+            SetRange(GetIndex(aRow, aCol), aLength);
         }
     }
 
     /** @brief Set a rectangular area of bits in the matrix */
-    void SetArea(const uint16_t aRow, const uint16_t aCol, const uint16_t aWidth, const uint16_t aHeight)
+    constexpr void SetArea(const uint16_t aRow, const uint16_t aCol, const uint16_t aAreaWidth, const uint16_t aAreaHeight)
     {
         /* Check input parameters */
-        if ((aRow < mHeight) && ((aRow + aHeight) <= mHeight) &&
-            (aCol < mWidth)  && ((aCol + aWidth)  <= mWidth))
+        if ((aRow < aHeight) && ((aRow + aAreaHeight) <= aHeight) &&
+            (aCol < aWidth)  && ((aCol + aAreaWidth)  <= aWidth))
         {
-            for (uint16_t wI = 0; wI < aHeight; wI++)
+            for (uint16_t wI = 0; wI < aAreaHeight; wI++)
             {
-                SetLine((aRow + wI), aCol, aWidth);
+                SetLine((aRow + wI), aCol, aAreaWidth);
             }
         }
     }
 
     /** @brief Flip a specific row horizontally (left-to-right) */
-    void FlipRow(const uint16_t aRow)
+    constexpr void FlipRow(const uint16_t aRow)
     {
-        for (uint16_t wCol = 0; wCol < mWidth / 2; wCol++)
+        if (aRow >= aHeight)
+        {
+            return;
+        }
+
+        if constexpr ((mBitsInWord % aWidth) == 0)
         {
-            uint32_t leftIndex  = aRow * mWidth + wCol;
-            uint32_t rightIndex = aRow * mWidth + (mWidth - 1 - wCol);
+            /* The row is a bit field of one word, reverse its bits */
+            uint32_t wIndex = GetIndex(aRow, 0);
+            uint32_t wShift = wIndex % mBitsInWord;
+            uint32_t wMask  = RowMask() << wShift;
+            uint32_t& wrWord = mWords[wIndex / mBitsInWord];
 
-            bool leftBit  = IsBitSet(leftIndex);
-            bool rightBit = IsBitSet(rightIndex);
+            uint32_t wRow = (wrWord & wMask) >> wShift;
+            wRow = ReverseBits(wRow) >> (mBitsInWord - aWidth);
 
-            /* Swap bits if they are different */
-            if (leftBit != rightBit)
+            wrWord = (wrWord & ~wMask) | (wRow << wShift);
+        }
+        else
+        {
+            for (uint16_t wCol = 0; wCol < aWidth / 2; wCol++)
             {
-                if (leftBit)
-                {
-                    SetBit(rightIndex);
-                    ClearBit(leftIndex);
-                }
-                else
-                {
-                    SetBit(leftIndex);
-                    ClearBit(rightIndex);
-                }
+                SwapBits(GetIndex(aRow, wCol), GetIndex(aRow, aWidth - 1 - wCol));
             }
         }
     }
 
     /** @brief Flip a specific column vertically (top-to-bottom) */
-    void FlipColumn(const uint16_t aColumn)
+    constexpr void FlipColumn(const uint16_t aColumn)
     {
-        for (uint16_t wRow = 0; wRow < mHeight / 2; wRow++)
+        if (aColumn >= aWidth)
         {
-            uint32_t topIndex    = wRow * mWidth + aColumn;
-            uint32_t bottomIndex = (mHeight - 1 - wRow) * mWidth + aColumn;
-
-            bool topBit    = IsBitSet(topIndex);
-            bool bottomBit = IsBitSet(bottomIndex);
+            return;
+        }
 
-            /* Swap bits if they are different */
-            if (topBit != bottomBit)
-            {
-                if (topBit)
-                {
-                    SetBit(bottomIndex);
-                    ClearBit(topIndex);
-                }
-                else
-                {
-                    SetBit(topIndex);
-                    ClearBit(bottomIndex);
-                }
-            }
+        for (uint16_t wRow = 0; wRow < aHeight / 2; wRow++)
+        {
+            SwapBits(GetIndex(wRow, aColumn), GetIndex(aHeight - 1 - wRow, aColumn));
         }
     }
 
     /** @brief Flip the matrix horizontally (left-to-right) */
-    void FlipHorizontal(void)
+    constexpr void FlipHorizontal(void)
     {
-        for (uint16_t wRow = 0; wRow < mHeight; wRow++)
+        for (uint16_t wRow = 0; wRow < aHeight; wRow++)
         {
             FlipRow(wRow);
         }
     }
 
     /** @brief Flip the matrix vertically (top-to-bottom) */
-    void FlipVertical(void)
+    constexpr void FlipVertical(void)
     {
-        for (uint16_t col = 0; col < mWidth; ++col)
+        for (uint16_t wCol = 0; wCol < aWidth; wCol++)
         {
-            FlipColumn(col);
+            FlipColumn(wCol);
         }
     }
 
-    void Copy(const BitMatrix& aOther)
+    /** @brief Get number of set bits */
+    constexpr uint32_t Count(void) const
     {
-        if ((mWidth  == aOther.mWidth) &&
-            (mHeight == aOther.mHeight))
+        uint32_t wCount = 0;
+
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
         {
-            /* Copy array using memcpy function */
-            memcpy(mpArray, aOther.mpArray, mArraySize);
+            wCount += static_cast<uint32_t>(__builtin_popcount(mWords[wI]));
         }
+
+        return wCount;
     }
 
-    void Union(const BitMatrix& aOther)
+    /**
+     * @brief Calls the visitor with the index of each set bit, lowest index first.
+     *
+     * @param aVisitor Callable with a uint32_t bit index argument
+     */
+    template<typename tVisitor>
+    constexpr void ForEachSetBit(tVisitor aVisitor) const
     {
-        if ((mWidth == aOther.mWidth) &&
-            (mHeight == aOther.mHeight))
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
         {
-            /* Set bits that are set in either matrix */
-            for (uint32_t wI = 0; wI < mArraySize; wI++)
+            uint32_t wBits = mWords[wI];
+
+            while (wBits != 0)
             {
-                mpArray[wI] |= aOther.mpArray[wI];
+                aVisitor((wI * mBitsInWord) + static_cast<uint32_t>(__builtin_ctz(wBits)));
+
+                /* Clear lowest set bit */
+                wBits &= (wBits - 1);
             }
         }
     }
-    void Intersect(const BitMatrix& aOther)
+
+    constexpr void Copy(const BitMatrix& aOther)
     {
-        if ((mWidth == aOther.mWidth) &&
-            (mHeight == aOther.mHeight))
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
         {
-            /* Keep only bits that are set in both matrices */
-            for (uint32_t wI = 0; wI < mArraySize; wI++)
-            {
-                mpArray[wI] &= aOther.mpArray[wI];
-            }
+            mWords[wI] = aOther.mWords[wI];
         }
     }
 
+    constexpr void Union(const BitMatrix& aOther)
+    {
+        /* Set bits that are set in either matrix */
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
+        {
+            mWords[wI] |= aOther.mWords[wI];
+        }
+    }
 
-    void Difference(const BitMatrix& aOther)
+    constexpr void Intersect(const BitMatrix& aOther)
     {
-        if ((mWidth  == aOther.mWidth) &&
-            (mHeight == aOther.mHeight))
+        /* Keep only bits that are set in both matrices */
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
         {
-            /* Set bits that are set in aOther to 0 in this matrix */
-            for (uint32_t wI = 0; wI < mArraySize; wI++)
-            {
-                mpArray[wI] &= ~(aOther.mpArray[wI]);
-            }
+            mWords[wI] &= aOther.mWords[wI];
+        }
+    }
+
+    constexpr void Difference(const BitMatrix& aOther)
+    {
+        /* Set bits that are set in aOther to 0 in this matrix */
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
+        {
+            mWords[wI] &= ~(aOther.mWords[wI]);
         }
     }
 
     /* Operator == overload */
-    bool operator==(const BitMatrix& aOther) const
+    constexpr bool operator==(const BitMatrix& aOther) const
     {
-        return ((mWidth  == aOther.mWidth)  &&
-                (mHeight == aOther.mHeight) &&
-                (memcmp(mpArray, aOther.mpArray, mArraySize) == 0));
+        for (uint32_t wI = 0; wI < mNumbOfWords; wI++)
+        {
+            if (mWords[wI] != aOther.mWords[wI])
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     /* Operator != overload */
-    bool operator!=(const BitMatrix& aOther) const
+    constexpr bool operator!=(const BitMatrix& aOther) const
     {
         return !(*this == aOther);
     }
 
 private:
 
-    /* Number of bits in uint8_t type */
-    static constexpr uint8_t mBitsInUint8 = 8U;
+    /* Words of the bit array, unused bits of the last word are 0 */
+    uint32_t mWords[mNumbOfWords];
 
-    uint16_t mWidth;
-    uint16_t mHeight;
+    /** @brief Get bit index of row and column */
+    static constexpr uint32_t GetIndex(const uint16_t aRow, const uint16_t aCol)
+    {
+        return (static_cast<uint32_t>(aRow) * aWidth) + aCol;
+    }
 
-    /* Number of bits in the array */
-    uint32_t mNumbOfBits;
+    /** @brief Get mask of the lowest aWidth bits */
+    static constexpr uint32_t RowMask(void)
+    {
+        return (aWidth >= mBitsInWord) ? 0xFFFFFFFFUL : ((1UL << aWidth) - 1);
+    }
 
-    /* Size of byte array */
-    uint32_t mArraySize;
-    /* Pointer to the byte array */
-	uint8_t* mpArray;
+    /** @brief Reverse the bit order of a word */
+    static constexpr uint32_t ReverseBits(uint32_t aValue)
+    {
+        aValue = ((aValue >> 1) & 0x55555555UL) | ((aValue & 0x55555555UL) << 1);
+        aValue = ((aValue >> 2) & 0x33333333UL) | ((aValue & 0x33333333UL) << 2);
+        aValue = ((aValue >> 4) & 0x0F0F0F0FUL) | ((aValue & 0x0F0F0F0FUL) << 4);
+        aValue = ((aValue >> 8) & 0x00FF00FFUL) | ((aValue & 0x00FF00FFUL) << 8);
+        return static_cast<uint32_t>((aValue >> 16) | (aValue << 16));
+    }
+
+    /** @brief Set aLength bits from aIndex on, word by word */
+    constexpr void SetRange(uint32_t aIndex, uint32_t aLength)
+    {
+        while (aLength > 0)
+        {
+            uint32_t wShift = aIndex % mBitsInWord;
+            uint32_t wCount = mBitsInWord - wShift;
+            if (wCount > aLength)
+            {
+                wCount = aLength;
+            }
+
+            uint32_t wMask = (wCount == mBitsInWord) ? 0xFFFFFFFFUL : (((1UL << wCount) - 1) << wShift);
+            mWords[aIndex / mBitsInWord] |= wMask;
+
+            aIndex  += wCount;
+            aLength -= wCount;
+        }
+    }
+
+    /** @brief Swap two bits */
+    constexpr void SwapBits(const uint32_t aIndexA, const uint32_t aIndexB)
+    {
+        bool wBitA = IsBitSet(aIndexA);
+        bool wBitB = IsBitSet(aIndexB);
+
+        /* Swap bits if they are different */
+        if (wBitA != wBitB)
+        {
+            if (wBitA)
+            {
+                SetBit(aIndexB);
+                ClearBit(aIndexA);
+            }
+            else
+            {
+                SetBit(aIndexA);
+                ClearBit(aIndexB);
+            }
+        }
+    }
 };
 
-#endif /* SRC_BITARRAY_H_ */
\ No newline at end of file
+#endif /* SRC_BITMATRIX_H_ */
@@ -0,0 +1,209 @@
+/*
+ * BufferPool.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <cassert>
+
+#include "Logger.h"
+
+#include "BufferPool.h"
+
+
+/* Log level for this module */
+#define LOG_LEVEL   (LOG_WARN)
+
+
+namespace BufferPoolNS
+{
+/**
+ * @brief Constructor
+ */
+BufferPool::BufferPool()
+    : mFreeMask((mBufferBlockCount == 32) ? 0xFFFFFFFF : ((static_cast<uint32_t>(1) << mBufferBlockCount) - 1)),
+      mBlocksInUse(0), mHighWaterMark(0), mAllocations(0), mExhaustions(0)
+{
+    for (tBlock& wBlock : mBlocks)
+    {
+        wBlock.mReferences = 0;
+        wBlock.mLength     = 0;
+    }
+}
+
+/**
+ * @brief Destructor
+ */
+BufferPool::~BufferPool()
+{
+    // do nothing
+}
+
+/**
+ * @brief Allocates a buffer from the pool.
+ *
+ * @details
+ * The lowest free block is taken from the free mask with a compare-and-swap loop.
+ * The returned buffer has one reference, which is owned by the caller.
+ *
+ * @param aLength Number of valid bytes in the buffer, limited to mBufferBlockSize
+ * @return Handle of the allocated buffer, mInvalidBufferHandle if the pool is exhausted
+ *         or the requested length exceeds the block size
+ */
+tBufferHandle BufferPool::Allocate(const uint16_t aLength)
+{
+    if (aLength > mBufferBlockSize)
+    {
+        LOG(LOG_ERROR, "BufferPool::Allocate() Requested length %u exceeds block size %u", aLength, mBufferBlockSize);
+        return mInvalidBufferHandle;
+    }
+
+    /* Take the lowest free block */
+    uint32_t wFreeMask = mFreeMask.load(std::memory_order_relaxed);
+    uint8_t  wIndex;
+    do
+    {
+        if (wFreeMask == 0)
+        {
+            /* Pool exhausted */
+            mExhaustions.fetch_add(1, std::memory_order_relaxed);
+
+            LOG(LOG_WARN, "BufferPool::Allocate() Pool exhausted, %u blocks in use", mBufferBlockCount);
+            return mInvalidBufferHandle;
+        }
+
+        wIndex = static_cast<uint8_t>(__builtin_ctz(wFreeMask));
+    }
+    while (!mFreeMask.compare_exchange_weak(wFreeMask, wFreeMask & ~(static_cast<uint32_t>(1) << wIndex),
+            std::memory_order_acquire, std::memory_order_relaxed));
+
+    /* Initialize block */
+    mBlocks[wIndex].mLength = aLength;
+    mBlocks[wIndex].mReferences.store(1, std::memory_order_relaxed);
+
+    /* Update statistics */
+    mAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    uint8_t wInUse     = mBlocksInUse.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint8_t wHighWater = mHighWaterMark.load(std::memory_order_relaxed);
+    while ((wInUse > wHighWater) &&
+           !mHighWaterMark.compare_exchange_weak(wHighWater, wInUse, std::memory_order_relaxed))
+    {
+        // retry with updated high-water mark
+    }
+
+    return static_cast<tBufferHandle>(wIndex + 1);
+}
+
+/**
+ * @brief Adds a reference to a buffer.
+ *
+ * @param aHandle Handle of the buffer
+ */
+void BufferPool::AddReference(const tBufferHandle aHandle)
+{
+    tBlock* wpBlock = GetBlock(aHandle);
+    if (wpBlock != nullptr)
+    {
+        wpBlock->mReferences.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Releases a reference to a buffer.
+ *
+ * @details
+ * The block is returned to the pool when the last reference has been released.
+ *
+ * @param aHandle Handle of the buffer
+ */
+void BufferPool::Release(const tBufferHandle aHandle)
+{
+    tBlock* wpBlock = GetBlock(aHandle);
+    if (wpBlock != nullptr)
+    {
+        uint8_t wReferences = wpBlock->mReferences.fetch_sub(1, std::memory_order_acq_rel);
+
+        /* Ensure the buffer was referenced */
+        assert(wReferences > 0);
+
+        if (wReferences == 1)
+        {
+            /* Last reference released, return block to the pool */
+            mBlocksInUse.fetch_sub(1, std::memory_order_relaxed);
+            mFreeMask.fetch_or(static_cast<uint32_t>(1) << (aHandle - 1), std::memory_order_release);
+        }
+    }
+}
+
+/**
+ * @brief Returns the data of a buffer.
+ *
+ * @param aHandle Handle of the buffer
+ * @return Pointer to mBufferBlockSize bytes of buffer data, nullptr if the handle is invalid
+ */
+uint8_t* BufferPool::GetData(const tBufferHandle aHandle)
+{
+    tBlock* wpBlock = GetBlock(aHandle);
+    return (wpBlock != nullptr) ? wpBlock->mData : nullptr;
+}
+
+/**
+ * @brief Returns the number of valid bytes in a buffer.
+ *
+ * @param aHandle Handle of the buffer
+ * @return Number of valid bytes, 0 if the handle is invalid
+ */
+uint16_t BufferPool::GetLength(const tBufferHandle aHandle) const
+{
+    const tBlock* wpBlock = GetBlock(aHandle);
+    return (wpBlock != nullptr) ? wpBlock->mLength : 0;
+}
+
+/**
+ * @brief Sets the number of valid bytes in a buffer.
+ *
+ * @details
+ * Shall only be called by the owner of the buffer before the buffer is shared with other tasks.
+ *
+ * @param aHandle Handle of the buffer
+ * @param aLength Number of valid bytes, limited to mBufferBlockSize
+ * @return true if the length has been set, false otherwise
+ */
+bool BufferPool::SetLength(const tBufferHandle aHandle, const uint16_t aLength)
+{
+    tBlock* wpBlock = GetBlock(aHandle);
+    if ((wpBlock != nullptr) && (aLength <= mBufferBlockSize))
+    {
+        wpBlock->mLength = aLength;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the pool usage statistics.
+ *
+ * @return Copy of the current statistics
+ */
+tPoolStatistics BufferPool::GetStatistics(void) const
+{
+    tPoolStatistics wStatistics;
+    wStatistics.mBlocksInUse   = mBlocksInUse.load(std::memory_order_relaxed);
+    wStatistics.mHighWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+    wStatistics.mAllocations   = mAllocations.load(std::memory_order_relaxed);
+    wStatistics.mExhaustions   = mExhaustions.load(std::memory_order_relaxed);
+    return wStatistics;
+}
+
+BufferPool::tBlock* BufferPool::GetBlock(const tBufferHandle aHandle)
+{
+    return ((aHandle != mInvalidBufferHandle) && (aHandle <= mBufferBlockCount)) ? &mBlocks[aHandle - 1] : nullptr;
+}
+
+const BufferPool::tBlock* BufferPool::GetBlock(const tBufferHandle aHandle) const
+{
+    return ((aHandle != mInvalidBufferHandle) && (aHandle <= mBufferBlockCount)) ? &mBlocks[aHandle - 1] : nullptr;
+}
+
+}   /* end of namespace BufferPoolNS */
@@ -0,0 +1,123 @@
+/*
+ * BufferPool.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "Message.h"
+
+
+namespace BufferPoolNS
+{
+    /**
+     * @brief Handle of a buffer allocated from the pool.
+     *
+     * @details
+     * The handle is the block index plus one, so that a zero-initialized handle is invalid.
+     */
+    typedef uint8_t tBufferHandle;
+
+    /** @brief Invalid buffer handle */
+    static constexpr tBufferHandle mInvalidBufferHandle = 0;
+
+    /** @brief Size of a single pool block in bytes */
+    static constexpr uint16_t mBufferBlockSize  = 1024;
+    /** @brief Number of blocks in the pool (max. 32, one bit per block in the free mask) */
+    static constexpr uint8_t  mBufferBlockCount = 4;
+
+    static_assert(mBufferBlockCount <= 32, "Free block mask is limited to 32 blocks");
+
+    /**
+     * @brief Pool usage statistics
+     */
+    struct tPoolStatistics
+    {
+        /** @brief Number of blocks currently allocated */
+        uint8_t  mBlocksInUse;
+        /** @brief Maximal number of blocks allocated at the same time */
+        uint8_t  mHighWaterMark;
+        /** @brief Number of successful allocations */
+        uint32_t mAllocations;
+        /** @brief Number of allocations failed because the pool was exhausted */
+        uint32_t mExhaustions;
+    };
+
+    /**
+     * @brief Pool of reference counted buffers for large message payloads.
+     *
+     * @details
+     * The pool owns a fixed number of statically allocated blocks of mBufferBlockSize bytes.
+     * A block is allocated with a reference count of one, which is owned by the caller.
+     * When a message carrying the buffer handle is sent or published, the communication manager
+     * takes one reference for each delivered copy and the receiving task releases it after the
+     * message has been processed. The block returns to the pool when the last reference is
+     * released. So payloads move between tasks without heap allocation and without copying
+     * the data, only the small message header goes through the queues.
+     *
+     * Free blocks are tracked with an atomic bitmask, all functions are lock-free and can be
+     * called from any task.
+     */
+    class BufferPool
+    {
+    public:
+        BufferPool();
+        virtual ~BufferPool();
+
+        tBufferHandle Allocate(const uint16_t aLength);
+        void AddReference(const tBufferHandle aHandle);
+        void Release(const tBufferHandle aHandle);
+
+        uint8_t* GetData(const tBufferHandle aHandle);
+        uint16_t GetLength(const tBufferHandle aHandle) const;
+        bool SetLength(const tBufferHandle aHandle, const uint16_t aLength);
+
+        tPoolStatistics GetStatistics(void) const;
+
+    private:
+        /** @brief Block of the pool */
+        struct tBlock
+        {
+            /** @brief Number of references to the block */
+            std::atomic<uint8_t> mReferences;
+            /** @brief Number of valid bytes in the block */
+            uint16_t mLength;
+            /** @brief Data of the block */
+            alignas(4) uint8_t mData[mBufferBlockSize];
+        };
+
+        tBlock mBlocks[mBufferBlockCount];
+
+        /** @brief Free blocks, bit N is set if the block N is free */
+        std::atomic<uint32_t> mFreeMask;
+
+        /* Statistics */
+        std::atomic<uint8_t>  mBlocksInUse;
+        std::atomic<uint8_t>  mHighWaterMark;
+        std::atomic<uint32_t> mAllocations;
+        std::atomic<uint32_t> mExhaustions;
+
+        tBlock* GetBlock(const tBufferHandle aHandle);
+        const tBlock* GetBlock(const tBufferHandle aHandle) const;
+    };
+
+    /**
+     * @brief Returns the pool buffer attached to a message.
+     *
+     * @param arMessage Message with attached buffer
+     * @return Handle of the buffer, mInvalidBufferHandle if no buffer is attached
+     */
+    inline tBufferHandle GetBuffer(const MessageNS::Message& arMessage)
+    {
+        return (arMessage.mPayloadType == MessageNS::tPayloadType::PAYLOAD_BUFFER) ?
+                arMessage.mPayload[0] : mInvalidBufferHandle;
+    }
+
+}   /* end of namespace BufferPoolNS */
+
+/* Declare the object as extern for global access  */
+extern BufferPoolNS::BufferPool BufferPool;
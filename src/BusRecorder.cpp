@@ -0,0 +1,257 @@
+/*
+ * BusRecorder.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "Logger.h"
+
+#include "BusRecorder.h"
+
+
+/* Log level for this module */
+#define LOG_LEVEL   (LOG_WARN)
+
+
+namespace BusRecorderNS
+{
+/** @brief Prefix of a dumped record line */
+static constexpr const char* mcRecordPrefix = "[REC] ";
+
+/**
+ * @brief Converts a hex digit to its value.
+ *
+ * @return Value of the digit, -1 if the character is not a hex digit
+ */
+static int8_t HexDigitValue(char aDigit)
+{
+    if ((aDigit >= '0') && (aDigit <= '9')) return aDigit - '0';
+    if ((aDigit >= 'A') && (aDigit <= 'F')) return aDigit - 'A' + 10;
+    if ((aDigit >= 'a') && (aDigit <= 'f')) return aDigit - 'a' + 10;
+    return -1;
+}
+
+
+/**
+ *
+ * Implementation of the BusRecorderNS::BusRecorder class
+ *
+ */
+BusRecorder::BusRecorder()
+    : mWriteCount(0), mEnabled(true)
+{
+    // do nothing
+}
+
+BusRecorder::~BusRecorder()
+{
+    // do nothing
+}
+
+/**
+ * @brief Records a message (any task).
+ *
+ * @param aEvent Event of the message
+ * @param arMessage Message to record
+ */
+void BusRecorder::Record(tRecordEvent aEvent, const MessageNS::Message& arMessage)
+{
+    if (mEnabled.load(std::memory_order_relaxed) == false)
+    {
+        return;
+    }
+
+    /* Reserve the next slot, the oldest record is overwritten */
+    tRecord& wRecord = mRecords[mWriteCount.fetch_add(1, std::memory_order_relaxed) & (mRecordCount - 1)];
+
+    wRecord.mTimestampUs   = static_cast<uint32_t>(micros());
+    wRecord.mEvent         = aEvent;
+    wRecord.mSource        = arMessage.mSource;
+    wRecord.mDestination   = arMessage.mDestination;
+    wRecord.mId            = arMessage.mId;
+    wRecord.mCorrelationId = arMessage.mCorrelationId;
+    wRecord.mPayloadType   = arMessage.mPayloadType;
+    wRecord.mPayloadLength = arMessage.mPayloadLength;
+    memcpy(wRecord.mPayload, arMessage.mPayload, sizeof(wRecord.mPayload));
+}
+
+/**
+ * @brief Removes all records.
+ */
+void BusRecorder::Clear(void)
+{
+    mWriteCount.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Prints all records on the serial console, oldest first.
+ *
+ * @details
+ * Recording is suspended during the dump, messages sent meanwhile are not recorded.
+ */
+void BusRecorder::Dump(void)
+{
+    mEnabled.store(false, std::memory_order_relaxed);
+
+    uint32_t wWriteCount = mWriteCount.load(std::memory_order_relaxed);
+    uint32_t wCount      = (wWriteCount < mRecordCount) ? wWriteCount : mRecordCount;
+
+    Serial.printf("%sbegin %lu records of %u bytes\r\n",
+            mcRecordPrefix, static_cast<unsigned long>(wCount), static_cast<unsigned>(sizeof(tRecord)));
+
+    for (uint32_t wIndex = wWriteCount - wCount; wIndex != wWriteCount; wIndex++)
+    {
+        const uint8_t* wpBytes = reinterpret_cast<const uint8_t*>(&mRecords[wIndex & (mRecordCount - 1)]);
+
+        Serial.printf("%s", mcRecordPrefix);
+        for (uint8_t wI = 0; wI < sizeof(tRecord); wI++)
+        {
+            Serial.printf("%02X", wpBytes[wI]);
+        }
+        Serial.printf("\r\n");
+    }
+
+    Serial.printf("%send\r\n", mcRecordPrefix);
+
+    mEnabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Converts a dumped record line back to a record.
+ *
+ * @param apLine Line printed by Dump(), with or without the "[REC] " prefix
+ * @param arRecord Parsed record
+ * @return true if the line holds a record, false otherwise (e.g. begin or end line)
+ */
+bool BusRecorder::ParseRecord(const char* apLine, tRecord& arRecord)
+{
+    if (apLine == nullptr)
+    {
+        return false;
+    }
+
+    /* Skip prefix */
+    if (strncmp(apLine, mcRecordPrefix, strlen(mcRecordPrefix)) == 0)
+    {
+        apLine += strlen(mcRecordPrefix);
+    }
+
+    uint8_t* wpBytes = reinterpret_cast<uint8_t*>(&arRecord);
+    for (uint8_t wI = 0; wI < sizeof(tRecord); wI++)
+    {
+        int8_t wHigh = HexDigitValue(apLine[2 * wI]);
+        int8_t wLow  = (wHigh >= 0) ? HexDigitValue(apLine[2 * wI + 1]) : -1;
+        if (wLow < 0)
+        {
+            return false;
+        }
+        wpBytes[wI] = static_cast<uint8_t>((wHigh << 4) | wLow);
+    }
+
+    return true;
+}
+
+
+/**
+ *
+ * Implementation of the BusRecorderNS::BusReplayer class
+ *
+ */
+BusReplayer::BusReplayer(CommunicationNS::CommunicationManager* apCommunicationManager)
+    : mpCommunicationManager(apCommunicationManager)
+{
+    // do nothing
+}
+
+BusReplayer::~BusReplayer()
+{
+    mpCommunicationManager = nullptr;
+}
+
+/**
+ * @brief Replays a recorded trace in the context of the calling task.
+ *
+ * @param apRecords Records of the trace, oldest first
+ * @param aCount Number of records
+ * @param aTimeScalePercent Scale of the recorded gaps between messages in percent
+ * @return Number of injected messages
+ */
+uint32_t BusReplayer::Replay(const tRecord* apRecords, uint32_t aCount, uint16_t aTimeScalePercent)
+{
+    uint32_t wInjected = 0;
+    bool     wFirst    = true;
+    uint32_t wPreviousTimestampUs = 0;
+
+    if ((apRecords == nullptr) || (mpCommunicationManager == nullptr))
+    {
+        return 0;
+    }
+
+    for (uint32_t wIndex = 0; wIndex < aCount; wIndex++)
+    {
+        const tRecord& wRecord = apRecords[wIndex];
+
+        if ((wRecord.mEvent != RECORD_SEND) && (wRecord.mEvent != RECORD_PUBLISH))
+        {
+            continue;
+        }
+
+        if ((wRecord.mSource >= MessageNS::tAddress::NB_OF_ADDRESSES) ||
+            (wRecord.mId >= MessageNS::tMessageId::NB_OF_MESSAGE_IDS) ||
+            ((wRecord.mEvent == RECORD_SEND) && (wRecord.mDestination >= MessageNS::tAddress::NB_OF_ADDRESSES)))
+        {
+            LOG(LOG_WARN, "BusReplayer::Replay() Invalid record %lu skipped", static_cast<unsigned long>(wIndex));
+            continue;
+        }
+
+        if (wRecord.mPayloadType != MessageNS::tPayloadType::PAYLOAD_INLINE)
+        {
+            LOG(LOG_WARN, "BusReplayer::Replay() Record %lu with buffer payload skipped",
+                    static_cast<unsigned long>(wIndex));
+            continue;
+        }
+
+        /* Reproduce the gap to the previous message */
+        if (wFirst == false)
+        {
+            uint32_t wDelayUs = static_cast<uint32_t>(
+                    (static_cast<uint64_t>(wRecord.mTimestampUs - wPreviousTimestampUs) * aTimeScalePercent) / 100);
+
+            if (wDelayUs >= 1000)
+            {
+                vTaskDelay(pdMS_TO_TICKS(wDelayUs / 1000));
+            }
+            else if (wDelayUs > 0)
+            {
+                delayMicroseconds(wDelayUs);
+            }
+        }
+        wFirst = false;
+        wPreviousTimestampUs = wRecord.mTimestampUs;
+
+        /* Rebuild and inject the message */
+        MessageNS::Message wMessage;
+        wMessage.mSource        = static_cast<MessageNS::tAddress>(wRecord.mSource);
+        wMessage.mDestination   = static_cast<MessageNS::tAddress>(wRecord.mDestination);
+        wMessage.mId            = static_cast<MessageNS::tMessageId>(wRecord.mId);
+        wMessage.mCorrelationId = wRecord.mCorrelationId;
+        wMessage.mPayloadType   = MessageNS::tPayloadType::PAYLOAD_INLINE;
+        wMessage.mPayloadLength = wRecord.mPayloadLength;
+        memcpy(wMessage.mPayload, wRecord.mPayload, sizeof(wMessage.mPayload));
+
+        if (wRecord.mEvent == RECORD_SEND)
+        {
+            mpCommunicationManager->SendMessage(wMessage);
+        }
+        else
+        {
+            mpCommunicationManager->PublishMessage(wMessage);
+        }
+
+        wInjected++;
+    }
+
+    return wInjected;
+}
+
+}   /* end of namespace BusRecorderNS */
@@ -0,0 +1,123 @@
+/*
+ * BusRecorder.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "Message.h"
+#include "Communication.h"
+
+
+namespace BusRecorderNS
+{
+    /**
+     * @brief Event of a recorded message
+     */
+    enum tRecordEvent : uint8_t
+    {
+        /** @brief Message sent point-to-point with CommunicationManager::SendMessage() */
+        RECORD_SEND = 0x00,
+        /** @brief Message published with CommunicationManager::PublishMessage() */
+        RECORD_PUBLISH,
+        /** @brief Message taken from the queue and dispatched by the receiving task */
+        RECORD_DISPATCH,
+    };
+
+    /**
+     * @brief Binary record of a message (15 bytes)
+     */
+    struct __attribute__((packed)) tRecord
+    {
+        /** @brief Time of the event in microseconds */
+        uint32_t     mTimestampUs;
+        /** @brief Event, see tRecordEvent */
+        uint8_t      mEvent;
+        /* Message header and payload */
+        uint8_t      mSource;
+        uint8_t      mDestination;
+        uint8_t      mId;
+        uint8_t      mCorrelationId;
+        uint8_t      mPayloadType;
+        uint8_t      mPayloadLength;
+        uint8_t      mPayload[MessageNS::mMessagePayloadLen];
+    };
+
+    /** @brief Number of records kept in the ring buffer (power of two) */
+    static constexpr uint16_t mRecordCount = 256;
+
+    static_assert((mRecordCount & (mRecordCount - 1)) == 0, "Record count must be a power of two");
+
+    /**
+     * @brief Records the message bus traffic into a ring buffer.
+     *
+     * @details
+     * The communication manager records every sent and published message, the tasks record
+     * every message they dispatch, each with a microsecond timestamp. The latest mRecordCount
+     * records are kept, older ones are overwritten. A slot is reserved with a single atomic
+     * increment, so recording is cheap and can be done from any task.
+     *
+     * Dump() prints the records on the serial console, one record per line as hex string
+     * prefixed with "[REC]". ParseRecord() converts such a line back to a record, so a
+     * captured trace can be fed into BusReplayer.
+     *
+     * Recording is only compiled in with the build flag USE_BUS_RECORDER=true, see BUS_RECORD().
+     */
+    class BusRecorder
+    {
+    public:
+        BusRecorder();
+        virtual ~BusRecorder();
+
+        void Record(tRecordEvent aEvent, const MessageNS::Message& arMessage);
+        void Clear(void);
+        void Dump(void);
+
+        static bool ParseRecord(const char* apLine, tRecord& arRecord);
+
+    private:
+        tRecord mRecords[mRecordCount];
+
+        /** @brief Total number of records written */
+        std::atomic<uint32_t> mWriteCount;
+        /** @brief Recording enabled, disabled while the records are dumped */
+        std::atomic<bool>     mEnabled;
+    };
+
+    /**
+     * @brief Feeds a recorded trace back into the message bus.
+     *
+     * @details
+     * Sent and published messages of the trace are injected in their recorded order through
+     * the communication manager, dispatch records are skipped as the tasks dispatch the injected
+     * messages themselves. The recorded gaps between the messages are reproduced, scaled by a
+     * percentage (100 = original timing, 0 = back-to-back). Messages carrying a pool buffer
+     * are skipped, the buffer content is not part of the trace.
+     */
+    class BusReplayer
+    {
+    public:
+        BusReplayer(CommunicationNS::CommunicationManager* apCommunicationManager);
+        virtual ~BusReplayer();
+
+        uint32_t Replay(const tRecord* apRecords, uint32_t aCount, uint16_t aTimeScalePercent = 100);
+
+    private:
+        CommunicationNS::CommunicationManager* mpCommunicationManager;
+    };
+
+}   /* end of namespace BusRecorderNS */
+
+
+#if (USE_BUS_RECORDER == true)
+    /* Declare the object as extern for global access  */
+    extern BusRecorderNS::BusRecorder BusRecorder;
+
+    #define BUS_RECORD(event, message)      BusRecorder.Record((event), (message))
+#else
+    #define BUS_RECORD(event, message)
+#endif /* (USE_BUS_RECORDER == true) */
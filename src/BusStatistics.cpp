@@ -0,0 +1,152 @@
+/*
+ * BusStatistics.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "BufferPool.h"
+
+#include "BusStatistics.h"
+
+
+namespace BusStatisticsNS
+{
+/**
+ * @brief Constructor
+ */
+BusStatistics::BusStatistics()
+{
+    // do nothing
+}
+
+/**
+ * @brief Destructor
+ */
+BusStatistics::~BusStatistics()
+{
+    // do nothing
+}
+
+/**
+ * @brief Registers the message queue of a module.
+ *
+ * @param aAddress Address of the module
+ * @param apMessageQueue Message queue of the module
+ * @param apCoalescer Optional coalescer of the message queue
+ */
+void BusStatistics::Register(MessageNS::tAddress aAddress, const ApplicationNS::MessageQueue* apMessageQueue,
+        const ApplicationNS::MessageCoalescer* apCoalescer)
+{
+    if (aAddress < MessageNS::tAddress::NB_OF_ADDRESSES)
+    {
+        mEntries[aAddress].mpMessageQueue = apMessageQueue;
+        mEntries[aAddress].mpCoalescer    = apCoalescer;
+    }
+}
+
+/**
+ * @brief Returns the message bus statistics of a module.
+ *
+ * @param aAddress Address of the module
+ * @param arStatistics Statistics aggregated over all lanes of the module queue
+ * @return true if a queue is registered for the address, false otherwise
+ */
+bool BusStatistics::GetStatistics(MessageNS::tAddress aAddress, tAddressStatistics& arStatistics) const
+{
+    if ((aAddress >= MessageNS::tAddress::NB_OF_ADDRESSES) ||
+        (mEntries[aAddress].mpMessageQueue == nullptr))
+    {
+        return false;
+    }
+
+    const tEntry& wEntry = mEntries[aAddress];
+
+    arStatistics = {};
+    arStatistics.mLaneSize = wEntry.mpMessageQueue->GetLaneSize();
+
+    for (uint8_t wLane = 0; wLane < ApplicationNS::NB_OF_LANES; wLane++)
+    {
+        ApplicationNS::tLaneStatistics wLaneStatistics =
+                wEntry.mpMessageQueue->GetStatistics(static_cast<ApplicationNS::tMessageLane>(wLane));
+
+        arStatistics.mEnqueued += wLaneStatistics.mEnqueued;
+        arStatistics.mDropped  += wLaneStatistics.mDropped;
+        if (wLaneStatistics.mHighWaterMark > arStatistics.mHighWaterMark)
+        {
+            arStatistics.mHighWaterMark = wLaneStatistics.mHighWaterMark;
+        }
+    }
+
+    if (wEntry.mpCoalescer != nullptr)
+    {
+        arStatistics.mMerged = wEntry.mpCoalescer->GetMergedCount();
+    }
+
+    arStatistics.mLatency = wEntry.mpMessageQueue->GetLatencyHistogram();
+
+    return true;
+}
+
+/**
+ * @brief Prints the message bus statistics of all modules on the serial console.
+ *
+ * @details
+ * Independent of the log configuration, so the statistics are also available in release builds.
+ */
+void BusStatistics::Dump(void) const
+{
+    Serial.printf("[BUS] Message bus statistics at %lu ms\r\n", static_cast<unsigned long>(millis()));
+
+    for (uint8_t wAddress = 0; wAddress < MessageNS::tAddress::NB_OF_ADDRESSES; wAddress++)
+    {
+        tAddressStatistics wStatistics;
+        if (GetStatistics(static_cast<MessageNS::tAddress>(wAddress), wStatistics) == false)
+        {
+            continue;
+        }
+
+        Serial.printf("[BUS] %-9s enqueued %lu, dropped %lu, merged %lu, high-water %u/%u\r\n",
+                MessageNS::AddressToString(static_cast<MessageNS::tAddress>(wAddress)),
+                static_cast<unsigned long>(wStatistics.mEnqueued),
+                static_cast<unsigned long>(wStatistics.mDropped),
+                static_cast<unsigned long>(wStatistics.mMerged),
+                wStatistics.mHighWaterMark, wStatistics.mLaneSize);
+
+        const ApplicationNS::MessageQueue* wpMessageQueue = mEntries[wAddress].mpMessageQueue;
+        for (uint8_t wLane = 0; wLane < ApplicationNS::NB_OF_LANES; wLane++)
+        {
+            ApplicationNS::tLaneStatistics wLaneStatistics =
+                    wpMessageQueue->GetStatistics(static_cast<ApplicationNS::tMessageLane>(wLane));
+
+            Serial.printf("[BUS]   lane %u: depth %u, high-water %u, dropped %lu, wait avg %lu us, max %lu us\r\n",
+                    wLane, wLaneStatistics.mDepth, wLaneStatistics.mHighWaterMark,
+                    static_cast<unsigned long>(wLaneStatistics.mDropped),
+                    static_cast<unsigned long>(wLaneStatistics.mAverageWaitUs),
+                    static_cast<unsigned long>(wLaneStatistics.mMaxWaitUs));
+        }
+
+        /* Print non-empty histogram buckets with their upper bound */
+        Serial.printf("[BUS]   wait us:");
+        for (uint8_t wBucket = 0; wBucket < ApplicationNS::mLatencyHistogramBuckets; wBucket++)
+        {
+            uint32_t wCount = wStatistics.mLatency.mBuckets[wBucket];
+            if (wCount != 0)
+            {
+                Serial.printf(" %s%lu:%lu",
+                        (wBucket == (ApplicationNS::mLatencyHistogramBuckets - 1)) ? ">=" : "<",
+                        static_cast<unsigned long>(static_cast<uint32_t>(1) <<
+                                ((wBucket == (ApplicationNS::mLatencyHistogramBuckets - 1)) ? (wBucket - 1) : wBucket)),
+                        static_cast<unsigned long>(wCount));
+            }
+        }
+        Serial.printf("\r\n");
+    }
+
+    BufferPoolNS::tPoolStatistics wPoolStatistics = BufferPool.GetStatistics();
+    Serial.printf("[BUS] Buffer pool: in use %u/%u, high-water %u, allocations %lu, exhaustions %lu\r\n",
+            wPoolStatistics.mBlocksInUse, BufferPoolNS::mBufferBlockCount, wPoolStatistics.mHighWaterMark,
+            static_cast<unsigned long>(wPoolStatistics.mAllocations),
+            static_cast<unsigned long>(wPoolStatistics.mExhaustions));
+}
+
+}   /* end of namespace BusStatisticsNS */
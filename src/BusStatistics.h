@@ -0,0 +1,75 @@
+/*
+ * BusStatistics.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include "Message.h"
+#include "MessageQueue.h"
+#include "MessageCoalescer.h"
+
+
+namespace BusStatisticsNS
+{
+    /**
+     * @brief Message bus statistics of a module address
+     */
+    struct tAddressStatistics
+    {
+        /** @brief Number of messages added to the queue */
+        uint32_t mEnqueued;
+        /** @brief Number of messages dropped because the queue was full */
+        uint32_t mDropped;
+        /** @brief Number of messages merged into pending ones by the coalescer */
+        uint32_t mMerged;
+        /** @brief Highest depth reached by any lane of the queue */
+        uint8_t  mHighWaterMark;
+        /** @brief Number of messages per lane */
+        uint8_t  mLaneSize;
+        /** @brief Enqueue-to-dispatch wait time histogram */
+        ApplicationNS::tLatencyHistogram mLatency;
+    };
+
+    /**
+     * @brief Collects the message bus statistics of all modules.
+     *
+     * @details
+     * The counters themselves are kept by the message queues and coalescers of the tasks,
+     * so collecting them costs a few atomic increments per message. This class only knows
+     * which queue belongs to which address and aggregates the counters on request, either
+     * through GetStatistics() or as a dump on the serial console.
+     *
+     * Queues shall be registered during the application initialization.
+     */
+    class BusStatistics
+    {
+    public:
+        BusStatistics();
+        virtual ~BusStatistics();
+
+        void Register(MessageNS::tAddress aAddress, const ApplicationNS::MessageQueue* apMessageQueue,
+                const ApplicationNS::MessageCoalescer* apCoalescer = nullptr);
+
+        bool GetStatistics(MessageNS::tAddress aAddress, tAddressStatistics& arStatistics) const;
+
+        void Dump(void) const;
+
+    private:
+        /** @brief Registered objects of a module */
+        struct tEntry
+        {
+            const ApplicationNS::MessageQueue*     mpMessageQueue;
+            const ApplicationNS::MessageCoalescer* mpCoalescer;
+        };
+
+        tEntry mEntries[MessageNS::tAddress::NB_OF_ADDRESSES] = {};
+    };
+
+}   /* end of namespace BusStatisticsNS */
+
+/* Declare the object as extern for global access  */
+extern BusStatisticsNS::BusStatistics BusStatistics;
@@ -0,0 +1,101 @@
+/*
+ * ClockSnapshot.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <cstring>
+
+#include "ClockSnapshot.h"
+
+
+namespace ClockSnapshotNS
+{
+
+/**
+ *
+ * Implementation of the ClockSnapshotNS::ClockSnapshot class
+ *
+ */
+ClockSnapshot::ClockSnapshot()
+    : mSequence(0)
+{
+    /* Both slots hold a zero state, the clock is not synchronized */
+    for (auto& wSlot : mSlots)
+    {
+        for (std::atomic<uint32_t>& wWord : wSlot)
+        {
+            wWord.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+ClockSnapshot::~ClockSnapshot()
+{
+    // do nothing
+}
+
+/**
+ * @brief Publishes a new clock state, only called by the TimeManager task.
+ *
+ * @param arState Clock state to publish
+ */
+void ClockSnapshot::Publish(const tClockState& arState)
+{
+    uint32_t wWords[mSlotWords] = {};
+    memcpy(wWords, &arState, sizeof(arState));
+
+    /* Write the slot which is not read by new readers */
+    uint32_t wSequence = mSequence.load(std::memory_order_relaxed);
+    std::atomic<uint32_t>* wpSlot = mSlots[(wSequence + 1) & 1];
+
+    /* Order the last publication before the writes, a reader which sees them also sees the new sequence number */
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t wI = 0; wI < mSlotWords; wI++)
+    {
+        wpSlot[wI].store(wWords[wI], std::memory_order_relaxed);
+    }
+
+    /* Make the written slot the current one */
+    mSequence.store(wSequence + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the last published clock state (any task or ISR).
+ */
+tClockState ClockSnapshot::Read(void) const
+{
+    uint32_t wWords[mSlotWords];
+    uint32_t wSequence;
+
+    do
+    {
+        wSequence = mSequence.load(std::memory_order_acquire);
+        const std::atomic<uint32_t>* wpSlot = mSlots[wSequence & 1];
+
+        for (size_t wI = 0; wI < mSlotWords; wI++)
+        {
+            wWords[wI] = wpSlot[wI].load(std::memory_order_relaxed);
+        }
+
+        /* Order the copy before the check of the sequence number */
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    while (mSequence.load(std::memory_order_relaxed) != wSequence);
+
+    tClockState wState;
+    memcpy(&wState, wWords, sizeof(wState));
+
+    return wState;
+}
+
+/**
+ * @brief Returns the number of published states, readers can poll it to detect changes.
+ */
+uint32_t ClockSnapshot::GetSequence(void) const
+{
+    return mSequence.load(std::memory_order_acquire);
+}
+
+}   /* end of namespace ClockSnapshotNS */
@@ -0,0 +1,97 @@
+/*
+ * ClockSnapshot.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+
+#include "DateTime.h"
+
+
+namespace ClockSnapshotNS
+{
+    /**
+     * @brief Synchronization quality of the clock
+     */
+    enum tSyncQuality : uint8_t
+    {
+        /** @brief Clock was never synchronized, the time is not valid */
+        CLOCK_NOT_SYNCED = 0x00,
+        /** @brief Last NTP synchronization is older than mStaleSyncPeriods sync periods */
+        CLOCK_SYNC_STALE,
+        /** @brief Clock is synchronized by NTP */
+        CLOCK_SYNCED
+    };
+
+    /** @brief Number of missed NTP sync periods after which the synchronization is stale */
+    static constexpr uint32_t mStaleSyncPeriods = 3;
+
+    /**
+     * @brief Published state of the clock
+     */
+    struct tClockState
+    {
+        /** @brief Local date and time at the publication, updated at least every minute */
+        DateTimeNS::tDateTime mLocalTime;
+        /** @brief System time (seconds since epoch, UTC) of mLocalTime */
+        uint32_t              mUtcTime;
+        /** @brief Offset of the local time to UTC in minutes, including DST */
+        int16_t               mUtcOffsetMinutes;
+        /** @brief Daylight saving time is in effect */
+        bool                  mDst;
+        /** @brief Synchronization quality of the clock */
+        tSyncQuality          mSyncQuality;
+        /** @brief System time (seconds since epoch, UTC) of the last NTP sync, 0 if never synchronized */
+        uint32_t              mLastSync;
+    };
+
+    static_assert(std::is_trivially_copyable<tClockState>::value, "Clock state must be trivially copyable");
+
+    /**
+     * @brief Seqlock protected snapshot of the clock state.
+     *
+     * @details
+     * The TimeManager is the only writer and publishes the clock state at every minute change,
+     * after a NTP synchronization and after the time zone changed. Any task or ISR can read the
+     * last published state with Read(), without messages on the bus and without the time zone
+     * conversions of the C library.
+     *
+     * The state is kept in two slots. Publish() writes the slot which is not the current one and
+     * then increments the sequence number, which selects the current slot. A reader copies the
+     * current slot and checks afterwards that the sequence number is unchanged, otherwise the
+     * writer may have started to overwrite the copied slot and the copy is repeated. Readers never
+     * wait for the writer: a reader which interrupts the writer on the same core copies the slot
+     * which is not written, and a retry is only needed when two publications overlap the copy.
+     *
+     * The slots are stored as atomic words, so the copy is free of data races in the C++ memory model.
+     */
+    class ClockSnapshot
+    {
+    public:
+        ClockSnapshot();
+        virtual ~ClockSnapshot();
+
+        void Publish(const tClockState& arState);
+
+        tClockState Read(void) const;
+        uint32_t GetSequence(void) const;
+
+    private:
+        /** @brief Number of words of a slot */
+        static constexpr size_t mSlotWords = (sizeof(tClockState) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+        /** @brief Number of published states, the last one is in the slot (mSequence & 1) */
+        std::atomic<uint32_t> mSequence;
+
+        std::atomic<uint32_t> mSlots[2][mSlotWords];
+    };
+
+}   /* end of namespace ClockSnapshotNS */
+
+/* Declare the object as extern for global access  */
+extern ClockSnapshotNS::ClockSnapshot ClockSnapshot;
@@ -6,6 +6,8 @@
  */
 
 #include "Communication.h"
+#include "BufferPool.h"
+#include "BusRecorder.h"
 #include <cassert>
 
 namespace CommunicationNS
@@ -37,18 +39,159 @@ void CommunicationManager::RegisterCallback(MessageNS::tAddress aAddress, Notifi
     }
 }
 
+/**
+ * @brief Subscribes a module to a message ID.
+ *
+ * @details
+ * All messages with the given ID published by PublishMessage() will be delivered to the
+ * callback registered for the address.
+ *
+ * @param aMessageId ID of the message to subscribe to
+ * @param aAddress Address of the subscribing module
+ */
+void CommunicationManager::Subscribe(MessageNS::tMessageId aMessageId, MessageNS::tAddress aAddress)
+{
+    /* Check input arguments */
+    if ((aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) &&
+        (aAddress   < MessageNS::tAddress::NB_OF_ADDRESSES))
+    {
+        /* Add module to the subscribers */
+        mSubscribers[aMessageId] |= (static_cast<tSubscriberMask>(1) << aAddress);
+    }
+}
+
+/**
+ * @brief Removes the subscription of a module to a message ID.
+ *
+ * @param aMessageId ID of the subscribed message
+ * @param aAddress Address of the subscribed module
+ */
+void CommunicationManager::Unsubscribe(MessageNS::tMessageId aMessageId, MessageNS::tAddress aAddress)
+{
+    /* Check input arguments */
+    if ((aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) &&
+        (aAddress   < MessageNS::tAddress::NB_OF_ADDRESSES))
+    {
+        /* Remove module from the subscribers */
+        mSubscribers[aMessageId] &= ~(static_cast<tSubscriberMask>(1) << aAddress);
+    }
+}
+
+/**
+ * @brief Returns the set of modules subscribed to a message ID.
+ *
+ * @param aMessageId ID of the message
+ * @return Bitmask of subscribers, bit N is set if the module with address N is subscribed
+ */
+tSubscriberMask CommunicationManager::GetSubscribers(MessageNS::tMessageId aMessageId) const
+{
+    return (aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) ? mSubscribers[aMessageId] : 0;
+}
+
+/**
+ * @brief Subscribes a module to a fast event.
+ *
+ * @param aEvent Fast event to subscribe to
+ * @param aAddress Address of the subscribing module
+ */
+void CommunicationManager::SubscribeFastEvent(MessageNS::tFastEvent aEvent, MessageNS::tAddress aAddress)
+{
+    /* Check input arguments */
+    if ((aEvent   < MessageNS::tFastEvent::NB_OF_FAST_EVENTS) &&
+        (aAddress < MessageNS::tAddress::NB_OF_ADDRESSES))
+    {
+        /* Add module to the subscribers */
+        mFastEventSubscribers[aEvent] |= (static_cast<tSubscriberMask>(1) << aAddress);
+    }
+}
+
 void CommunicationManager::SendMessage(const MessageNS::Message & apMessage) const
 {
     /* Check addresses */
     assert(apMessage.mSource      < MessageNS::tAddress::NB_OF_ADDRESSES);
     assert(apMessage.mDestination < MessageNS::tAddress::NB_OF_ADDRESSES);
 
+    BUS_RECORD(BusRecorderNS::RECORD_SEND, apMessage);
+
     /* Check if a callback is exist */
     if(mpRegisteredCallbacks[apMessage.mDestination])
     {
+        /* Take a buffer reference for the receiver */
+        BufferPool.AddReference(BufferPoolNS::GetBuffer(apMessage));
+
         /* Call registered callback */
         mpRegisteredCallbacks[apMessage.mDestination]->NotifyMessage(apMessage);
     }
 }
 
+/**
+ * @brief Publishes a message to all modules subscribed to its ID.
+ *
+ * @details
+ * The destination of the message is ignored, each subscriber receives a copy of the
+ * message with the destination set to its own address. The publisher itself receives
+ * the message too if it is subscribed to the message ID. A buffer attached to the message
+ * is shared, one reference is taken for each subscriber.
+ *
+ * @param arMessage Message to publish
+ */
+void CommunicationManager::PublishMessage(const MessageNS::Message & arMessage) const
+{
+    /* Check source address and message ID */
+    assert(arMessage.mSource < MessageNS::tAddress::NB_OF_ADDRESSES);
+    assert(arMessage.mId     < MessageNS::tMessageId::NB_OF_MESSAGE_IDS);
+
+    BUS_RECORD(BusRecorderNS::RECORD_PUBLISH, arMessage);
+
+    MessageNS::Message wMessage = arMessage;
+    tSubscriberMask    wSubscribers = mSubscribers[arMessage.mId];
+
+    /* Deliver a copy to each subscriber, lowest address first */
+    while (wSubscribers != 0)
+    {
+        /* Get address of the next subscriber and remove it from the set */
+        uint8_t wAddress = static_cast<uint8_t>(__builtin_ctz(wSubscribers));
+        wSubscribers &= (wSubscribers - 1);
+
+        if (mpRegisteredCallbacks[wAddress])
+        {
+            /* Take a buffer reference for the subscriber */
+            BufferPool.AddReference(BufferPoolNS::GetBuffer(wMessage));
+
+            wMessage.mDestination = static_cast<MessageNS::tAddress>(wAddress);
+            mpRegisteredCallbacks[wAddress]->NotifyMessage(wMessage);
+        }
+    }
+}
+
+/**
+ * @brief Publishes a fast event to all modules subscribed to it.
+ *
+ * @details
+ * Each subscriber only gets the notification bit of the event set, no message is copied or
+ * queued. An event which is still pending at a subscriber is not signalled twice.
+ *
+ * @param aEvent Fast event to publish
+ */
+void CommunicationManager::PublishFastEvent(MessageNS::tFastEvent aEvent) const
+{
+    /* Check event */
+    assert(aEvent < MessageNS::tFastEvent::NB_OF_FAST_EVENTS);
+
+    tSubscriberMask wSubscribers = mFastEventSubscribers[aEvent];
+
+    /* Signal each subscriber, lowest address first */
+    while (wSubscribers != 0)
+    {
+        /* Get address of the next subscriber and remove it from the set */
+        uint8_t wAddress = static_cast<uint8_t>(__builtin_ctz(wSubscribers));
+        wSubscribers &= (wSubscribers - 1);
+
+        if (mpRegisteredCallbacks[wAddress])
+        {
+            mpRegisteredCallbacks[wAddress]->NotifyFastEvent(aEvent);
+        }
+    }
+}
+
 }   /* end of namespace CommunicationNS */
\ No newline at end of file
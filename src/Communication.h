@@ -18,8 +18,33 @@ class NotificationCallback
 {
 public:
     virtual void NotifyMessage(const MessageNS::Message & arMessage) = 0;
+    virtual void NotifyFastEvent(MessageNS::tFastEvent aEvent) = 0;
 };
 
+/**
+ * @brief Set of subscribers, bit N is set if the module with address N is subscribed.
+ */
+typedef uint32_t tSubscriberMask;
+
+static_assert(MessageNS::tAddress::NB_OF_ADDRESSES <= (sizeof(tSubscriberMask) * 8),
+        "tSubscriberMask is too small for all addresses");
+
+/**
+ * @brief Routes messages between the registered modules.
+ *
+ * @details
+ * Messages are either sent point-to-point with SendMessage() to the address given in the
+ * message destination, or published with PublishMessage() to every module subscribed to the
+ * message ID. The subscriber set of each message ID is kept as a bitmask in a table indexed
+ * by the message ID, so a publish resolves its receivers in O(1) and only delivers copies to
+ * modules which are interested in the message.
+ *
+ * Fast events are published with PublishFastEvent() to every module subscribed to the event
+ * with SubscribeFastEvent(). They carry no payload and are not recorded by the bus recorder.
+ *
+ * Callbacks and subscriptions shall be registered during the application initialization,
+ * before the tasks are started. The tables are only read afterwards and need no locking.
+ */
 class CommunicationManager
 {
 public:
@@ -28,14 +53,33 @@ public:
 
     virtual void RegisterCallback(MessageNS::tAddress aAddress, NotificationCallback * apCallback);
 
+    virtual void Subscribe(MessageNS::tMessageId aMessageId, MessageNS::tAddress aAddress);
+    virtual void Unsubscribe(MessageNS::tMessageId aMessageId, MessageNS::tAddress aAddress);
+
+    tSubscriberMask GetSubscribers(MessageNS::tMessageId aMessageId) const;
+
+    virtual void SubscribeFastEvent(MessageNS::tFastEvent aEvent, MessageNS::tAddress aAddress);
+
     void SendMessage(const MessageNS::Message & apMessage) const;
+    void PublishMessage(const MessageNS::Message & arMessage) const;
+    void PublishFastEvent(MessageNS::tFastEvent aEvent) const;
 
 private:
     /**
      * Include all registered callbacks. The position in the array represent the
      * address of the module.
      */
-    NotificationCallback* mpRegisteredCallbacks[MessageNS::tAddress::NB_OF_ADDRESSES];
+    NotificationCallback* mpRegisteredCallbacks[MessageNS::tAddress::NB_OF_ADDRESSES] = {};
+
+    /**
+     * Subscribers of each message. The position in the array represent the message ID.
+     */
+    tSubscriberMask mSubscribers[MessageNS::tMessageId::NB_OF_MESSAGE_IDS] = {};
+
+    /**
+     * Subscribers of each fast event. The position in the array represent the fast event ID.
+     */
+    tSubscriberMask mFastEventSubscribers[MessageNS::tFastEvent::NB_OF_FAST_EVENTS] = {};
 };
 
 }; /* end of namespace CommunicationNS */
@@ -1,13 +0,0 @@
-/*
- * Configuration.cpp
- *
- *  Created on: 10.07.2026
- *      Author: hocki
- */
-#include "Configuration.h"
-
-namespace ConfigNS
-{
-    /** @brief List of WiFi scan results - single shared instance */
-    std::vector<tSSIDEntry> mSSSIDList;
-}
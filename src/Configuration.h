@@ -9,6 +9,7 @@
 #include <Arduino.h>
 
 #include "Application.h"
+#include "LedMapping.h"
 #include "Settings.hpp"
 
 
@@ -16,6 +17,19 @@
 using namespace ApplicationNS;
 
 
+/* Scheduling profiles of the tasks, selected with the build flag SCHEDULING_PROFILE */
+#define SCHEDULING_PROFILE_SHARED           0
+#define SCHEDULING_PROFILE_RENDER_ISOLATED  1
+
+#ifndef SCHEDULING_PROFILE
+#define SCHEDULING_PROFILE                  SCHEDULING_PROFILE_SHARED
+#endif
+
+#if (SCHEDULING_PROFILE == SCHEDULING_PROFILE_RENDER_ISOLATED) && (CONFIG_ASYNC_TCP_RUNNING_CORE == 1)
+#warning "Render-isolated scheduling profile: set CONFIG_ASYNC_TCP_RUNNING_CORE=0 to keep the web server off the display core"
+#endif
+
+
 namespace ConfigNS
 {
     /**
@@ -23,29 +37,272 @@ namespace ConfigNS
      */
 
     /** @brief Default task stack size of tasks */
-    static constexpr uint32_t    mDefaultTaskStackSize       = 2 * 1024;
+    static constexpr uint32_t      mDefaultTaskStackSize     = 2 * 1024;
     /** @brief Default priority of tasks */
     static constexpr tTaskPriority mDefaultTaskPriority      = FreeRTOScpp::TaskPrio_Low;
+    /** @brief Default core of tasks */
+    static constexpr BaseType_t    mDefaultTaskCore          = tskNO_AFFINITY;
+    /** @brief Default number of messages processed per wake-up */
+    static constexpr uint8_t       mDefaultTaskMessageBudget = mDefaultMessageBatchBudget;
+    /** @brief Default number of messages per lane of the task message queues */
+    static constexpr uint8_t       mDefaultTaskMessageLanes  = mDefaultMessageLaneSize;
+
+    /** @brief Core running the WiFi driver and the network stack */
+    static constexpr BaseType_t    mNetworkCore              = 0;
+    /** @brief Core running the Arduino loop, free of WiFi driver work */
+    static constexpr BaseType_t    mApplicationCore          = 1;
+
+    /** @brief Priority and core of a task */
+    struct tTaskScheduling
+    {
+        tTaskPriority mPriority;
+        BaseType_t    mCore;
+    };
+
+    /** @brief Priorities and cores of all tasks */
+    struct tSchedulingProfile
+    {
+        const char*     mpName;
+        tTaskScheduling mDisplay;
+        tTaskScheduling mTimeManager;
+        tTaskScheduling mWifiManager;
+        tTaskScheduling mWebSite;
+    };
+
+    /** @brief Scheduling profiles, indexed by the build flag SCHEDULING_PROFILE */
+    static constexpr tSchedulingProfile mcSchedulingProfiles[] = {
+        /* SCHEDULING_PROFILE_SHARED: all tasks at the default priority on any core */
+        {
+            "shared",
+            { mDefaultTaskPriority,       mDefaultTaskCore },   // Display
+            { mDefaultTaskPriority,       mDefaultTaskCore },   // Time manager
+            { mDefaultTaskPriority,       mDefaultTaskCore },   // WiFi manager
+            { mDefaultTaskPriority,       mDefaultTaskCore },   // Web site
+        },
+        /* SCHEDULING_PROFILE_RENDER_ISOLATED: the display alone on the application core at a higher priority,
+           the time manager above the network tasks on the network core */
+        {
+            "render-isolated",
+            { FreeRTOScpp::TaskPrio_HMI,  mApplicationCore },   // Display
+            { FreeRTOScpp::TaskPrio_HMI,  mNetworkCore },       // Time manager
+            { mDefaultTaskPriority,       mNetworkCore },       // WiFi manager
+            { mDefaultTaskPriority,       mNetworkCore },       // Web site
+        },
+    };
+
+    static_assert(SCHEDULING_PROFILE < (sizeof(mcSchedulingProfiles) / sizeof(mcSchedulingProfiles[0])),
+            "Unknown scheduling profile");
+
+    /** @brief Scheduling profile of the tasks */
+    static constexpr const tSchedulingProfile& mcSchedulingProfile = mcSchedulingProfiles[SCHEDULING_PROFILE];
 
     /* Display task configuration */
-    static constexpr tTaskPriority mDisplayTaskPriority      = mDefaultTaskPriority;
-    static constexpr uint32_t      mDisplayTaskStackSize     = mDefaultTaskStackSize;
-    static constexpr const char*   mDisplayTaskName          = "DisplayTask";
+    static constexpr MessageNS::tMessageId mcDisplaySubscriptions[] = {
+        MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED,
+    };
+    static constexpr MessageNS::tFastEvent mcDisplayFastEvents[] = {
+        MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED,
+    };
+    static constexpr tTaskConfig mcDisplayTask = {
+        "DisplayTask",                                      // Name
+        MessageNS::tAddress::DISPLAY_MANAGER,               // Address
+        mcSchedulingProfile.mDisplay.mPriority,             // Priority
+        mDefaultTaskStackSize,                              // Stack size
+        mcSchedulingProfile.mDisplay.mCore,                 // Core
+        mDefaultTaskMessageBudget,                          // Message batch budget
+        4,                                                  // Message lane size, one time event per minute
+        mcDisplaySubscriptions,                             // Subscriptions
+        sizeof(mcDisplaySubscriptions) / sizeof(mcDisplaySubscriptions[0]),
+        mcDisplayFastEvents,                                // Fast event subscriptions
+        sizeof(mcDisplayFastEvents) / sizeof(mcDisplayFastEvents[0])
+    };
 
     /* Time manager task configuration */
-    static constexpr tTaskPriority mTimeManagerTaskPriority  = mDefaultTaskPriority;
-    static constexpr uint32_t      mTimeManagerTaskStackSize = mDefaultTaskStackSize;
-    static constexpr const char*   mTimeManagerTaskName      = "TimeManagerTask";
+    static constexpr MessageNS::tMessageId mcTimeManagerSubscriptions[] = {
+        MessageNS::tMessageId::MSG_EVENT_WIFI_INTERNET_AVAILABLE,
+    };
+    static constexpr MessageNS::tFastEvent mcTimeManagerFastEvents[] = {
+        MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED,
+    };
+    static constexpr tTaskConfig mcTimeManagerTask = {
+        "TimeManagerTask",                                  // Name
+        MessageNS::tAddress::TIME_MANAGER,                  // Address
+        mcSchedulingProfile.mTimeManager.mPriority,         // Priority
+        mDefaultTaskStackSize,                              // Stack size
+        mcSchedulingProfile.mTimeManager.mCore,             // Core
+        mDefaultTaskMessageBudget,                          // Message batch budget
+        4,                                                  // Message lane size, internet events and requests
+        mcTimeManagerSubscriptions,                         // Subscriptions
+        sizeof(mcTimeManagerSubscriptions) / sizeof(mcTimeManagerSubscriptions[0]),
+        mcTimeManagerFastEvents,                            // Fast event subscriptions
+        sizeof(mcTimeManagerFastEvents) / sizeof(mcTimeManagerFastEvents[0])
+    };
 
     /* WiFi manager task configuration */
-    static constexpr tTaskPriority mWifiManagerTaskPriority  = mDefaultTaskPriority;
-    static constexpr uint32_t      mWifiManagerTaskStackSize = mDefaultTaskStackSize + 1024;  // Add extra stack for WiFi operations
-    static constexpr const char*   mWifiManagerTaskName      = "WifiManagerTask";
+    static constexpr tTaskConfig mcWifiManagerTask = {
+        "WifiManagerTask",                                  // Name
+        MessageNS::tAddress::WIFI_MANAGER,                  // Address
+        mcSchedulingProfile.mWifiManager.mPriority,         // Priority
+        mDefaultTaskStackSize + 1024,                       // Stack size, extra stack for WiFi operations
+        mcSchedulingProfile.mWifiManager.mCore,             // Core
+        mDefaultTaskMessageBudget,                          // Message batch budget
+        4,                                                  // Message lane size, commands of the web site
+        nullptr,                                            // Subscriptions
+        0,
+        nullptr,                                            // Fast event subscriptions
+        0
+    };
 
     /* Web site task configuration */
-    static constexpr tTaskPriority mWebSiteTaskPriority      = mDefaultTaskPriority;
-    static constexpr uint32_t      mWebSiteTaskStackSize     = mDefaultTaskStackSize;
-    static constexpr const char*   mWebSiteTaskName          = "WebSiteTask";
+    static constexpr MessageNS::tMessageId mcWebSiteSubscriptions[] = {
+        MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED,
+        MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED,
+        MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STARTED,
+        MessageNS::tMessageId::MSG_EVENT_WIFI_SCAN_DONE,
+    };
+    static constexpr MessageNS::tFastEvent mcWebSiteFastEvents[] = {
+        MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED,
+    };
+    static constexpr tTaskConfig mcWebSiteTask = {
+        "WebSiteTask",                                      // Name
+        MessageNS::tAddress::WEB_MANAGER,                   // Address
+        mcSchedulingProfile.mWebSite.mPriority,             // Priority
+        mDefaultTaskStackSize,                              // Stack size
+        mcSchedulingProfile.mWebSite.mCore,                 // Core
+        mDefaultTaskMessageBudget,                          // Message batch budget
+        mDefaultTaskMessageLanes,                           // Message lane size, bursts of WiFi and time events
+        mcWebSiteSubscriptions,                             // Subscriptions
+        sizeof(mcWebSiteSubscriptions) / sizeof(mcWebSiteSubscriptions[0]),
+        mcWebSiteFastEvents,                                // Fast event subscriptions
+        sizeof(mcWebSiteFastEvents) / sizeof(mcWebSiteFastEvents[0])
+    };
+
+
+    /**
+     * Message lanes
+     */
+    /** @brief Lane of a message ID in the task queues */
+    struct tLaneRule
+    {
+        MessageNS::tMessageId       mMessageId;
+        ApplicationNS::tMessageLane mLane;
+    };
+
+    /** @brief Lanes of the messages in the queues of all tasks, other messages are background events */
+    static constexpr tLaneRule mcLaneRules[] = {
+        /* The display has to be updated on the minute boundary */
+        { MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED,        ApplicationNS::LANE_CRITICAL },
+        /* Commands */
+        { MessageNS::tMessageId::CMD_WIFI_CONNECT,                  ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::CMD_WIFI_START_SCAN,               ApplicationNS::LANE_COMMAND  },
+        /* Requests and responses, the requester waits for them */
+        { MessageNS::tMessageId::REQ_WIFI_STATUS,                   ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::REQ_NTP_LAST_SYNC,                 ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::REQ_MINUTE_LATENCY,                ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::RSP_WIFI_STATUS,                   ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::RSP_NTP_LAST_SYNC,                 ApplicationNS::LANE_COMMAND  },
+        { MessageNS::tMessageId::RSP_MINUTE_LATENCY,                ApplicationNS::LANE_COMMAND  },
+    };
+
+
+    /**
+     * Request/response calls
+     */
+    /** @brief Timeout of requests to other tasks */
+    static constexpr uint32_t mRpcDefaultTimeoutMs = 500;
+
+
+    /**
+     * Message coalescing
+     */
+    /** @brief Coalescing policy of a message ID in the task queues */
+    struct tCoalescingRule
+    {
+        MessageNS::tMessageId            mMessageId;
+        ApplicationNS::tCoalescingPolicy mPolicy;
+    };
+
+    /** @brief Coalescing rules applied to the message queues of all tasks */
+    static constexpr tCoalescingRule mcCoalescingRules[] = {
+        /* Only the latest time has to be displayed */
+        { MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED,        ApplicationNS::COALESCE_LATEST_WINS },
+    };
+
+
+    /**
+     * Diagnostics configurations
+     */
+    /** @brief Period to serve the diagnostic outputs in the main loop */
+    static constexpr uint32_t mDiagnosticsPollPeriodMs   = 100;
+    /** @brief Period of the message bus statistics dump on the serial console (USE_BUS_STATISTICS_DUMP=true) */
+    static constexpr uint32_t mBusStatisticsDumpPeriodMs = 60 * 1000;   // 1 minute
+    /** @brief Serial console command to dump the recorded bus traffic (USE_BUS_RECORDER=true) */
+    static constexpr char     mBusRecorderDumpCommand    = 'r';
+    /** @brief Serial console command to clear the recorded bus traffic (USE_BUS_RECORDER=true) */
+    static constexpr char     mBusRecorderClearCommand   = 'c';
+    /** @brief Serial console command to dump the handler profile (USE_HANDLER_PROFILER=true) */
+    static constexpr char     mHandlerProfilerDumpCommand = 'p';
+    /** @brief Serial console command to start the scheduling benchmark (USE_SCHEDULING_BENCHMARK=true) */
+    static constexpr char     mSchedulingBenchmarkCommand = 'b';
+    /** @brief Duration of the scheduling benchmark, covers at least two minute changes */
+    static constexpr uint32_t mSchedulingBenchmarkDurationMs = 3 * 60 * 1000;   // 3 minutes
+    /** @brief Priority of the load tasks of the scheduling benchmark */
+    static constexpr tTaskPriority mSchedulingBenchmarkLoadPriority = mDefaultTaskPriority;
+    /** @brief Busy time of a load task per cycle of the scheduling benchmark */
+    static constexpr uint32_t mSchedulingBenchmarkLoadBusyMs = 9;
+    /** @brief Idle time of a load task per cycle of the scheduling benchmark */
+    static constexpr uint32_t mSchedulingBenchmarkLoadIdleMs = 1;
+
+
+    /**
+     * Task supervisor configurations (USE_TASK_SUPERVISOR=true)
+     */
+    /** @brief Period to check the tasks and feed the task watchdog */
+    static constexpr uint32_t mTaskSupervisorPeriodMs    = 500;
+    /** @brief Time in one handler invocation after which a task is stalled, below the task watchdog timeout */
+    static constexpr uint32_t mTaskStallTimeoutMs        = 3000;
+
+
+    /**
+     * LED panel configurations
+     */
+    /** @brief Wiring of the LED stripe behind the front panel, zigzag rows starting at the top right */
+    static constexpr LedMappingNS::tPanelLayout mcPanelLayout = {
+        LedMappingNS::WIRING_SERPENTINE,                    // Wiring
+        LedMappingNS::CORNER_TOP_RIGHT,                     // Start corner
+        LedMappingNS::ROTATION_0,                           // Rotation
+        false                                               // Mirror
+    };
+
+
+    /**
+     * Display transition configurations
+     */
+    /** @brief Target frame rate of the transitions, the frame period is rounded to the timer tick */
+    static constexpr uint32_t mDisplayFrameRate          = 50;
+    /** @brief CPU time to render and show a frame, the next frame is dropped when exceeded */
+    static constexpr uint32_t mDisplayFrameBudgetUs      = 10000;
+    /** @brief Duration of a transition between two times */
+    static constexpr uint32_t mDisplayTransitionMs       = 800;
+
+
+    /**
+     * Display refresh configurations
+     */
+    /** @brief Refresh rate of the temporal dithering, at most one refresh per timer tick, see also Display.cpp */
+    static constexpr uint32_t mDisplayRefreshRate        = 1000 / TimerServiceNS::mTimerTickMs;
+    /** @brief CPU time to dither a refresh (without the LED transfer), the next refresh is dropped when exceeded */
+    static constexpr uint32_t mDisplayRefreshBudgetUs    = 1000;
+    /** @brief Lowest frequency of the dither pattern of an LED which is not seen as flicker */
+    static constexpr uint32_t mDisplayFlickerFreeRate    = 50;
+    /** @brief Refreshes missing at runtime (percent) before the dithering is disabled, e.g. late timer ticks */
+    static constexpr uint32_t mDisplayRefreshTolerance   = 10;
+    /** @brief Bits of the fraction below one LED step shown by dithering, the pattern repeats every 2^bits refreshes */
+    static constexpr uint8_t  mDisplayDitherBits         = 1;
+    /** @brief Gamma of the colors from the settings, 1.0 shows them as set */
+    static constexpr float    mDisplayGamma              = 1.0f;
+    /** @brief Color correction of the LEDs (FastLED TypicalLEDStrip) */
+    static constexpr uint32_t mDisplayColorCorrection    = 0xFFB0F0;
 
 
     /**
@@ -81,6 +338,7 @@ namespace ConfigNS
     static const SettingsNS::tKey  mKeyDisplayClockMode             = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x00);
     static const SettingsNS::tKey  mKeyDisplayClockItIs             = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x01);
     static const SettingsNS::tKey  mKeyDisplayClockSingleMins       = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x02);
+    static const SettingsNS::tKey  mKeyDisplayTransition            = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x03);
     static const SettingsNS::tKey  mKeyDisplayColorTime             = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x10);
     static const SettingsNS::tKey  mKeyDisplayColorBkgd             = SettingsNS::tKey(mParamsConfig, mDisplayGroup, 0x11);
 
@@ -103,6 +361,7 @@ namespace ConfigNS
     static constexpr uint8_t  mDefaultDisplayClockMode              = 1;            // Rhein-Ruhr
     static constexpr bool     mDefaultDisplayClockItIs              = true;
     static constexpr bool     mDefaultDisplayClockSingleMins        = true;
+    static constexpr uint8_t  mDefaultDisplayTransition             = 1;            // Crossfade
     static constexpr uint32_t mDefaultDisplayColorTime              = 0x00FF00;     // Green
     static constexpr uint32_t mDefaultDisplayColorBkgd              = 0x000000;     // Black
 
@@ -138,6 +397,15 @@ namespace ConfigNS
         "Rhein-Ruhr"
     };
 
+    /* Items in the order of TransitionNS::tTransitionEffect */
+    static constexpr uint8_t mcTransitionItemsCount = 4;
+    static constexpr const char* mcTransitionItems[mcTransitionItemsCount] = {
+        "None",
+        "Crossfade",
+        "Fade through black",
+        "Wipe"
+    };
+
     static constexpr uint8_t mcNtpServerItemsCount = 10;
     static constexpr const char* mcNtpServerItems[mcNtpServerItemsCount] = {
         "pool.ntp.org",                     // NTP Pool Project servers
@@ -196,7 +464,7 @@ namespace ConfigNS
         /* WET  */  "WET0WEST,M3.5.0/1,M10.5.0",
     };
 
-    /** @brief Single WiFi scan result entry */
+    /** @brief Single WiFi scan result entry (sent as array in MSG_EVENT_WIFI_SCAN_DONE buffer) */
     struct tSSIDEntry
     {
         char     mSsid[33];        // Max SSID length is 32 + null terminator
@@ -204,8 +472,5 @@ namespace ConfigNS
         bool     mEncrypted;
     };
 
-    /** @brief List of WiFi scan results */
-    extern std::vector<tSSIDEntry> mSSSIDList;
-
 
 }   /* end of namespace ConfigNS */
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * Coroutine.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+#include "TimerService.h"
+
+
+namespace ApplicationNS
+{
+    class Coroutine;
+
+    /**
+     * @typedef tCoroutineBody
+     * @brief Body of a coroutine, written with the COROUTINE_xxx() macros.
+     */
+    typedef std::function<void(Coroutine& arCoroutine)> tCoroutineBody;
+
+    /**
+     * @brief Stackless coroutine of an application task.
+     *
+     * @details
+     * A coroutine lets a task write a sequence with waits, like "disconnect, wait 100 ms, set mode,
+     * wait, begin", as one linear function instead of splitting it across states and timers. The
+     * body is started with Task::StartCoroutine(). At every COROUTINE_DELAY() the body returns to the
+     * task loop, which keeps processing messages and timers, and is resumed by a timer of the task
+     * after the delay at the statement following the wait.
+     *
+     * The coroutine is a protothread: only the resume point is stored, the body has no stack of its
+     * own. Therefore:
+     * - local variables of the body are not kept across waits, use members of the task instead,
+     * - waits must not be placed inside a switch statement of the body,
+     * - only the body itself can wait, not functions called by it.
+     *
+     * Example:
+     * @code
+     *     void MyTask::Flow(ApplicationNS::Coroutine& arCoroutine)
+     *     {
+     *         COROUTINE_BEGIN(arCoroutine);
+     *         StepOne();
+     *         COROUTINE_DELAY(arCoroutine, 100);
+     *         StepTwo();
+     *         COROUTINE_END(arCoroutine);
+     *     }
+     * @endcode
+     */
+    class Coroutine
+    {
+    public:
+        /** @brief Resume point of a coroutine which is not running */
+        static constexpr uint16_t mNotRunning = 0xFFFF;
+
+        /** @brief Index of a coroutine not registered at a task */
+        static constexpr uint8_t mNotRegistered = 0xFF;
+
+        Coroutine(tCoroutineBody aBody) : mBody(aBody)
+        {
+            // do nothing
+        }
+
+        /** @brief Returns true while the coroutine is started and not finished */
+        bool IsRunning(void) const { return (mResumePoint != mNotRunning); }
+
+        /** @brief Line of the body to resume at, 0 to start, used by the COROUTINE_xxx() macros */
+        uint16_t mResumePoint = mNotRunning;
+        /** @brief Delay in milliseconds before the body is resumed, set by COROUTINE_DELAY() */
+        uint32_t mResumeDelayMs = 0;
+
+    private:
+        friend class Task;
+
+        /** @brief Body of the coroutine */
+        tCoroutineBody               mBody;
+        /** @brief Index of the coroutine at its task */
+        uint8_t                      mIndex = mNotRegistered;
+        /** @brief Timer resuming the body */
+        TimerServiceNS::tTimerHandle mTimer = TimerServiceNS::mInvalidTimerHandle;
+    };
+
+}; /* end of namespace ApplicationNS */
+
+
+/**
+ * @brief Starts the body of a coroutine, the first statement of the body.
+ */
+#define COROUTINE_BEGIN(coroutine) \
+        switch ((coroutine).mResumePoint) { case 0:
+
+/**
+ * @brief Returns to the task loop and resumes the body after the delay in milliseconds.
+ */
+#define COROUTINE_DELAY(coroutine, delayMs) \
+        do { \
+            (coroutine).mResumeDelayMs = (delayMs); \
+            (coroutine).mResumePoint = __LINE__; \
+            return; \
+            case __LINE__:; \
+        } while (0)
+
+/**
+ * @brief Returns to the task loop and resumes the body as soon as the pending notifications are processed.
+ */
+#define COROUTINE_YIELD(coroutine) \
+        COROUTINE_DELAY(coroutine, 0)
+
+/**
+ * @brief Waits until the condition is true, the condition is checked every pollMs milliseconds.
+ */
+#define COROUTINE_WAIT_UNTIL(coroutine, condition, pollMs) \
+        while (!(condition)) { COROUTINE_DELAY(coroutine, pollMs); }
+
+/**
+ * @brief Finishes the coroutine before the end of the body.
+ */
+#define COROUTINE_EXIT(coroutine) \
+        do { \
+            (coroutine).mResumePoint = ApplicationNS::Coroutine::mNotRunning; \
+            return; \
+        } while (0)
+
+/**
+ * @brief Ends the body of a coroutine, the last statement of the body.
+ */
+#define COROUTINE_END(coroutine) \
+        } \
+        (coroutine).mResumePoint = ApplicationNS::Coroutine::mNotRunning
@@ -218,9 +218,9 @@ namespace DateTimeNS
         wDateTime.mDate.mMonth  = (arDword >> 22)  & 0x0F;
         wDateTime.mDate.mYear   = ((arDword >> 26) & 0x3F) + mYearRangeStart;
 
-        /* Set day of week */
-        wDateTime.mDate.mWeekDay = DayOfWeek(
-                wDateTime.mDate.mDay, wDateTime.mDate.mMonth, wDateTime.mDate.mYear);
+        /* Set day of week, a dword holding only a time of day has no valid month */
+        wDateTime.mDate.mWeekDay = ((wDateTime.mDate.mMonth >= 1) && (wDateTime.mDate.mMonth <= 12)) ?
+                DayOfWeek(wDateTime.mDate.mDay, wDateTime.mDate.mMonth, wDateTime.mDate.mYear) : 0;
 
         return wDateTime;
     }
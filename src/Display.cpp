@@ -9,7 +9,8 @@
 
 #include "Logger.h"
 #include "Configuration.h"
-#include "Serialize.h"
+#include "MessagePayload.h"
+#include "SchedulingBenchmark.h"
 #include "Settings.hpp"
 
 #include "Display.h"
@@ -22,15 +23,34 @@
 /* Delay in msec between display updates */
 static constexpr uint32_t mcUpdateDelay = 10;
 
+/* Timer of the transition frames and refreshes */
+static constexpr uint32_t mFrameTimerId = 0x01;
+
+/* Time to send a refresh to the WS2812 stripe, 30 us per LED plus the 50 us reset */
+static constexpr uint32_t mcLedTransferUs = (LED_NUMBER * 30) + 50;
+/* Refresh rate reachable by the frame timer and the LED transfer */
+static constexpr uint32_t mcRefreshRate = (ConfigNS::mDisplayRefreshRate < (1000000 / mcLedTransferUs)) ?
+        ConfigNS::mDisplayRefreshRate : (1000000 / mcLedTransferUs);
+static_assert((mcRefreshRate >> ConfigNS::mDisplayDitherBits) >= ConfigNS::mDisplayFlickerFreeRate,
+        "Dither pattern slower than the flicker free rate at the reachable refresh rate, reduce mDisplayDitherBits");
+
 /* Intro color */
 static constexpr CRGB mIntroColor = CRGB::Orange;
 
+/* LED masks of all times in front panel order, generated at compile time and stored in flash */
+static constexpr TimeMaskNS::tTimeMaskTable mcTimeMaskTable = TimeMaskNS::GenerateTimeMaskTable();
+
+/* Stripe LED index of each front panel position, generated at compile time from the panel layout */
+static constexpr LedMappingNS::LedMap<MATRIX_WIDTH, MATRIX_HEIGHT> mcLedMap(ConfigNS::mcPanelLayout);
+static_assert(mcLedMap.IsValid(), "Panel layout does not map each LED exactly once");
+
 
 /**
  * @brief Constructor
  */
 Display::Display(char const* apName, ApplicationNS::tTaskPriority aPriority, const uint32_t aStackSize)
-    : ApplicationNS::Task(apName, aPriority, aStackSize)
+    : ApplicationNS::Task(apName, aPriority, aStackSize),
+      mTransition(mcLedMap)
 {
     // do nothing
 }
@@ -51,22 +71,57 @@ void Display::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     /* Initialize FastLED */
     // Initialize LEDs
     FastLED.addLeds<LED_TYPE, LED_DATA_PIN, LED_COLOR_ORDER>(mLeds, LED_NUMBER);
-    // Disable dithering mode
+    // Disable dithering mode, the framebuffer dithers
 	FastLED.setDither(DISABLE_DITHER);
-    // Color-corrected LED brightness
-    FastLED.setCorrection(TypicalLEDStrip);
-    // Set default LED brightness
+    // No color correction, the framebuffer corrects the colors
+    FastLED.setCorrection(UncorrectedColor);
+    // Set default LED brightness, the framebuffer applies the brightness
     FastLED.setBrightness(LED_DEFAULT_BRIGHTNESS);
     // Clear FastLED
     FastLED.clear();
 
+    /* Build the framebuffer tables */
+    mFramebuffer.Init(ConfigNS::mDisplayGamma, ConfigNS::mDisplayDitherBits, CRGB(ConfigNS::mDisplayColorCorrection));
+
+    /* Pace the transition frames and the refreshes */
+    mFrameScheduler.Init(ConfigNS::mDisplayFrameRate, ConfigNS::mDisplayFrameBudgetUs);
+    mRefreshScheduler.Init(mcRefreshRate, ConfigNS::mDisplayRefreshBudgetUs);
+
+    /* Read display options */
+    ReadDisplaySettings();
+
     /* Switch OFF all LEDs */
     Clear();
 
     /* Display intro */
     PaintWord(WORD_WORDCLOCK, mIntroColor);
 
-    FastLED.show();
+    ShowNextFrame();
+}
+
+void Display::ProcessMessageBatch(const MessageNS::Message* apMessages, uint8_t aCount)
+{
+    /* Process the messages of the batch, they only mark the display for update */
+    ApplicationNS::Task::ProcessMessageBatch(apMessages, aCount);
+
+    if (mUpdatePending)
+    {
+        mUpdatePending = false;
+
+        /* Update display once for the whole batch */
+        UpdateDisplay();
+
+#if (USE_SCHEDULING_BENCHMARK == true)
+        if (mDateTime.mTime.mSecond == 0)
+        {
+            /* Minute change shown, the milliseconds into the new minute are the latency */
+            timeval wTimeval;
+            gettimeofday(&wTimeval, nullptr);
+            SCHEDULING_BENCHMARK_RECORD(MEASURE_MINUTE_CHANGE,
+                    (static_cast<uint32_t>(wTimeval.tv_sec % 60) * 1000) + (wTimeval.tv_usec / 1000));
+        }
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
+    }
 }
 
 void Display::ProcessIncomingMessage(const MessageNS::Message &arMessage)
@@ -77,26 +132,35 @@ void Display::ProcessIncomingMessage(const MessageNS::Message &arMessage)
     {
         case MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED:
         {
-            /* Deserialize received time */
-            uint32_t wDword;
-            if (SerializeNS::DeserializeData(arMessage.mPayload, &wDword) == sizeof(wDword))
-            {
-                /* Store new date and time */
-                mDateTime = DateTimeNS::DwordToDateTime(wDword);
+            /* Store new date and time */
+            mDateTime = DateTimeNS::DwordToDateTime(
+                    MessageNS::GetPayload<MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED>(arMessage));
 
-                LOG(LOG_DEBUG, "Display::ProcessIncomingMessage() Datetime changed: " PRINTF_DATETIME_PATTERN,
-                        PRINTF_DATETIME_FORMAT(mDateTime));
+            LOG(LOG_DEBUG, "Display::ProcessIncomingMessage() Datetime changed: " PRINTF_DATETIME_PATTERN,
+                    PRINTF_DATETIME_FORMAT(mDateTime));
 
-                /* Update display */
-                UpdateDisplay();
-            }
+            /* Update display after the batch */
+            mUpdatePending = true;
         }
             break;
 
-        case MessageNS::tMessageId::MSG_EVENT_SETTINGS_CHANGED:
+        default:
+            // do nothing
+            break;
+    }
+}
+
+void Display::ProcessFastEvent(MessageNS::tFastEvent aEvent)
+{
+    switch (aEvent)
+    {
+        case MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED:
         {
             // Settings changed, re-read settings if needed
-            LOG(LOG_DEBUG, "Display::ProcessIncomingMessage() Settings changed");
+            LOG(LOG_DEBUG, "Display::ProcessFastEvent() Settings changed");
+
+            /* Re-read display options */
+            ReadDisplaySettings();
 
             /* Update display */
             UpdateDisplay();
@@ -109,6 +173,18 @@ void Display::ProcessIncomingMessage(const MessageNS::Message &arMessage)
     }
 }
 
+void Display::ProcessTimerEvent(const uint32_t aTimerId)
+{
+    if (aTimerId == mFrameTimerId)
+    {
+        RenderFrame();
+    }
+    else
+    {
+        LOG(LOG_ERROR, "Display::ProcessTimerEvent() Unknown timer ID %08X", aTimerId);
+    }
+}
+
 void Display::Clear(void)
 {
     Fill(CRGB::Black);
@@ -119,7 +195,21 @@ void Display::Fill(const CRGB aColor, const uint8_t aBrightness)
     uint8_t wBrightness = (aBrightness > 100) ? 100 : aBrightness;
     uint8_t wAlphaScale = map(wBrightness, 0, 100, 0, 255);
 
-    fill_solid(mLeds, LED_NUMBER, aColor.scale8(wAlphaScale));
+    fill_solid(mNextFrame, LED_NUMBER, aColor.scale8(wAlphaScale));
+}
+
+void Display::ReadDisplaySettings(void)
+{
+    /* Check if "IT IS" words should be displayed */
+    mItIsEnabled = Settings.GetValue<bool>(ConfigNS::mKeyDisplayClockItIs, ConfigNS::mDefaultDisplayClockItIs);
+
+    /* Check if extra minutes should be displayed */
+    mExtraMinutesEnabled = Settings.GetValue<bool>(ConfigNS::mKeyDisplayClockSingleMins, ConfigNS::mDefaultDisplayClockSingleMins);
+
+    /* Transition between two times */
+    uint8_t wTransition = Settings.GetValue<uint8_t>(ConfigNS::mKeyDisplayTransition, ConfigNS::mDefaultDisplayTransition);
+    mTransitionEffect = (wTransition < TransitionNS::NB_OF_TRANSITION_EFFECTS) ?
+            static_cast<TransitionNS::tTransitionEffect>(wTransition) : TransitionNS::TRANSITION_NONE;
 }
 
 void Display::UpdateDisplay(void)
@@ -178,172 +268,205 @@ void Display::UpdateDisplay(void)
         }
     }
 
-    /* Set the brightness value to a range of 0–100% */
-    if (wBrightness > 100)
+    if (mFrameTimer != TimerServiceNS::mInvalidTimerHandle)
     {
-        wBrightness = 100;
+        /* Refreshes since the last update */
+        TransitionNS::tFrameStatistics wStatistics = mRefreshScheduler.GetStatistics();
+        LOG(LOG_DEBUG, "Display::UpdateDisplay() %u refreshes, %u dropped, %u over budget, "
+                "%u.%02u Hz, dither time avg %u us, max %u us, LED transfer max %u us",
+                wStatistics.mFramesRendered, wStatistics.mFramesDropped, wStatistics.mFramesOverBudget,
+                wStatistics.mAchievedFpsX100 / 100, wStatistics.mAchievedFpsX100 % 100,
+                wStatistics.mAvgFrameTimeUs, wStatistics.mMaxFrameTimeUs, mMaxLedTransferUs);
+
+        /* Check the refresh rate reached over at least a second */
+        uint32_t wRequiredX100 = (ConfigNS::mDisplayFlickerFreeRate << mFramebuffer.GetDitherBits()) *
+                (100 - ConfigNS::mDisplayRefreshTolerance);
+        if ((mFramebuffer.GetDitherBits() > 0) &&
+            (wStatistics.mFramesRendered >= mcRefreshRate) &&
+            (wStatistics.mAchievedFpsX100 < wRequiredX100))
+        {
+            LOG(LOG_WARN, "Display::UpdateDisplay() Refresh rate %u Hz too low for a flicker free dither pattern, "
+                    "dithering disabled", wStatistics.mAchievedFpsX100 / 100);
+            mFramebuffer.SetDitherBits(0);
+        }
+
+        mRefreshScheduler.Start(micros());
+        mMaxLedTransferUs = 0;
     }
 
-    /* Convert the brightness value (0–100%) to a range of the LED hardware scale (0–255) */
-    uint8_t wAlphaScale = map(wBrightness, 0, 100, 0, 255);
+    /* Set LED brightness (0–100%), applied when the next frame is loaded */
+    mFramebuffer.SetBrightness(wBrightness);
 
-    /* Set LED brightness */
-    FastLED.setBrightness(wAlphaScale);
+    if (mTransitionEffect == TransitionNS::TRANSITION_NONE)
+    {
+        /* Show new data on the LED matrix */
+        ShowNextFrame();
+    }
+    else
+    {
+        /* Transition from the frame shown now, also if a transition is running */
+        memcpy(static_cast<void*>(mPreviousFrame), mFrame, sizeof(mFrame));
+        mTransition.Start(mTransitionEffect, ConfigNS::mDisplayTransitionMs, millis());
+        mFrameScheduler.Start(micros());
 
-    /* Show new data on the LED matrix */
-    FastLED.show();
+        UpdateFrameTimer();
+    }
 }
 
-void Display::SetLedColor(const uint16_t aLedIndex, const CRGB aColor)
+void Display::ShowNextFrame(void)
 {
-    if (aLedIndex < LED_NUMBER)
-    {
-        mLeds[aLedIndex] = aColor;
-    }
+    /* Stop a running transition */
+    mTransition.Stop();
+
+    memcpy(static_cast<void*>(mFrame), mNextFrame, sizeof(mFrame));
+    ShowFrame();
 }
 
-void Display::SetLedColor(BitMatrix& arLedMask, const CRGB aColor)
+void Display::ShowFrame(void)
 {
-    if (arLedMask.GetSize() == LED_NUMBER)
+    mFramebuffer.Load(mFrame);
+    mFramebuffer.Dither(mLeds);
+    ShowLeds();
+
+    /* Keep refreshing while the frame needs dithering */
+    UpdateFrameTimer();
+}
+
+void Display::RenderFrame(void)
+{
+    /* Transition frame, skipped if not due or dropped after an over budget frame */
+    if (mTransition.IsRunning() && mFrameScheduler.BeginFrame(micros()))
     {
-        for (uint16_t wI = 0; wI < arLedMask.GetSize(); wI++)
+        bool wRunning = mTransition.Render(mFrame, mPreviousFrame, mNextFrame, millis());
+        mFramebuffer.Load(mFrame);
+        mRefreshPending = true;
+
+        mFrameScheduler.EndFrame(micros());
+
+        if (!wRunning)
         {
-            if (arLedMask.IsBitSet(wI))
-            {
-                mLeds[wI] = aColor;
-            }
+            /* Last frame rendered */
+            TransitionNS::tFrameStatistics wStatistics = mFrameScheduler.GetStatistics();
+            LOG(LOG_INFO, "Display::RenderFrame() Transition done, %u frames, %u dropped, %u over budget, "
+                    "%u.%02u fps, frame time avg %u us, max %u us",
+                    wStatistics.mFramesRendered, wStatistics.mFramesDropped, wStatistics.mFramesOverBudget,
+                    wStatistics.mAchievedFpsX100 / 100, wStatistics.mAchievedFpsX100 % 100,
+                    wStatistics.mAvgFrameTimeUs, wStatistics.mMaxFrameTimeUs);
         }
     }
+
+    /* Refresh a new frame, continuously while the frame needs dithering */
+    if ((mRefreshPending || mFramebuffer.NeedsDithering()) && mRefreshScheduler.BeginFrame(micros()))
+    {
+        /* Only the dithering counts to the budget, the LED transfer time is fixed by the stripe */
+        mFramebuffer.Dither(mLeds);
+        mRefreshScheduler.EndFrame(micros());
+
+        ShowLeds();
+    }
+
+    UpdateFrameTimer();
 }
 
-void Display::PaintWord(const tWord aWord, const CRGB aColor)
+void Display::ShowLeds(void)
 {
-    /* Prepare LED mask */
-    mLedMask.ClearAll();
+    uint32_t wStartUs = micros();
 
-    /* Check input parameters */
-    if ((aWord > WORD_END_OF_WORDS) &&
-        (aWord < WORD_MAX_NUMBER))
+    /* Send the LEDs to the stripe, the task waits for the transfer */
+    FastLED.show();
+
+    uint32_t wTransferUs = micros() - wStartUs;
+    if (wTransferUs > mMaxLedTransferUs)
+    {
+        mMaxLedTransferUs = wTransferUs;
+    }
+
+    mRefreshPending = false;
+}
+
+void Display::UpdateFrameTimer(void)
+{
+    bool wNeeded = mTransition.IsRunning() || mRefreshPending || mFramebuffer.NeedsDithering();
+
+    if (wNeeded && (mFrameTimer == TimerServiceNS::mInvalidTimerHandle))
     {
-        /* Get word data */
-        tWordData wWordData = mcWordDataArray[aWord];
-        /* Set LED bits for the word */
-        mLedMask.SetLine(wWordData.mRow, wWordData.mColumn, wWordData.mLength);
+        /* One refresh per period, the transition frames are paced by their own scheduler */
+        mFrameTimer = StartTimer(mFrameTimerId, 1000 / mcRefreshRate);
+        mRefreshScheduler.Start(micros());
     }
+    else if (!wNeeded && (mFrameTimer != TimerServiceNS::mInvalidTimerHandle))
+    {
+        StopTimer(mFrameTimer);
+        mFrameTimer = TimerServiceNS::mInvalidTimerHandle;
+    }
+}
 
-    /* Match the logical LED mask to the physical layout (zigzag order) */
-    for (uint8_t wRow = 0; wRow < mLedMask.GetHeight(); wRow++)
+void Display::SetLedColor(const uint16_t aLedIndex, const CRGB aColor)
+{
+    if (aLedIndex < LED_NUMBER)
     {
-        if ((wRow % 2) == 0)
-        {
-            /* It is even row -> flip it */
-            mLedMask.FlipRow(wRow);
-        }
+        /* Write through the mapping to the LED of the stripe */
+        mNextFrame[mcLedMap.GetLedIndex(aLedIndex)] = aColor;
     }
+}
 
-    /* Now paint all LEDs marked in the mask */
-    SetLedColor(mLedMask, aColor);
+void Display::SetLedColor(const TimeMaskNS::tLedMask& arLedMask, const CRGB aColor)
+{
+    /* Visit only the lit LEDs */
+    arLedMask.ForEachSetBit([this, aColor](uint32_t aLedIndex)
+    {
+        SetLedColor(static_cast<uint16_t>(aLedIndex), aColor);
+    });
+}
+
+void Display::PaintWord(const tWord aWord, const CRGB aColor)
+{
+    /* Paint all LEDs of the word */
+    SetLedColor(TimeMaskNS::GetWordMask(aWord), aColor);
 }
 
 void Display::PaintTime(const uint8_t aHour, const uint8_t aMinute, const CRGB aColor)
 {
-    /* Prepare LED mask */
-    mLedMask.ClearAll();
+    TimeMaskNS::tLedMask wLedMask;
 
     /* Check input parameters */
     if ((aHour   < 24) &&       // Support only 24 hours format
         (aMinute < 60))         // 0..59 minutes
     {
-        uint8_t wHour         = aHour;
-        uint8_t wMinute       = aMinute / 5;    // minute steps 0, 5, ... 55
-        uint8_t wMinuteExtra  = aMinute % 5;    // extra minutes 0, +1 ... +4
+        uint8_t wHour         = aHour % HOURS_COUNT;    // 0 is 12 o'clock
+        uint8_t wMinute       = aMinute / 5;            // minute steps 0, 5, ... 55
+        uint8_t wMinuteExtra  = aMinute % 5;            // extra minutes 0, +1 ... +4
 
         tWordClockMode wMode  = WORDCLOCK_MODE_1;
 
-        /* Get minute display data */
-        tMinuteDisplay wMinuteDisplay = mcWordMinutesTable[wMode][wMinute];
-
-        /* Correct hour offset */
-        if ((wMinuteDisplay.mFlags & HOUR_OFFSET_1) == HOUR_OFFSET_1)
-        {
-            wHour += 1;
-        }
-
-        /* We have only 12 hours */
-        while (wHour > HOURS_COUNT)
-        {
-            wHour -= HOURS_COUNT;
-        }
-
-        /* Correct index for 12 Hours */
-        if (wHour == 12)
-        {
-            wHour = 0;
-        }
-
-        /* Check if "IT IS" words should be displayed */
-        bool  wItIsEnabled = Settings.GetValue<bool>(ConfigNS::mKeyDisplayClockItIs, ConfigNS::mDefaultDisplayClockItIs);
-        uint8_t wItIsWords = (wItIsEnabled) ? 2 : 0; // 2 words: "ES" and "IST"
-
-        /* Check if extra minutes should be displayed */
-        bool  wExtraMinutesEnabled = Settings.GetValue<bool>(ConfigNS::mKeyDisplayClockSingleMins, ConfigNS::mDefaultDisplayClockSingleMins);
-        uint8_t wExtraMinutesWords = (wExtraMinutesEnabled) ? MAX_EXTRA_MINUTE_WORDS : 0;
-
-        /* Prepare array of words to display the time */
-        tWord wDisplayWords[wItIsWords + MAX_MINUTE_WORDS + MAX_HOUR_WORDS + wExtraMinutesWords] = { WORD_END_OF_WORDS };
-        uint8_t wWordsOffset = 0;
+        /* Take the minute and hour words from the table */
+        wLedMask = mcTimeMaskTable.mTimeMasks[wMode][wHour][wMinute];
 
         /* Add "ES IST" words if enabled */
-        if (wItIsEnabled)
+        if (mItIsEnabled)
         {
-            wDisplayWords[wWordsOffset++] = WORD_ES;
-            wDisplayWords[wWordsOffset++] = WORD_IST;
+            wLedMask.Union(mcTimeMaskTable.mItIsMask);
         }
 
-        /* Add minute words */
-        memccpy(&wDisplayWords[wWordsOffset], wMinuteDisplay.wMinuteWords,
-            MAX_MINUTE_WORDS, sizeof(wMinuteDisplay.wMinuteWords));
-        wWordsOffset += MAX_MINUTE_WORDS;
-
-        /* Add hour words */
-        memccpy(&wDisplayWords[wWordsOffset], mcWordHoursTable[wMinuteDisplay.mHourMode][wHour],
-            MAX_HOUR_WORDS, sizeof(mcWordHoursTable[wMinuteDisplay.mHourMode][wHour]));
-        wWordsOffset += MAX_HOUR_WORDS;
-
         /* Add extra minute words if enabled */
-        if (wExtraMinutesEnabled)
+        if (mExtraMinutesEnabled)
         {
-            memccpy(&wDisplayWords[wWordsOffset], mcWordExtraMinutesTable[wMinuteExtra],
-                wExtraMinutesWords, sizeof(mcWordExtraMinutesTable[wMinuteExtra]));
-            wWordsOffset += wExtraMinutesWords;
-        }
-
-        /* Set LED bits for all display words */
-        for (uint8_t wI = 0; wI < wWordsOffset; wI++)
-        {
-            if ((wDisplayWords[wI] > WORD_END_OF_WORDS) &&
-                (wDisplayWords[wI] < WORD_MAX_NUMBER))
-            {
-                /* Get word data */
-                tWordData wWordData = mcWordDataArray[wDisplayWords[wI]];
-                /* Set LED bits for the word */
-                mLedMask.SetLine(wWordData.mRow, wWordData.mColumn, wWordData.mLength);
-            }
+            wLedMask.Union(mcTimeMaskTable.mExtraMinuteMasks[wMinuteExtra]);
         }
     }
 
 #if (LOG_LEVEL == LOG_VERBOSE)  // don't compile this code each time
     /* Log the LED layout with the painted time */
     LOG(LOG_VERBOSE, "Display::PaintTime() LED layout:");
-    for (uint16_t wRow = 0; wRow < mLedMask.GetHeight(); wRow++)
+    for (uint8_t wRow = 0; wRow < MATRIX_HEIGHT; wRow++)
     {
         String wLogRow;
 
-        for (uint16_t wCol = 0; wCol < mLedMask.GetWidth(); wCol++)
+        for (uint8_t wCol = 0; wCol < MATRIX_WIDTH; wCol++)
         {
-            if (mLedMask.IsBitSet(wRow, wCol))
+            if (wLedMask.IsBitSet(wRow, wCol))
             {
-                wLogRow += mDisplayLayout[wRow][wCol*3 + 2];  // 2, 5, 8, ...
+                wLogRow += mcDisplayLayout[wRow][wCol*3 + 2];  // 2, 5, 8, ...
             }
             else
             {
@@ -357,16 +480,6 @@ void Display::PaintTime(const uint8_t aHour, const uint8_t aMinute, const CRGB a
     }
 #endif /* (LOG_LEVEL == LOG_VERBOSE) */
 
-    /* Match the logical LED mask to the physical layout (zigzag order) */
-    for (uint8_t wRow = 0; wRow < mLedMask.GetHeight(); wRow++)
-    {
-        if ((wRow % 2) == 0)
-        {
-            /* It is even row -> flip it */
-            mLedMask.FlipRow(wRow);
-        }
-    }
-
     /* Now paint all LEDs marked in the mask */
-    SetLedColor(mLedMask, aColor);
-}
\ No newline at end of file
+    SetLedColor(wLedMask, aColor);
+}
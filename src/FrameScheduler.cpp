@@ -0,0 +1,137 @@
+/*
+ * FrameScheduler.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "FrameScheduler.h"
+
+
+namespace TransitionNS
+{
+
+/**
+ *
+ * Implementation of the TransitionNS::FrameScheduler class
+ *
+ */
+FrameScheduler::FrameScheduler()
+{
+    // do nothing
+}
+
+FrameScheduler::~FrameScheduler()
+{
+    // do nothing
+}
+
+/**
+ * @brief Sets the frame rate and the CPU budget of a frame.
+ *
+ * @param aFrameRate Target frames per second
+ * @param aFrameBudgetUs Maximum time to render a frame
+ */
+void FrameScheduler::Init(uint32_t aFrameRate, uint32_t aFrameBudgetUs)
+{
+    mFramePeriodUs = 1000000 / ((aFrameRate > 0) ? aFrameRate : 1);
+    mFrameBudgetUs = aFrameBudgetUs;
+}
+
+/**
+ * @brief Starts a new sequence of frames, the first frame is due at once.
+ */
+void FrameScheduler::Start(uint32_t aNowUs)
+{
+    mStartUs   = aNowUs;
+    mLastUs    = aNowUs;
+    mNextFrame = 0;
+    mSkipNext  = false;
+
+    mFramesRendered   = 0;
+    mFramesDropped    = 0;
+    mFramesOverBudget = 0;
+    mFrameTimeSumUs   = 0;
+    mMaxFrameTimeUs   = 0;
+}
+
+/**
+ * @brief Returns true if a frame has to be rendered now.
+ *
+ * @details
+ * Frames whose time has passed without being rendered are counted as dropped.
+ */
+bool FrameScheduler::BeginFrame(uint32_t aNowUs)
+{
+    mLastUs = aNowUs;
+
+    uint32_t wFrame = (aNowUs - mStartUs) / mFramePeriodUs;
+    if (wFrame < mNextFrame)
+    {
+        /* Not due yet */
+        return false;
+    }
+
+    /* Missed frames */
+    mFramesDropped += wFrame - mNextFrame;
+    mNextFrame = wFrame + 1;
+
+    if (mSkipNext)
+    {
+        /* Give the time back after an over budget frame */
+        mSkipNext = false;
+        mFramesDropped++;
+        return false;
+    }
+
+    mFrameStartUs = aNowUs;
+    return true;
+}
+
+/**
+ * @brief Accounts the time of the frame started by BeginFrame().
+ */
+void FrameScheduler::EndFrame(uint32_t aNowUs)
+{
+    uint32_t wFrameTimeUs = aNowUs - mFrameStartUs;
+
+    mLastUs = aNowUs;
+    mFramesRendered++;
+    mFrameTimeSumUs += wFrameTimeUs;
+    if (wFrameTimeUs > mMaxFrameTimeUs)
+    {
+        mMaxFrameTimeUs = wFrameTimeUs;
+    }
+
+    if (wFrameTimeUs > mFrameBudgetUs)
+    {
+        mFramesOverBudget++;
+        mSkipNext = true;
+    }
+}
+
+/**
+ * @brief Returns the statistics since Start().
+ */
+tFrameStatistics FrameScheduler::GetStatistics(void) const
+{
+    tFrameStatistics wStatistics = {};
+    uint32_t         wElapsedUs  = mLastUs - mStartUs;
+
+    wStatistics.mFramesRendered   = mFramesRendered;
+    wStatistics.mFramesDropped    = mFramesDropped;
+    wStatistics.mFramesOverBudget = mFramesOverBudget;
+    wStatistics.mMaxFrameTimeUs   = mMaxFrameTimeUs;
+
+    if (mFramesRendered > 0)
+    {
+        wStatistics.mAvgFrameTimeUs = static_cast<uint32_t>(mFrameTimeSumUs / mFramesRendered);
+    }
+    if (wElapsedUs > 0)
+    {
+        wStatistics.mAchievedFpsX100 = static_cast<uint32_t>((static_cast<uint64_t>(mFramesRendered) * 100000000ULL) / wElapsedUs);
+    }
+
+    return wStatistics;
+}
+
+}   /* end of namespace TransitionNS */
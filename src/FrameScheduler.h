@@ -0,0 +1,73 @@
+/*
+ * FrameScheduler.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+
+namespace TransitionNS
+{
+    /** @brief Statistics of the frames rendered by the frame scheduler */
+    struct tFrameStatistics
+    {
+        /** @brief Frames rendered */
+        uint32_t mFramesRendered;
+        /** @brief Frames dropped (missed or skipped after an over budget frame) */
+        uint32_t mFramesDropped;
+        /** @brief Rendered frames exceeding the frame budget */
+        uint32_t mFramesOverBudget;
+        /** @brief Frames rendered per second, in hundredths */
+        uint32_t mAchievedFpsX100;
+        /** @brief Average frame time in microseconds */
+        uint32_t mAvgFrameTimeUs;
+        /** @brief Maximum frame time in microseconds */
+        uint32_t mMaxFrameTimeUs;
+    };
+
+    /**
+     * @brief Paces frames at a fixed rate within a CPU budget per frame.
+     *
+     * @details
+     * Frames are due on a fixed grid from Start(), so a late frame does not shift the following
+     * ones. A frame that is due while a later frame is already due is dropped, and the frame after
+     * one exceeding the budget is dropped too, so an overloaded task catches up instead of falling
+     * further behind. Frames are rendered between BeginFrame() and EndFrame().
+     */
+    class FrameScheduler
+    {
+    public:
+        FrameScheduler();
+        virtual ~FrameScheduler();
+
+        void Init(uint32_t aFrameRate, uint32_t aFrameBudgetUs);
+        void Start(uint32_t aNowUs);
+
+        bool BeginFrame(uint32_t aNowUs);
+        void EndFrame(uint32_t aNowUs);
+
+        /** @brief Returns the period of the frames in milliseconds */
+        uint32_t GetFramePeriodMs(void) const { return mFramePeriodUs / 1000; }
+        tFrameStatistics GetStatistics(void) const;
+
+    private:
+        uint32_t mFramePeriodUs = 0;
+        uint32_t mFrameBudgetUs = 0;
+
+        uint32_t mStartUs      = 0;
+        uint32_t mLastUs       = 0;
+        uint32_t mFrameStartUs = 0;
+        uint32_t mNextFrame    = 0;
+        bool     mSkipNext     = false;
+
+        uint32_t mFramesRendered   = 0;
+        uint32_t mFramesDropped    = 0;
+        uint32_t mFramesOverBudget = 0;
+        uint64_t mFrameTimeSumUs   = 0;
+        uint32_t mMaxFrameTimeUs   = 0;
+    };
+
+}   /* end of namespace TransitionNS */
@@ -0,0 +1,160 @@
+/*
+ * FrameTransition.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "FrameTransition.h"
+
+
+namespace TransitionNS
+{
+
+/** @brief Scales a channel by aScale / 256, aScale 0..256 */
+static inline uint8_t ScaleChannel(uint8_t aValue, uint16_t aScale)
+{
+    return static_cast<uint8_t>((static_cast<uint16_t>(aValue) * aScale) >> 8);
+}
+
+/** @brief Blends two channels, aProgress 0..256 */
+static inline uint8_t BlendChannel(uint8_t aFrom, uint8_t aTo, uint16_t aProgress)
+{
+    return static_cast<uint8_t>(aFrom + (((static_cast<int16_t>(aTo) - aFrom) * static_cast<int16_t>(aProgress)) / 256));
+}
+
+/**
+ *
+ * Implementation of the TransitionNS::FrameTransition class
+ *
+ */
+FrameTransition::FrameTransition(const tPanelLedMap& arLedMap)
+    : mrLedMap(arLedMap)
+{
+    // do nothing
+}
+
+FrameTransition::~FrameTransition()
+{
+    // do nothing
+}
+
+/**
+ * @brief Starts a transition, a running transition continues from the output shown last.
+ *
+ * @param aEffect Effect of the transition
+ * @param aDurationMs Duration of the transition
+ * @param aNowMs Current time (millis)
+ */
+void FrameTransition::Start(tTransitionEffect aEffect, uint32_t aDurationMs, uint32_t aNowMs)
+{
+    mEffect     = (aEffect < NB_OF_TRANSITION_EFFECTS) ? aEffect : TRANSITION_NONE;
+    mStartMs    = aNowMs;
+    mDurationMs = aDurationMs;
+    mRunning    = true;
+}
+
+/**
+ * @brief Stops the transition, the output is not rendered anymore.
+ */
+void FrameTransition::Stop(void)
+{
+    mRunning = false;
+}
+
+/**
+ * @brief Returns true if the duration of the running transition has elapsed.
+ */
+bool FrameTransition::IsComplete(uint32_t aNowMs) const
+{
+    return GetProgress(aNowMs) >= mProgressEnd;
+}
+
+/**
+ * @brief Renders the frame of the current progress.
+ *
+ * @param apOutput Output frame, LED_NUMBER LEDs in stripe order
+ * @param apPrevious Frame shown before the transition
+ * @param apNext Frame shown after the transition
+ * @param aNowMs Current time (millis)
+ * @return true if the transition continues, false if the next frame has been rendered completely
+ */
+bool FrameTransition::Render(CRGB* apOutput, const CRGB* apPrevious, const CRGB* apNext, uint32_t aNowMs)
+{
+    uint16_t wProgress = mRunning ? GetProgress(aNowMs) : mProgressEnd;
+
+    if ((wProgress >= mProgressEnd) || (mEffect == TRANSITION_NONE))
+    {
+        /* Transition complete */
+        memcpy(static_cast<void*>(apOutput), apNext, sizeof(CRGB) * MATRIX_SIZE);
+        mRunning = false;
+        return false;
+    }
+
+    switch (mEffect)
+    {
+        case TRANSITION_CROSSFADE:
+        {
+            for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+            {
+                apOutput[wI].r = BlendChannel(apPrevious[wI].r, apNext[wI].r, wProgress);
+                apOutput[wI].g = BlendChannel(apPrevious[wI].g, apNext[wI].g, wProgress);
+                apOutput[wI].b = BlendChannel(apPrevious[wI].b, apNext[wI].b, wProgress);
+            }
+        }
+            break;
+
+        case TRANSITION_FADE_THROUGH_BLACK:
+        {
+            /* Fade out during the first half, fade in during the second half */
+            const CRGB* wpSource = (wProgress < (mProgressEnd / 2)) ? apPrevious : apNext;
+            uint16_t    wScale   = (wProgress < (mProgressEnd / 2)) ?
+                    (mProgressEnd - (2 * wProgress)) : ((2 * wProgress) - mProgressEnd);
+
+            for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+            {
+                apOutput[wI].r = ScaleChannel(wpSource[wI].r, wScale);
+                apOutput[wI].g = ScaleChannel(wpSource[wI].g, wScale);
+                apOutput[wI].b = ScaleChannel(wpSource[wI].b, wScale);
+            }
+        }
+            break;
+
+        case TRANSITION_WIPE:
+        {
+            /* Columns left of the edge show the next frame */
+            uint16_t wEdge = (wProgress * MATRIX_WIDTH) / mProgressEnd;
+
+            for (uint16_t wRow = 0; wRow < MATRIX_HEIGHT; wRow++)
+            {
+                for (uint16_t wCol = 0; wCol < MATRIX_WIDTH; wCol++)
+                {
+                    uint16_t wLedIndex = mrLedMap.GetLedIndex(wRow, wCol);
+                    apOutput[wLedIndex] = (wCol < wEdge) ? apNext[wLedIndex] : apPrevious[wLedIndex];
+                }
+            }
+        }
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns the progress of the transition, 0 at the start, mProgressEnd at the end.
+ */
+uint16_t FrameTransition::GetProgress(uint32_t aNowMs) const
+{
+    uint32_t wElapsedMs = aNowMs - mStartMs;
+
+    if ((mDurationMs == 0) || (wElapsedMs >= mDurationMs))
+    {
+        return mProgressEnd;
+    }
+
+    return static_cast<uint16_t>((wElapsedMs * mProgressEnd) / mDurationMs);
+}
+
+}   /* end of namespace TransitionNS */
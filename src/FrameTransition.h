@@ -0,0 +1,74 @@
+/*
+ * FrameTransition.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include "LedMapping.h"
+#include "WordClockLayout.h"
+
+
+namespace TransitionNS
+{
+    /** @brief Effect of a transition between two frames */
+    enum tTransitionEffect : uint8_t
+    {
+        /** @brief The next frame is shown at once */
+        TRANSITION_NONE = 0x00,
+        /** @brief Each LED blends from the previous to the next color */
+        TRANSITION_CROSSFADE,
+        /** @brief The previous frame fades out, then the next frame fades in */
+        TRANSITION_FADE_THROUGH_BLACK,
+        /** @brief The next frame is revealed column by column from the left */
+        TRANSITION_WIPE,
+
+        /** @brief Number of effects (do not use as actual effect) */
+        NB_OF_TRANSITION_EFFECTS
+    };
+
+    /** @brief Mapping of the front panel positions to the stripe LEDs */
+    typedef LedMappingNS::LedMap<MATRIX_WIDTH, MATRIX_HEIGHT> tPanelLedMap;
+
+    /**
+     * @brief Interpolates between the previous and the next frame over a duration.
+     *
+     * @details
+     * The frames are in stripe order. The progress of a frame is taken from the time since
+     * Start(), so the transition lasts its duration however many frames are rendered or dropped.
+     * The wipe needs the position of the LEDs on the front panel, given by the LED map.
+     */
+    class FrameTransition
+    {
+    public:
+        FrameTransition(const tPanelLedMap& arLedMap);
+        virtual ~FrameTransition();
+
+        void Start(tTransitionEffect aEffect, uint32_t aDurationMs, uint32_t aNowMs);
+        void Stop(void);
+
+        /** @brief Returns true while a transition is started and not rendered completely */
+        bool IsRunning(void) const { return mRunning; }
+        bool IsComplete(uint32_t aNowMs) const;
+
+        bool Render(CRGB* apOutput, const CRGB* apPrevious, const CRGB* apNext, uint32_t aNowMs);
+
+    private:
+        /** @brief Progress at the end of the transition */
+        static constexpr uint16_t mProgressEnd = 256;
+
+        const tPanelLedMap& mrLedMap;
+
+        tTransitionEffect mEffect     = TRANSITION_NONE;
+        uint32_t          mStartMs    = 0;
+        uint32_t          mDurationMs = 0;
+        bool              mRunning    = false;
+
+        uint16_t GetProgress(uint32_t aNowMs) const;
+    };
+
+}   /* end of namespace TransitionNS */
@@ -0,0 +1,144 @@
+/*
+ * Framebuffer.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <math.h>
+
+#include "Framebuffer.h"
+
+
+namespace FramebufferNS
+{
+
+/**
+ *
+ * Implementation of the FramebufferNS::Framebuffer class
+ *
+ */
+Framebuffer::Framebuffer()
+{
+    // do nothing
+}
+
+Framebuffer::~Framebuffer()
+{
+    // do nothing
+}
+
+/**
+ * @brief Builds the gamma table and the tables of full brightness.
+ *
+ * @param aGamma Gamma of the input colors, 1.0 keeps them linear
+ * @param aDitherBits Bits of the fraction shown by dithering, 0 rounds to full LED steps
+ * @param aCorrection Color correction of the LEDs, scale of each channel
+ */
+void Framebuffer::Init(float aGamma, uint8_t aDitherBits, const CRGB aCorrection)
+{
+    mCorrection = aCorrection;
+
+    for (uint16_t wI = 0; wI < 256; wI++)
+    {
+        mGammaTable[wI] = static_cast<uint16_t>((powf(wI / 255.0f, aGamma) * 65535.0f) + 0.5f);
+    }
+
+    mBrightness = 100;
+    SetDitherBits(aDitherBits);
+}
+
+/**
+ * @brief Sets the bits of the fraction shown by dithering, applied when the next frame is loaded.
+ *
+ * @param aDitherBits Bits of the fraction shown by dithering, 0 rounds to full LED steps
+ */
+void Framebuffer::SetDitherBits(uint8_t aDitherBits)
+{
+    mDitherBits = (aDitherBits > mMaxDitherBits) ? mMaxDitherBits : aDitherBits;
+
+    /* Spread the start phase of the accumulators over the LEDs and channels */
+    uint8_t wPhaseMask  = static_cast<uint8_t>((1 << mDitherBits) - 1);
+    uint8_t wPhaseShift = mMaxDitherBits - mDitherBits;
+    for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+    {
+        for (uint8_t wC = 0; wC < 3; wC++)
+        {
+            mResidual[wI][wC] = static_cast<uint8_t>((((wI * 5) + (wC * 3)) & wPhaseMask) << wPhaseShift);
+        }
+    }
+
+    /* Rebuild the channel tables with the current brightness */
+    uint8_t wBrightness = mBrightness;
+    mBrightness = 0xFF;
+    SetBrightness(wBrightness);
+}
+
+/**
+ * @brief Sets the brightness of the following frames, the channel tables are rebuilt on change.
+ *
+ * @param aBrightness Brightness in percentage (0-100)
+ */
+void Framebuffer::SetBrightness(uint8_t aBrightness)
+{
+    uint8_t wBrightness = (aBrightness > 100) ? 100 : aBrightness;
+
+    if (wBrightness == mBrightness)
+    {
+        return;
+    }
+    mBrightness = wBrightness;
+
+    /* Round to the fraction shown by dithering */
+    uint32_t wQuantum = 1 << (mMaxDitherBits - mDitherBits);
+
+    for (uint8_t wC = 0; wC < 3; wC++)
+    {
+        /* Full scale is 255.0 in 8.8 fixed point */
+        uint64_t wScale   = static_cast<uint64_t>(wBrightness) * mCorrection[wC] * (255 << 8);
+        uint64_t wDivisor = static_cast<uint64_t>(65535) * 100 * 255;
+
+        for (uint16_t wI = 0; wI < 256; wI++)
+        {
+            uint32_t wValue = static_cast<uint32_t>(((mGammaTable[wI] * wScale) + (wDivisor / 2)) / wDivisor);
+            mChannelTable[wC][wI] = static_cast<uint16_t>(((wValue + (wQuantum / 2)) / wQuantum) * wQuantum);
+        }
+    }
+}
+
+/**
+ * @brief Loads a frame in stripe order through the channel tables.
+ */
+void Framebuffer::Load(const CRGB* apFrame)
+{
+    uint16_t wFraction = 0;
+
+    for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+    {
+        for (uint8_t wC = 0; wC < 3; wC++)
+        {
+            mPixels[wI][wC] = mChannelTable[wC][apFrame[wI][wC]];
+            wFraction |= mPixels[wI][wC];
+        }
+    }
+
+    mNeedsDithering = (wFraction & 0xFF) != 0;
+}
+
+/**
+ * @brief Renders one refresh of the loaded frame to the LED output.
+ */
+void Framebuffer::Dither(CRGB* apOutput)
+{
+    for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+    {
+        for (uint8_t wC = 0; wC < 3; wC++)
+        {
+            /* Carry the accumulated fraction into the LED step */
+            uint16_t wSum = (mPixels[wI][wC] & 0xFF) + mResidual[wI][wC];
+            apOutput[wI][wC]  = static_cast<uint8_t>((mPixels[wI][wC] >> 8) + (wSum >> 8));
+            mResidual[wI][wC] = static_cast<uint8_t>(wSum);
+        }
+    }
+}
+
+}   /* end of namespace FramebufferNS */
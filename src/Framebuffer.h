@@ -0,0 +1,67 @@
+/*
+ * Framebuffer.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include "WordClockLayout.h"
+
+
+namespace FramebufferNS
+{
+    /**
+     * @brief LED output with 16 bits per channel and temporal dithering.
+     *
+     * @details
+     * A frame is loaded through precomputed tables which apply gamma, brightness and color
+     * correction per channel, so the result keeps the fraction below one LED step. Each refresh
+     * rounds the fraction with an error accumulator per channel, so over a few refreshes the
+     * LEDs show the fraction too. The fraction is limited to aDitherBits, so the dither pattern
+     * repeats within 2^aDitherBits refreshes and does not flicker if the refresh rate is high
+     * enough. The accumulators start at different phases, so the LEDs do not toggle together.
+     */
+    class Framebuffer
+    {
+    public:
+        Framebuffer();
+        virtual ~Framebuffer();
+
+        void Init(float aGamma, uint8_t aDitherBits, const CRGB aCorrection);
+        void SetBrightness(uint8_t aBrightness);
+        void SetDitherBits(uint8_t aDitherBits);
+
+        /** @brief Returns the bits of the fraction shown by dithering */
+        uint8_t GetDitherBits(void) const { return mDitherBits; }
+
+        void Load(const CRGB* apFrame);
+        void Dither(CRGB* apOutput);
+
+        /** @brief Returns true if the loaded frame has a fraction, it has to be refreshed continuously */
+        bool NeedsDithering(void) const { return mNeedsDithering; }
+
+    private:
+        /** @brief Maximum number of fraction bits */
+        static constexpr uint8_t mMaxDitherBits = 8;
+
+        /* Gamma corrected input, 0..65535 */
+        uint16_t mGammaTable[256];
+        /* Gamma, brightness and correction per channel, 8.8 fixed point output */
+        uint16_t mChannelTable[3][256];
+
+        /* LED output values per channel, 8.8 fixed point */
+        uint16_t mPixels[MATRIX_SIZE][3];
+        /* Fraction accumulated by the dithering per channel */
+        uint8_t  mResidual[MATRIX_SIZE][3];
+
+        CRGB     mCorrection     = CRGB(0xFFFFFF);
+        uint8_t  mDitherBits     = 0;
+        uint8_t  mBrightness     = 0xFF;    // invalid percentage, tables are built on the first call
+        bool     mNeedsDithering = false;
+    };
+
+}   /* end of namespace FramebufferNS */
@@ -0,0 +1,267 @@
+/*
+ * HandlerProfiler.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "HandlerProfiler.h"
+
+
+namespace HandlerProfilerNS
+{
+/**
+ * @brief Returns the upper bound of a histogram bucket in microseconds.
+ */
+static uint32_t BucketBoundUs(uint8_t aBucket)
+{
+    return static_cast<uint32_t>(1) << ((aBucket == (mProfilerHistogramBuckets - 1)) ? (aBucket - 1) : aBucket);
+}
+
+
+/**
+ *
+ * Implementation of the HandlerProfilerNS::HandlerProfiler class
+ *
+ */
+HandlerProfiler::HandlerProfiler()
+{
+    // do nothing
+}
+
+HandlerProfiler::~HandlerProfiler()
+{
+    // do nothing
+}
+
+/**
+ * @brief Registers a task to be profiled.
+ *
+ * @param aTaskHandle Handle of the task
+ * @return Profiled task to pass to Record(), mInvalidProfilerTask if all tasks are registered
+ */
+tProfilerTask HandlerProfiler::RegisterTask(TaskHandle_t aTaskHandle)
+{
+    tProfilerTask wTask = mInvalidProfilerTask;
+
+    portENTER_CRITICAL(&mLock);
+    if (mTaskCount < mProfilerTaskCount)
+    {
+        wTask = mTaskCount++;
+
+        mTasks[wTask].mTaskHandle = aTaskHandle;
+        mTasks[wTask].mStartUs    = static_cast<uint64_t>(esp_timer_get_time());
+        for (tHandlerStatistics& wStatistics : mTasks[wTask].mHandlers)
+        {
+            wStatistics = {};
+            wStatistics.mMinUs = UINT32_MAX;
+        }
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    return wTask;
+}
+
+/**
+ * @brief Records the execution time of a handler invocation.
+ *
+ * @param aTask Profiled task
+ * @param aHandler Handler, message ID, mHandlerTimer, mHandlerNotification or mHandlerFastEvent
+ * @param aDurationUs Execution time in microseconds
+ */
+void HandlerProfiler::Record(tProfilerTask aTask, tHandler aHandler, uint32_t aDurationUs)
+{
+    if ((aTask >= mTaskCount) || (aHandler >= mHandlerCount))
+    {
+        return;
+    }
+
+    /* Log2 bucket of the execution time */
+    uint8_t wBucket = (aDurationUs == 0) ? 0 : static_cast<uint8_t>(32 - __builtin_clz(aDurationUs));
+    if (wBucket >= mProfilerHistogramBuckets)
+    {
+        wBucket = mProfilerHistogramBuckets - 1;
+    }
+
+    portENTER_CRITICAL(&mLock);
+    tHandlerStatistics& wStatistics = mTasks[aTask].mHandlers[aHandler];
+
+    wStatistics.mCount++;
+    wStatistics.mTotalUs += aDurationUs;
+    if (aDurationUs < wStatistics.mMinUs)
+    {
+        wStatistics.mMinUs = aDurationUs;
+    }
+    if (aDurationUs > wStatistics.mMaxUs)
+    {
+        wStatistics.mMaxUs = aDurationUs;
+    }
+    if (wStatistics.mBuckets[wBucket] != UINT16_MAX)
+    {
+        wStatistics.mBuckets[wBucket]++;
+    }
+    portEXIT_CRITICAL(&mLock);
+}
+
+/**
+ * @brief Returns the execution time statistics of a handler.
+ *
+ * @param aTask Profiled task
+ * @param aHandler Handler, message ID, mHandlerTimer, mHandlerNotification or mHandlerFastEvent
+ * @param arStatistics Copy of the statistics
+ * @return true if the task is registered, false otherwise
+ */
+bool HandlerProfiler::GetStatistics(tProfilerTask aTask, tHandler aHandler, tHandlerStatistics& arStatistics)
+{
+    if ((aTask >= mTaskCount) || (aHandler >= mHandlerCount))
+    {
+        return false;
+    }
+
+    portENTER_CRITICAL(&mLock);
+    arStatistics = mTasks[aTask].mHandlers[aHandler];
+    portEXIT_CRITICAL(&mLock);
+
+    return true;
+}
+
+/**
+ * @brief Returns the summary of all handlers of a task.
+ *
+ * @param aTask Profiled task
+ * @param arSummary Summary of the task
+ * @return true if the task is registered, false otherwise
+ */
+bool HandlerProfiler::GetTaskSummary(tProfilerTask aTask, tTaskSummary& arSummary)
+{
+    if (aTask >= mTaskCount)
+    {
+        return false;
+    }
+
+    arSummary = {};
+    arSummary.mpName = pcTaskGetName(mTasks[aTask].mTaskHandle);
+
+    for (tHandler wHandler = 0; wHandler < mHandlerCount; wHandler++)
+    {
+        tHandlerStatistics wStatistics;
+        GetStatistics(aTask, wHandler, wStatistics);
+
+        arSummary.mCount  += wStatistics.mCount;
+        arSummary.mBusyUs += wStatistics.mTotalUs;
+        if (wStatistics.mMaxUs > arSummary.mMaxUs)
+        {
+            arSummary.mMaxUs      = wStatistics.mMaxUs;
+            arSummary.mMaxHandler = wHandler;
+        }
+    }
+
+    uint64_t wElapsedUs = static_cast<uint64_t>(esp_timer_get_time()) - mTasks[aTask].mStartUs;
+    if (wElapsedUs != 0)
+    {
+        arSummary.mCpuShare = static_cast<uint16_t>((arSummary.mBusyUs * 10000) / wElapsedUs);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Prints the handler statistics of all tasks on the serial console.
+ *
+ * @details
+ * Independent of the log configuration, so the statistics are also available in release builds.
+ */
+void HandlerProfiler::Dump(void)
+{
+    Serial.printf("[PRF] Handler profile at %lu ms\r\n", static_cast<unsigned long>(millis()));
+
+    for (tProfilerTask wTask = 0; wTask < mTaskCount; wTask++)
+    {
+        tTaskSummary wSummary;
+        GetTaskSummary(wTask, wSummary);
+
+        Serial.printf("[PRF] %-16s cpu %u.%02u %%, handled %lu, busy %lu ms, max %lu us\r\n",
+                wSummary.mpName, wSummary.mCpuShare / 100, wSummary.mCpuShare % 100,
+                static_cast<unsigned long>(wSummary.mCount),
+                static_cast<unsigned long>(wSummary.mBusyUs / 1000),
+                static_cast<unsigned long>(wSummary.mMaxUs));
+
+        for (tHandler wHandler = 0; wHandler < mHandlerCount; wHandler++)
+        {
+            tHandlerStatistics wStatistics;
+            GetStatistics(wTask, wHandler, wStatistics);
+            if (wStatistics.mCount == 0)
+            {
+                continue;
+            }
+
+            if (wHandler == mHandlerTimer)
+            {
+                Serial.printf("[PRF]   timer  ");
+            }
+            else if (wHandler == mHandlerNotification)
+            {
+                Serial.printf("[PRF]   notif. ");
+            }
+            else if (wHandler == mHandlerFastEvent)
+            {
+                Serial.printf("[PRF]   fast   ");
+            }
+            else
+            {
+                Serial.printf("[PRF]   msg %2u ", wHandler);
+            }
+
+            Serial.printf(" count %lu, min %lu us, avg %lu us, max %lu us, us:",
+                    static_cast<unsigned long>(wStatistics.mCount),
+                    static_cast<unsigned long>(wStatistics.mMinUs),
+                    static_cast<unsigned long>(wStatistics.mTotalUs / wStatistics.mCount),
+                    static_cast<unsigned long>(wStatistics.mMaxUs));
+
+            /* Print non-empty histogram buckets with their upper bound */
+            for (uint8_t wBucket = 0; wBucket < mProfilerHistogramBuckets; wBucket++)
+            {
+                if (wStatistics.mBuckets[wBucket] != 0)
+                {
+                    Serial.printf(" %s%lu:%u",
+                            (wBucket == (mProfilerHistogramBuckets - 1)) ? ">=" : "<",
+                            static_cast<unsigned long>(BucketBoundUs(wBucket)), wStatistics.mBuckets[wBucket]);
+                }
+            }
+            Serial.printf("\r\n");
+        }
+    }
+
+    DumpRuntimeStats();
+}
+
+/**
+ * @brief Prints the CPU share of the FreeRTOS runtime counters of the profiled tasks.
+ */
+void HandlerProfiler::DumpRuntimeStats(void)
+{
+#if (configGENERATE_RUN_TIME_STATS == 1)
+    UBaseType_t   wCount    = uxTaskGetNumberOfTasks();
+    TaskStatus_t* wpStatus  = new TaskStatus_t[wCount];
+    uint32_t      wTotalRunTime;
+
+    wCount = uxTaskGetSystemState(wpStatus, wCount, &wTotalRunTime);
+
+    for (UBaseType_t wI = 0; (wI < wCount) && (wTotalRunTime != 0); wI++)
+    {
+        for (tProfilerTask wTask = 0; wTask < mTaskCount; wTask++)
+        {
+            if (wpStatus[wI].xHandle == mTasks[wTask].mTaskHandle)
+            {
+                uint32_t wShare = static_cast<uint32_t>(
+                        (static_cast<uint64_t>(wpStatus[wI].ulRunTimeCounter) * 10000) / wTotalRunTime);
+                Serial.printf("[PRF] %-16s runtime cpu %lu.%02lu %%\r\n", wpStatus[wI].pcTaskName,
+                        static_cast<unsigned long>(wShare / 100), static_cast<unsigned long>(wShare % 100));
+            }
+        }
+    }
+
+    delete[] wpStatus;
+#endif /* (configGENERATE_RUN_TIME_STATS == 1) */
+}
+
+}   /* end of namespace HandlerProfilerNS */
@@ -0,0 +1,158 @@
+/*
+ * HandlerProfiler.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include <FreeRTOScpp.h>
+
+#include "Message.h"
+
+
+namespace HandlerProfilerNS
+{
+    /** @brief Number of tasks which can be profiled */
+    static constexpr uint8_t mProfilerTaskCount = 6;
+
+    /**
+     * @brief Number of handler duration histogram buckets.
+     *
+     * @details
+     * Bucket 0 counts durations below 1 us, bucket N (N > 0) durations from 2^(N-1) us to
+     * below 2^N us. The last bucket also counts all longer durations (above 262 ms).
+     */
+    static constexpr uint8_t mProfilerHistogramBuckets = 20;
+
+    /** @brief Profiled task, returned by HandlerProfiler::RegisterTask() */
+    typedef uint8_t tProfilerTask;
+
+    /** @brief Invalid profiled task, returned if all tasks are registered */
+    static constexpr tProfilerTask mInvalidProfilerTask = 0xFF;
+
+    /**
+     * @brief Profiled handler of a task.
+     *
+     * @details
+     * Messages are profiled per message ID, so the message IDs are used as handler index.
+     * Timer events, other notifications and fast events follow the message IDs.
+     */
+    typedef uint8_t tHandler;
+
+    /** @brief Handler of the timer events, Task::ProcessTimerEvent() */
+    static constexpr tHandler mHandlerTimer        = MessageNS::tMessageId::NB_OF_MESSAGE_IDS;
+    /** @brief Handler of the other notifications, Task::ProcessUnknownNotification() */
+    static constexpr tHandler mHandlerNotification = MessageNS::tMessageId::NB_OF_MESSAGE_IDS + 1;
+    /** @brief Handler of the fast events, Task::ProcessFastEvent() */
+    static constexpr tHandler mHandlerFastEvent    = MessageNS::tMessageId::NB_OF_MESSAGE_IDS + 2;
+    /** @brief Number of handlers per task */
+    static constexpr tHandler mHandlerCount        = MessageNS::tMessageId::NB_OF_MESSAGE_IDS + 3;
+
+    /**
+     * @brief Execution time statistics of a handler
+     */
+    struct tHandlerStatistics
+    {
+        /** @brief Number of invocations */
+        uint32_t mCount;
+        /** @brief Shortest execution time in microseconds */
+        uint32_t mMinUs;
+        /** @brief Longest execution time in microseconds */
+        uint32_t mMaxUs;
+        /** @brief Sum of the execution times in microseconds */
+        uint64_t mTotalUs;
+        /** @brief Execution time histogram, log2 buckets in microseconds (saturating) */
+        uint16_t mBuckets[mProfilerHistogramBuckets];
+    };
+
+    /**
+     * @brief Summary of a profiled task
+     */
+    struct tTaskSummary
+    {
+        /** @brief Name of the task */
+        const char* mpName;
+        /** @brief Number of handler invocations */
+        uint32_t    mCount;
+        /** @brief Time spent in handlers in microseconds */
+        uint64_t    mBusyUs;
+        /** @brief Share of the time since registration spent in handlers, in 1/100 % */
+        uint16_t    mCpuShare;
+        /** @brief Longest execution time of a handler in microseconds */
+        uint32_t    mMaxUs;
+        /** @brief Handler with the longest execution time */
+        tHandler    mMaxHandler;
+    };
+
+    /**
+     * @brief Measures the execution time of the message, timer and notification handlers of the tasks.
+     *
+     * @details
+     * The task loop measures every handler invocation with micros() and passes the duration
+     * to Record(), see HANDLER_PROFILE_START() and HANDLER_PROFILE_STOP(). Per task and handler
+     * the invocation count, min/avg/max and a log2 histogram of the execution times are kept.
+     *
+     * The CPU share of a task is the time spent in its handlers relative to the time since it
+     * was registered. The FreeRTOS runtime counters are only available with
+     * configGENERATE_RUN_TIME_STATS, which the Arduino core does not enable. If it is enabled,
+     * Dump() prints the CPU share of the runtime counters as well.
+     *
+     * Dump() prints the statistics on the serial console, GetTaskSummary() provides a summary
+     * for the web UI.
+     *
+     * Profiling is only compiled in with the build flag USE_HANDLER_PROFILER=true.
+     * Tasks shall be registered during the application initialization.
+     */
+    class HandlerProfiler
+    {
+    public:
+        HandlerProfiler();
+        virtual ~HandlerProfiler();
+
+        tProfilerTask RegisterTask(TaskHandle_t aTaskHandle);
+
+        void Record(tProfilerTask aTask, tHandler aHandler, uint32_t aDurationUs);
+
+        /** @brief Returns the number of registered tasks */
+        uint8_t GetTaskCount(void) const { return mTaskCount; }
+
+        bool GetStatistics(tProfilerTask aTask, tHandler aHandler, tHandlerStatistics& arStatistics);
+        bool GetTaskSummary(tProfilerTask aTask, tTaskSummary& arSummary);
+
+        void Dump(void);
+
+    private:
+        /** @brief Profiled task */
+        struct tTask
+        {
+            TaskHandle_t       mTaskHandle;
+            /** @brief Time of the registration in microseconds */
+            uint64_t           mStartUs;
+            tHandlerStatistics mHandlers[mHandlerCount];
+        };
+
+        portMUX_TYPE mLock = portMUX_INITIALIZER_UNLOCKED;
+
+        tTask   mTasks[mProfilerTaskCount] = {};
+        uint8_t mTaskCount = 0;
+
+        void DumpRuntimeStats(void);
+    };
+
+}   /* end of namespace HandlerProfilerNS */
+
+
+#if (USE_HANDLER_PROFILER == true)
+    /* Declare the object as extern for global access  */
+    extern HandlerProfilerNS::HandlerProfiler HandlerProfiler;
+
+    #define HANDLER_PROFILE_START(start)                uint32_t start = static_cast<uint32_t>(micros())
+    #define HANDLER_PROFILE_STOP(task, handler, start)  HandlerProfiler.Record((task), (handler), \
+                                                                static_cast<uint32_t>(micros()) - (start))
+#else
+    #define HANDLER_PROFILE_START(start)
+    #define HANDLER_PROFILE_STOP(task, handler, start)
+#endif /* (USE_HANDLER_PROFILER == true) */
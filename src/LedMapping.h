@@ -0,0 +1,160 @@
+/*
+ * LedMapping.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+
+namespace LedMappingNS
+{
+    /** @brief Order of the LEDs along the rows of the stripe */
+    enum tPanelWiring : uint8_t
+    {
+        /** @brief All rows run in the same direction */
+        WIRING_PROGRESSIVE = 0x00,
+        /** @brief Rows alternate their direction (zigzag) */
+        WIRING_SERPENTINE
+    };
+
+    /** @brief Corner of the LED matrix with the first LED of the stripe */
+    enum tPanelCorner : uint8_t
+    {
+        CORNER_TOP_LEFT = 0x00,
+        CORNER_TOP_RIGHT,
+        CORNER_BOTTOM_LEFT,
+        CORNER_BOTTOM_RIGHT
+    };
+
+    /** @brief Clockwise rotation of the LED matrix relative to the front panel */
+    enum tPanelRotation : uint8_t
+    {
+        ROTATION_0 = 0x00,
+        ROTATION_90,
+        ROTATION_180,
+        ROTATION_270
+    };
+
+    /**
+     * @brief Description of the wiring of an LED panel.
+     *
+     * @details
+     * A front panel position is first mirrored left-to-right (if mMirror is set), then rotated
+     * by mRotation onto the LED matrix. The stripe starts at mStartCorner of the LED matrix and
+     * runs along its rows, progressive or serpentine.
+     */
+    struct tPanelLayout
+    {
+        tPanelWiring   mWiring;
+        tPanelCorner   mStartCorner;
+        tPanelRotation mRotation;
+        bool           mMirror;
+    };
+
+    /**
+     * @brief Table of the stripe LED index of each front panel position.
+     *
+     * @details
+     * The table is built once from the panel description, usually at compile time, so rendering
+     * through it costs one lookup per LED whatever the wiring is. Front panel positions are
+     * numbered row by row, index = row * aWidth + column.
+     */
+    template<uint16_t aWidth, uint16_t aHeight>
+    class LedMap
+    {
+    public:
+        /** @brief Number of LEDs */
+        static constexpr uint16_t mNumbOfLeds = aWidth * aHeight;
+
+        constexpr explicit LedMap(const tPanelLayout& arLayout) : mLedIndex{}
+        {
+            const bool wSwapped = (arLayout.mRotation == ROTATION_90) || (arLayout.mRotation == ROTATION_270);
+
+            /* Size of the LED matrix */
+            const uint16_t wMatrixWidth  = wSwapped ? aHeight : aWidth;
+            const uint16_t wMatrixHeight = wSwapped ? aWidth  : aHeight;
+
+            const bool wStartTop  = (arLayout.mStartCorner == CORNER_TOP_LEFT) || (arLayout.mStartCorner == CORNER_TOP_RIGHT);
+            const bool wStartLeft = (arLayout.mStartCorner == CORNER_TOP_LEFT) || (arLayout.mStartCorner == CORNER_BOTTOM_LEFT);
+
+            for (uint16_t wRow = 0; wRow < aHeight; wRow++)
+            {
+                for (uint16_t wCol = 0; wCol < aWidth; wCol++)
+                {
+                    uint16_t wPanelCol = arLayout.mMirror ? (aWidth - 1 - wCol) : wCol;
+
+                    /* Position on the LED matrix */
+                    uint16_t wX = wPanelCol;
+                    uint16_t wY = wRow;
+                    switch (arLayout.mRotation)
+                    {
+                        case ROTATION_90:
+                            wX = aHeight - 1 - wRow;
+                            wY = wPanelCol;
+                            break;
+
+                        case ROTATION_180:
+                            wX = aWidth - 1 - wPanelCol;
+                            wY = aHeight - 1 - wRow;
+                            break;
+
+                        case ROTATION_270:
+                            wX = wRow;
+                            wY = aWidth - 1 - wPanelCol;
+                            break;
+
+                        default:
+                            break;
+                    }
+
+                    /* Position along the stripe */
+                    uint16_t wStripeRow = wStartTop ? wY : (wMatrixHeight - 1 - wY);
+                    bool     wForward   = wStartLeft;
+                    if ((arLayout.mWiring == WIRING_SERPENTINE) && ((wStripeRow % 2) != 0))
+                    {
+                        wForward = !wForward;
+                    }
+                    uint16_t wStripeCol = wForward ? wX : (wMatrixWidth - 1 - wX);
+
+                    mLedIndex[(wRow * aWidth) + wCol] = (wStripeRow * wMatrixWidth) + wStripeCol;
+                }
+            }
+        }
+
+        /** @brief Returns the stripe LED index of a front panel position */
+        constexpr uint16_t GetLedIndex(const uint16_t aIndex) const
+        {
+            return mLedIndex[aIndex];
+        }
+
+        /** @brief Returns the stripe LED index of a front panel row and column */
+        constexpr uint16_t GetLedIndex(const uint16_t aRow, const uint16_t aCol) const
+        {
+            return mLedIndex[(aRow * aWidth) + aCol];
+        }
+
+        /** @brief Returns true if each LED of the stripe is mapped exactly once */
+        constexpr bool IsValid(void) const
+        {
+            bool wUsed[mNumbOfLeds] = {};
+
+            for (uint16_t wI = 0; wI < mNumbOfLeds; wI++)
+            {
+                if ((mLedIndex[wI] >= mNumbOfLeds) || wUsed[mLedIndex[wI]])
+                {
+                    return false;
+                }
+                wUsed[mLedIndex[wI]] = true;
+            }
+            return true;
+        }
+
+    private:
+        /* Stripe LED index per front panel position */
+        uint16_t mLedIndex[mNumbOfLeds];
+    };
+
+}   /* end of namespace LedMappingNS */
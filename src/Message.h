@@ -26,14 +26,13 @@ namespace MessageNS
 
         /** @brief Total number of address (do not use as actual address) */
         NB_OF_ADDRESSES,
-
-        /* Special addresses for internal use in tasks */
-        TASK,
-        TASK_TIMER,
     };
 
     /**
      * @brief Message ID
+     *
+     * @details
+     * The payload type of each ID is bound in MessagePayload.h, a new ID needs a contract there.
      */
     enum tMessageId : uint8_t
     {
@@ -44,10 +43,6 @@ namespace MessageNS
         CMD_WIFI_START_SCAN,                // No payload
 
         /** Events       */
-        MSG_EVENT_SW_TIMER_TIMEOUT,         // Payload: 4 byte  - Timer ID
-
-        MSG_EVENT_SETTINGS_CHANGED,         // No payload
-
         MGS_EVENT_DATETIME_CHANGED,         // Payload: 4 bytes - Datetime as dword
 
         MGS_EVENT_NTP_LASTSYNC_TIME,        // No payload
@@ -58,7 +53,17 @@ namespace MessageNS
         MSG_EVENT_WIFI_AP_STARTED,          // No payload
         MSG_EVENT_WIFI_AP_STOPPED,          // No payload
         MSG_EVENT_WIFI_INTERNET_AVAILABLE,  // No payload
-        MSG_EVENT_WIFI_SCAN_DONE,           // No payload
+        MSG_EVENT_WIFI_SCAN_DONE,           // Payload: buffer  - Array of ConfigNS::tSSIDEntry
+
+        /** Requests     */
+        REQ_WIFI_STATUS,                    // No payload
+        REQ_NTP_LAST_SYNC,                  // No payload
+        REQ_MINUTE_LATENCY,                 // No payload
+
+        /** Responses    */
+        RSP_WIFI_STATUS,                    // Payload: 1 byte  - MessageNS::tWiFiStatus
+        RSP_NTP_LAST_SYNC,                  // Payload: 4 bytes - Time of the last NTP sync, 0 if never synced
+        RSP_MINUTE_LATENCY,                 // Payload: 4 bytes - MessageNS::tMinuteLatency
 
         /** Status       */
 
@@ -68,6 +73,34 @@ namespace MessageNS
         NB_OF_MESSAGE_IDS
     };
 
+    /**
+     * @brief Fast event ID
+     *
+     * @details
+     * Fast events carry no payload and bypass the message queues. Each fast event is a bit of
+     * the task notification value of the subscribed tasks, see ApplicationNS::Task::PublishFastEvent().
+     * Pending events with the same ID collapse into one, and they are dispatched ahead of the
+     * queued messages.
+     */
+    enum tFastEvent : uint8_t
+    {
+        FAST_EVENT_SETTINGS_CHANGED = 0x00, // Settings changed from the web UI
+
+        /** @brief Number of fast events available (do not use as actual event) */
+        NB_OF_FAST_EVENTS
+    };
+
+    /**
+     * @brief Type of the message payload
+     */
+    enum tPayloadType : uint8_t
+    {
+        /** @brief Payload is stored in the message */
+        PAYLOAD_INLINE = 0x00,
+        /** @brief Payload holds the handle of a BufferPoolNS::BufferPool buffer */
+        PAYLOAD_BUFFER,
+    };
+
     /**
      * @brief Definition of the structure of an message to communicate with a task.
      */
@@ -81,6 +114,11 @@ namespace MessageNS
         /** @brief Message ID */
         tMessageId mId;
 
+        /** @brief Correlation ID of a request and its response, 0 for other messages */
+        uint8_t  mCorrelationId = 0;
+
+        /** @brief Type of the payload */
+        tPayloadType mPayloadType = PAYLOAD_INLINE;
         /** @brief Length of the payload */
         uint8_t  mPayloadLength;
         /** @brief Payload of the message */
@@ -0,0 +1,214 @@
+/*
+ * MessageCoalescer.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "BufferPool.h"
+
+#include "MessageCoalescer.h"
+
+
+namespace ApplicationNS
+{
+/**
+ * @brief Constructor
+ */
+MessageCoalescer::MessageCoalescer()
+{
+    // do nothing
+}
+
+/**
+ * @brief Destructor
+ */
+MessageCoalescer::~MessageCoalescer()
+{
+    // do nothing
+}
+
+/**
+ * @brief Sets the coalescing policy of a message ID.
+ *
+ * @details
+ * Policies shall be set during the application initialization, before messages are sent.
+ *
+ * @param aMessageId ID of the message
+ * @param aPolicy Coalescing policy
+ */
+void MessageCoalescer::SetPolicy(MessageNS::tMessageId aMessageId, tCoalescingPolicy aPolicy)
+{
+    if (aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS)
+    {
+        mPolicies[aMessageId] = aPolicy;
+    }
+}
+
+/**
+ * @brief Returns the coalescing policy of a message ID.
+ */
+tCoalescingPolicy MessageCoalescer::GetPolicy(MessageNS::tMessageId aMessageId) const
+{
+    return (aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) ? mPolicies[aMessageId] : COALESCE_NONE;
+}
+
+/**
+ * @brief Merges a new message into a pending one (producer side).
+ *
+ * @details
+ * If no message with the same ID is pending, the ID is marked as pending and the message
+ * has to be queued. Otherwise the message is merged according to the policy and must not
+ * be queued. A buffer held by a dropped or replaced message is released.
+ *
+ * @param arMessage New message
+ * @return true if the message has to be added to the queue, false if it has been merged
+ */
+bool MessageCoalescer::Coalesce(const MessageNS::Message& arMessage)
+{
+    tCoalescingPolicy wPolicy = GetPolicy(arMessage.mId);
+    if (wPolicy == COALESCE_NONE)
+    {
+        return true;
+    }
+
+    const uint32_t wBit = static_cast<uint32_t>(1) << arMessage.mId;
+    bool wEnqueue;
+    BufferPoolNS::tBufferHandle wReleaseBuffer;
+
+    portENTER_CRITICAL(&mMux);
+
+    if ((mPendingMask & wBit) == 0)
+    {
+        /* First pending message with this ID */
+        mPendingMask  |= wBit;
+        mReplacedMask &= ~wBit;
+        mLatestMessages[arMessage.mId] = arMessage;
+
+        wEnqueue       = true;
+        wReleaseBuffer = BufferPoolNS::mInvalidBufferHandle;
+    }
+    else
+    {
+        mMergedCounts[arMessage.mId]++;
+
+        if (wPolicy == COALESCE_LATEST_WINS)
+        {
+            /* Replace pending message */
+            mReplacedMask |= wBit;
+            wReleaseBuffer = BufferPoolNS::GetBuffer(mLatestMessages[arMessage.mId]);
+            mLatestMessages[arMessage.mId] = arMessage;
+        }
+        else
+        {
+            /* Drop new message */
+            wReleaseBuffer = BufferPoolNS::GetBuffer(arMessage);
+        }
+
+        wEnqueue = false;
+    }
+
+    portEXIT_CRITICAL(&mMux);
+
+    /* Release buffer of the merged message outside of the critical section */
+    BufferPool.Release(wReleaseBuffer);
+
+    return wEnqueue;
+}
+
+/**
+ * @brief Clears the pending state of a message which could not be queued (producer side).
+ *
+ * @details
+ * Other producers may have replaced the message in its COALESCE_LATEST_WINS slot before
+ * the queue turned out to be full. Its buffer has then already been released by the merge,
+ * and the message is replaced by the latest one from the slot. The caller drops the returned
+ * message and releases its buffer, so each buffer is released exactly once.
+ *
+ * @param arMessage Message for which Coalesce() returned true, replaced by the latest merged
+ *                  message if there is one
+ */
+void MessageCoalescer::Cancel(MessageNS::Message& arMessage)
+{
+    if (GetPolicy(arMessage.mId) != COALESCE_NONE)
+    {
+        const uint32_t wBit = static_cast<uint32_t>(1) << arMessage.mId;
+
+        portENTER_CRITICAL(&mMux);
+
+        if ((mReplacedMask & wBit) != 0)
+        {
+            /* The slot holds a later message, it owns the buffer now */
+            arMessage = mLatestMessages[arMessage.mId];
+        }
+        mPendingMask  &= ~wBit;
+        mReplacedMask &= ~wBit;
+
+        portEXIT_CRITICAL(&mMux);
+    }
+}
+
+/**
+ * @brief Resolves a message taken from the queue (receiving task side).
+ *
+ * @details
+ * Clears the pending state of the message ID, so the next message with this ID will be
+ * queued again. For COALESCE_LATEST_WINS the message is replaced by the latest one.
+ *
+ * @param arMessage Message taken from the queue, replaced by the latest message if required
+ */
+void MessageCoalescer::Resolve(MessageNS::Message& arMessage)
+{
+    tCoalescingPolicy wPolicy = GetPolicy(arMessage.mId);
+    if (wPolicy == COALESCE_NONE)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&mMux);
+
+    mPendingMask  &= ~(static_cast<uint32_t>(1) << arMessage.mId);
+    mReplacedMask &= ~(static_cast<uint32_t>(1) << arMessage.mId);
+
+    if (wPolicy == COALESCE_LATEST_WINS)
+    {
+        arMessage = mLatestMessages[arMessage.mId];
+    }
+
+    portEXIT_CRITICAL(&mMux);
+}
+
+/**
+ * @brief Returns the number of merged messages of a message ID.
+ */
+uint32_t MessageCoalescer::GetMergedCount(MessageNS::tMessageId aMessageId) const
+{
+    uint32_t wCount = 0;
+
+    if (aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS)
+    {
+        portENTER_CRITICAL(&mMux);
+        wCount = mMergedCounts[aMessageId];
+        portEXIT_CRITICAL(&mMux);
+    }
+
+    return wCount;
+}
+
+/**
+ * @brief Returns the number of merged messages of all message IDs.
+ */
+uint32_t MessageCoalescer::GetMergedCount(void) const
+{
+    uint32_t wCount = 0;
+
+    portENTER_CRITICAL(&mMux);
+    for (uint32_t wMergedCount : mMergedCounts)
+    {
+        wCount += wMergedCount;
+    }
+    portEXIT_CRITICAL(&mMux);
+
+    return wCount;
+}
+
+}   /* end of namespace ApplicationNS */
@@ -0,0 +1,83 @@
+/*
+ * MessageCoalescer.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include "Message.h"
+
+
+namespace ApplicationNS
+{
+    /**
+     * @brief Coalescing policy of a message ID
+     */
+    enum tCoalescingPolicy : uint8_t
+    {
+        /** @brief Every message is queued */
+        COALESCE_NONE = 0x00,
+        /** @brief A message is dropped while another one with the same ID is pending */
+        COALESCE_AT_MOST_ONE,
+        /** @brief A message replaces the pending one with the same ID */
+        COALESCE_LATEST_WINS,
+    };
+
+    /**
+     * @brief Merges idempotent events pending in a task message queue.
+     *
+     * @details
+     * The coalescer tracks which message IDs with a coalescing policy are pending in the
+     * queue of one task. When such a message arrives while another one with the same ID
+     * is still pending, it is not queued again:
+     *  - COALESCE_AT_MOST_ONE drops the new message, the pending one stays as is.
+     *  - COALESCE_LATEST_WINS stores the new message in a slot, the pending queue entry
+     *    is replaced by the content of this slot when it is dequeued.
+     * Each merged message is counted per message ID.
+     *
+     * Coalesce() is called by the producers (any task) before the message is added to the
+     * queue, Resolve() by the receiving task after the message has been taken from the
+     * queue. A short critical section protects the pending state.
+     */
+    class MessageCoalescer
+    {
+    public:
+        MessageCoalescer();
+        virtual ~MessageCoalescer();
+
+        void SetPolicy(MessageNS::tMessageId aMessageId, tCoalescingPolicy aPolicy);
+        tCoalescingPolicy GetPolicy(MessageNS::tMessageId aMessageId) const;
+
+        bool Coalesce(const MessageNS::Message& arMessage);
+        void Cancel(MessageNS::Message& arMessage);
+        void Resolve(MessageNS::Message& arMessage);
+
+        uint32_t GetMergedCount(MessageNS::tMessageId aMessageId) const;
+        uint32_t GetMergedCount(void) const;
+
+    private:
+        static_assert(MessageNS::tMessageId::NB_OF_MESSAGE_IDS <= 32, "Pending mask is limited to 32 message IDs");
+
+        /** @brief Coalescing policy per message ID */
+        tCoalescingPolicy mPolicies[MessageNS::tMessageId::NB_OF_MESSAGE_IDS] = {};
+
+        /** @brief Pending messages, bit N is set if a message with ID N is queued */
+        uint32_t mPendingMask = 0;
+
+        /** @brief Replaced messages, bit N is set if the pending message with ID N has been replaced in its slot */
+        uint32_t mReplacedMask = 0;
+
+        /** @brief Latest message per message ID (COALESCE_LATEST_WINS only) */
+        MessageNS::Message mLatestMessages[MessageNS::tMessageId::NB_OF_MESSAGE_IDS];
+
+        /** @brief Number of merged messages per message ID */
+        uint32_t mMergedCounts[MessageNS::tMessageId::NB_OF_MESSAGE_IDS] = {};
+
+        /** @brief Protects the pending state */
+        mutable portMUX_TYPE mMux = portMUX_INITIALIZER_UNLOCKED;
+    };
+
+}   /* end of namespace ApplicationNS */
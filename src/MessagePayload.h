@@ -0,0 +1,254 @@
+/*
+ * MessagePayload.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Message.h"
+#include "BufferPool.h"
+
+
+namespace MessageNS
+{
+    /**
+     * @brief Payload type of messages without payload
+     */
+    struct tNoPayload
+    {
+    };
+
+    /**
+     * @brief Connection status of the WiFi manager (payload of RSP_WIFI_STATUS)
+     */
+    enum tWiFiStatus : uint8_t
+    {
+        WIFI_STATUS_NOT_CONNECTED = 0x00,
+        WIFI_STATUS_CONNECTING,
+        WIFI_STATUS_ONLINE,
+        WIFI_STATUS_AP_MODE,
+    };
+
+    /**
+     * @brief Latency of the minute change behind the minute boundary of the system clock
+     *        (payload of RSP_MINUTE_LATENCY)
+     */
+    struct tMinuteLatency
+    {
+        /** @brief Latency of the last minute change in milliseconds */
+        uint16_t mLastMs;
+        /** @brief Maximal latency since start in milliseconds */
+        uint16_t mMaxMs;
+    };
+
+    /**
+     * @brief Payload contract of a message ID.
+     *
+     * @details
+     * Each message ID is bound to exactly one payload type by a specialization, see
+     * MESSAGE_PAYLOAD() below. The primary template is not defined, so using an ID without
+     * contract does not compile.
+     */
+    template<tMessageId Id>
+    struct tPayloadTraits;
+
+    /** @brief Payload type bound to a message ID */
+    template<tMessageId Id>
+    using PayloadType = typename tPayloadTraits<Id>::Type;
+
+    /**
+     * @brief Binds a message ID to a payload type stored in the message (inline payload)
+     */
+    #define MESSAGE_PAYLOAD(id, type)                                                                   \
+        template<> struct tPayloadTraits<tMessageId::id>                                                \
+        {                                                                                               \
+            using Type = type;                                                                          \
+            static constexpr tPayloadType mcPayloadType = tPayloadType::PAYLOAD_INLINE;                 \
+        }
+
+    /**
+     * @brief Binds a message ID to a payload carried in a BufferPoolNS::BufferPool buffer
+     */
+    #define MESSAGE_BUFFER_PAYLOAD(id)                                                                  \
+        template<> struct tPayloadTraits<tMessageId::id>                                                \
+        {                                                                                               \
+            using Type = BufferPoolNS::tBufferHandle;                                                   \
+            static constexpr tPayloadType mcPayloadType = tPayloadType::PAYLOAD_BUFFER;                 \
+        }
+
+    /* Commands */
+    MESSAGE_PAYLOAD(NONE,                               tNoPayload);
+    MESSAGE_PAYLOAD(CMD_WIFI_CONNECT,                   tNoPayload);
+    MESSAGE_PAYLOAD(CMD_WIFI_START_SCAN,                tNoPayload);
+    /* Events */
+    MESSAGE_PAYLOAD(MGS_EVENT_DATETIME_CHANGED,         uint32_t);      // Datetime as dword
+    MESSAGE_PAYLOAD(MGS_EVENT_NTP_LASTSYNC_TIME,        tNoPayload);
+    MESSAGE_PAYLOAD(MGS_EVENT_WIFI_EVENT_TRIGGERED,     uint8_t);       // WiFiEvent_t
+    MESSAGE_PAYLOAD(MSG_EVENT_WIFI_STA_CONNECTED,       tNoPayload);
+    MESSAGE_PAYLOAD(MSG_EVENT_WIFI_STA_DISCONNECTED,    tNoPayload);
+    MESSAGE_PAYLOAD(MSG_EVENT_WIFI_AP_STARTED,          tNoPayload);
+    MESSAGE_PAYLOAD(MSG_EVENT_WIFI_AP_STOPPED,          tNoPayload);
+    MESSAGE_PAYLOAD(MSG_EVENT_WIFI_INTERNET_AVAILABLE,  tNoPayload);
+    MESSAGE_BUFFER_PAYLOAD(MSG_EVENT_WIFI_SCAN_DONE);                   // Array of ConfigNS::tSSIDEntry
+    /* Requests */
+    MESSAGE_PAYLOAD(REQ_WIFI_STATUS,                    tNoPayload);
+    MESSAGE_PAYLOAD(REQ_NTP_LAST_SYNC,                  tNoPayload);
+    MESSAGE_PAYLOAD(REQ_MINUTE_LATENCY,                 tNoPayload);
+    /* Responses */
+    MESSAGE_PAYLOAD(RSP_WIFI_STATUS,                    tWiFiStatus);
+    MESSAGE_PAYLOAD(RSP_NTP_LAST_SYNC,                  uint32_t);      // Unix time of the last sync, 0 if never synced
+    MESSAGE_PAYLOAD(RSP_MINUTE_LATENCY,                 tMinuteLatency);
+
+    #undef MESSAGE_PAYLOAD
+    #undef MESSAGE_BUFFER_PAYLOAD
+
+    /**
+     * @brief Response message ID of a request message ID.
+     *
+     * @details
+     * Only defined for request IDs, see MESSAGE_RESPONSE() below.
+     */
+    template<tMessageId Id>
+    struct tResponseTraits;
+
+    /**
+     * @brief Binds a request message ID to its response message ID
+     */
+    #define MESSAGE_RESPONSE(request, response)                                                         \
+        template<> struct tResponseTraits<tMessageId::request>                                          \
+        {                                                                                               \
+            static constexpr tMessageId mcResponseId = tMessageId::response;                            \
+        }
+
+    MESSAGE_RESPONSE(REQ_WIFI_STATUS,                   RSP_WIFI_STATUS);
+    MESSAGE_RESPONSE(REQ_NTP_LAST_SYNC,                 RSP_NTP_LAST_SYNC);
+    MESSAGE_RESPONSE(REQ_MINUTE_LATENCY,                RSP_MINUTE_LATENCY);
+
+    #undef MESSAGE_RESPONSE
+
+    /** @brief Response message ID bound to a request message ID */
+    template<tMessageId Id>
+    inline constexpr tMessageId ResponseId = tResponseTraits<Id>::mcResponseId;
+
+    /**
+     * @brief Checks at compile time that the contract of a message ID is complete and valid
+     */
+    template<tMessageId Id>
+    constexpr bool IsValidPayloadContract(void)
+    {
+        using tType = PayloadType<Id>;
+
+        static_assert(std::is_trivially_copyable<tType>::value, "Payload type must be trivially copyable");
+        static_assert(std::is_empty<tType>::value || (sizeof(tType) <= mMessagePayloadLen),
+                "Payload type does not fit into the message payload");
+
+        return true;
+    }
+
+    template<uint8_t... Ids>
+    constexpr bool AreValidPayloadContracts(std::integer_sequence<uint8_t, Ids...>)
+    {
+        return (IsValidPayloadContract<static_cast<tMessageId>(Ids)>() && ...);
+    }
+
+    /* Every message ID must have a valid payload contract */
+    static_assert(AreValidPayloadContracts(std::make_integer_sequence<uint8_t, tMessageId::NB_OF_MESSAGE_IDS>{}),
+            "Invalid message payload contract");
+
+    /**
+     * @brief Creates a message with the payload bound to its ID.
+     *
+     * @details
+     * The payload must be of exactly the type bound to the message ID and is omitted for
+     * messages without payload, any mismatch fails to compile. The payload is copied into
+     * the message, there are no runtime size checks. The destination of published messages
+     * is set by the communication manager, MessageNS::tAddress::APPLICATION_MANAGER can be
+     * passed as placeholder.
+     *
+     * For messages with buffer payload the buffer handle is stored, the reference owned
+     * by the caller is not transferred to the message.
+     *
+     * Usage: MakeMessage<tMessageId::MGS_EVENT_DATETIME_CHANGED>(wSource, wDestination, wDword)
+     *
+     * @param aSource Source address
+     * @param aDestination Destination address
+     * @param arPayload Payload, none for messages without payload
+     * @return Message ready to be sent or published
+     */
+    template<tMessageId Id, class... T>
+    inline Message MakeMessage(tAddress aSource, tAddress aDestination, const T&... arPayload)
+    {
+        using tType = PayloadType<Id>;
+
+        static_assert(std::is_empty<tType>::value ? (sizeof...(T) == 0) :
+                ((sizeof...(T) == 1) && (std::is_same<std::decay_t<T>, tType>::value && ...)),
+                "Payload does not match the type bound to the message ID");
+
+        Message wMessage;
+        wMessage.mSource        = aSource;
+        wMessage.mDestination   = aDestination;
+        wMessage.mId            = Id;
+        wMessage.mPayloadType   = tPayloadTraits<Id>::mcPayloadType;
+        wMessage.mPayloadLength = std::is_empty<tType>::value ? 0 : sizeof(tType);
+
+        /* Copy payload, if any */
+        (memcpy(wMessage.mPayload, &arPayload, sizeof(tType)), ...);
+
+        return wMessage;
+    }
+
+    /**
+     * @brief Returns the payload of a message as the type bound to its ID.
+     *
+     * @details
+     * The ID of the message must match, this is only checked in debug builds.
+     *
+     * Usage: uint32_t wDword = GetPayload<tMessageId::MGS_EVENT_DATETIME_CHANGED>(arMessage)
+     *
+     * @param arMessage Message with ID Id
+     * @return Payload of the message
+     */
+    template<tMessageId Id>
+    inline PayloadType<Id> GetPayload(const Message& arMessage)
+    {
+        using tType = PayloadType<Id>;
+
+        static_assert(!std::is_empty<tType>::value, "Message ID has no payload");
+
+        assert(arMessage.mId == Id);
+
+        tType wPayload;
+        memcpy(&wPayload, arMessage.mPayload, sizeof(tType));
+        return wPayload;
+    }
+
+    /**
+     * @brief Creates the response to a request with the payload bound to the response ID.
+     *
+     * @details
+     * The response is addressed to the source of the request and carries its correlation ID.
+     *
+     * Usage: SendMessage(MakeResponse<tMessageId::REQ_WIFI_STATUS>(arRequest, wStatus))
+     *
+     * @param arRequest Request message with ID Id
+     * @param arPayload Payload, none for responses without payload
+     * @return Response message ready to be sent
+     */
+    template<tMessageId Id, class... T>
+    inline Message MakeResponse(const Message& arRequest, const T&... arPayload)
+    {
+        assert(arRequest.mId == Id);
+
+        Message wMessage = MakeMessage<ResponseId<Id>>(arRequest.mDestination, arRequest.mSource, arPayload...);
+        wMessage.mCorrelationId = arRequest.mCorrelationId;
+        return wMessage;
+    }
+
+}; /* end of namespace MessageNS */
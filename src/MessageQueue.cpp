@@ -0,0 +1,238 @@
+/*
+ * MessageQueue.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "MessageQueue.h"
+
+
+namespace ApplicationNS
+{
+/**
+ * @brief Constructor
+ *
+ * @param apCritical Lane of the time-critical messages
+ * @param apCommand Lane of the commands
+ * @param apBackground Lane of the background events
+ * @param aLaneSize Number of messages per lane
+ */
+MessageQueue::MessageQueue(LaneQueueBase* apCritical, LaneQueueBase* apCommand, LaneQueueBase* apBackground,
+        uint8_t aLaneSize)
+    : mpLanes{ apCritical, apCommand, apBackground }, mLaneSize(aLaneSize)
+{
+    for (tLaneCounters& wCounters : mCounters)
+    {
+        wCounters.mHighWaterMark = 0;
+        wCounters.mEnqueued      = 0;
+        wCounters.mDropped       = 0;
+        wCounters.mDequeued      = 0;
+        wCounters.mTotalWaitUs   = 0;
+        wCounters.mMaxWaitUs     = 0;
+    }
+
+    for (tMessageLane& wLane : mMessageLanes)
+    {
+        wLane = LANE_BACKGROUND;
+    }
+}
+
+/**
+ * @brief Destructor
+ */
+MessageQueue::~MessageQueue()
+{
+    // do nothing
+}
+
+/**
+ * @brief Assigns a message ID to a lane.
+ *
+ * @details
+ * Lanes shall be assigned during the application initialization, before messages are sent.
+ *
+ * @param aMessageId ID of the message
+ * @param aLane Lane of the message
+ */
+void MessageQueue::SetLane(MessageNS::tMessageId aMessageId, tMessageLane aLane)
+{
+    if ((aMessageId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) && (aLane < NB_OF_LANES))
+    {
+        mMessageLanes[aMessageId] = aLane;
+    }
+}
+
+/**
+ * @brief Returns the lane of a message.
+ */
+tMessageLane MessageQueue::GetLane(const MessageNS::Message& arMessage) const
+{
+    return (arMessage.mId < MessageNS::tMessageId::NB_OF_MESSAGE_IDS) ?
+            mMessageLanes[arMessage.mId] : LANE_BACKGROUND;
+}
+
+/**
+ * @brief Adds a message to its lane without waiting (any task).
+ *
+ * @param arMessage Message to add
+ * @param arNotify Set to true if the task has to be notified about the new message
+ * @return true if the message has been added, false if the lane is full
+ */
+bool MessageQueue::Add(const MessageNS::Message& arMessage, bool& arNotify)
+{
+    const tMessageLane wLane     = GetLane(arMessage);
+    tLaneCounters&     wCounters = mCounters[wLane];
+
+    tEntry wEntry;
+    wEntry.mMessage     = arMessage;
+    wEntry.mTimestampUs = static_cast<uint32_t>(micros());
+
+#if (USE_RINGBUFFER_MSG_QUEUE == true)
+    /* Notify only on the empty-to-non-empty edge */
+    bool wAdded = mpLanes[wLane]->add(wEntry, 0, &arNotify);
+#else
+    arNotify = true;
+    bool wAdded = mpLanes[wLane]->add(wEntry, 0);
+#endif /* (USE_RINGBUFFER_MSG_QUEUE == true) */
+
+    if (wAdded == false)
+    {
+        wCounters.mDropped.fetch_add(1, std::memory_order_relaxed);
+        arNotify = false;
+        return false;
+    }
+
+    wCounters.mEnqueued.fetch_add(1, std::memory_order_relaxed);
+
+    /* Update high-water mark */
+    uint8_t wDepth     = static_cast<uint8_t>(mpLanes[wLane]->waiting());
+    uint8_t wHighWater = wCounters.mHighWaterMark.load(std::memory_order_relaxed);
+    while ((wDepth > wHighWater) &&
+           !wCounters.mHighWaterMark.compare_exchange_weak(wHighWater, wDepth, std::memory_order_relaxed))
+    {
+        // retry with updated high-water mark
+    }
+
+    return true;
+}
+
+/**
+ * @brief Takes the oldest message of the highest non-empty lane (owning task only).
+ *
+ * @param arMessage Variable to store the message
+ * @return true if a message has been taken, false if all lanes are empty
+ */
+bool MessageQueue::Pop(MessageNS::Message& arMessage)
+{
+    return (PopBatch(&arMessage, 1) != 0);
+}
+
+/**
+ * @brief Takes up to aMaxCount messages, the highest lane first and each lane in FIFO order (owning task only).
+ *
+ * @param apMessages Buffer to store the messages, at least aMaxCount messages
+ * @param aMaxCount Maximal number of messages to take
+ * @return Number of messages taken, 0 if all lanes are empty
+ */
+uint8_t MessageQueue::PopBatch(MessageNS::Message* apMessages, uint8_t aMaxCount)
+{
+    tEntry   wEntry;
+    uint8_t  wCount = 0;
+    uint32_t wNowUs = static_cast<uint32_t>(micros());
+
+    for (uint8_t wLane = 0; (wLane < NB_OF_LANES) && (wCount < aMaxCount); wLane++)
+    {
+        while ((wCount < aMaxCount) && mpLanes[wLane]->pop(wEntry, 0))
+        {
+            /* Measure time spent in the lane, a message added after the clock was read waited 0 us */
+            int32_t wWaitUs = static_cast<int32_t>(wNowUs - wEntry.mTimestampUs);
+            CountWait(wLane, (wWaitUs > 0) ? static_cast<uint32_t>(wWaitUs) : 0);
+
+            apMessages[wCount++] = wEntry.mMessage;
+        }
+    }
+
+    return wCount;
+}
+
+/**
+ * @brief Counts a taken message and the time it waited in the lane.
+ */
+void MessageQueue::CountWait(uint8_t aLane, uint32_t aWaitUs)
+{
+    tLaneCounters& wCounters = mCounters[aLane];
+
+    wCounters.mDequeued++;
+    wCounters.mTotalWaitUs += aWaitUs;
+    if (aWaitUs > wCounters.mMaxWaitUs)
+    {
+        wCounters.mMaxWaitUs = aWaitUs;
+    }
+
+    /* Count wait time in the log2 bucket */
+    uint8_t wBucket = (aWaitUs == 0) ? 0 : static_cast<uint8_t>(32 - __builtin_clz(aWaitUs));
+    if (wBucket >= mLatencyHistogramBuckets)
+    {
+        wBucket = mLatencyHistogramBuckets - 1;
+    }
+    mLatencyHistogram.mBuckets[wBucket]++;
+}
+
+/**
+ * @brief Checks if all lanes are empty.
+ */
+bool MessageQueue::Empty(void) const
+{
+    for (const LaneQueueBase* wpLane : mpLanes)
+    {
+        if (wpLane->waiting() != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns the usage statistics of a lane.
+ *
+ * @details
+ * The wait time counters are updated by the owning task, values read by another task
+ * are a snapshot which may be one message behind.
+ *
+ * @param aLane Lane
+ * @return Copy of the current statistics, all zero if the lane is invalid
+ */
+tLaneStatistics MessageQueue::GetStatistics(tMessageLane aLane) const
+{
+    tLaneStatistics wStatistics = {};
+
+    if (aLane < NB_OF_LANES)
+    {
+        const tLaneCounters& wCounters = mCounters[aLane];
+
+        wStatistics.mDepth         = static_cast<uint8_t>(mpLanes[aLane]->waiting());
+        wStatistics.mHighWaterMark = wCounters.mHighWaterMark.load(std::memory_order_relaxed);
+        wStatistics.mEnqueued      = wCounters.mEnqueued.load(std::memory_order_relaxed);
+        wStatistics.mDropped       = wCounters.mDropped.load(std::memory_order_relaxed);
+        wStatistics.mDequeued      = wCounters.mDequeued;
+        wStatistics.mMaxWaitUs     = wCounters.mMaxWaitUs;
+        wStatistics.mAverageWaitUs = (wCounters.mDequeued != 0) ?
+                static_cast<uint32_t>(wCounters.mTotalWaitUs / wCounters.mDequeued) : 0;
+    }
+
+    return wStatistics;
+}
+
+/**
+ * @brief Returns the wait time histogram of all lanes.
+ *
+ * @return Copy of the current histogram
+ */
+tLatencyHistogram MessageQueue::GetLatencyHistogram(void) const
+{
+    return mLatencyHistogram;
+}
+
+}   /* end of namespace ApplicationNS */
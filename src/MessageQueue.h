@@ -0,0 +1,203 @@
+/*
+ * MessageQueue.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include <FreeRTOScpp.h>
+#include <QueueCPP.h>
+
+#include "Message.h"
+#include "RingBufferQueue.h"
+
+
+namespace ApplicationNS
+{
+    /**
+     * @brief Priority lane of a task message queue
+     *
+     * @details
+     * Lanes are drained in ascending order, a message is only taken from a lane when all
+     * lanes with a lower number are empty.
+     */
+    enum tMessageLane : uint8_t
+    {
+        /** @brief Time-critical events */
+        LANE_CRITICAL = 0x00,
+        /** @brief Commands */
+        LANE_COMMAND,
+        /** @brief Background events */
+        LANE_BACKGROUND,
+
+        /** @brief Number of lanes (do not use as actual lane) */
+        NB_OF_LANES
+    };
+
+    /**
+     * @brief Usage statistics of a lane
+     */
+    struct tLaneStatistics
+    {
+        /** @brief Number of messages currently in the lane */
+        uint8_t  mDepth;
+        /** @brief Maximal number of messages in the lane at the same time */
+        uint8_t  mHighWaterMark;
+        /** @brief Number of messages added to the lane */
+        uint32_t mEnqueued;
+        /** @brief Number of messages dropped because the lane was full */
+        uint32_t mDropped;
+        /** @brief Number of messages taken from the lane */
+        uint32_t mDequeued;
+        /** @brief Average time in microseconds a message waited in the lane */
+        uint32_t mAverageWaitUs;
+        /** @brief Maximal time in microseconds a message waited in the lane */
+        uint32_t mMaxWaitUs;
+    };
+
+    /**
+     * @brief Number of buckets of the wait time histogram.
+     *
+     * @details
+     * Bucket 0 counts waits below 1 us, bucket N (N > 0) waits from 2^(N-1) us to below 2^N us.
+     * The last bucket also counts all longer waits.
+     */
+    static constexpr uint8_t mLatencyHistogramBuckets = 20;
+
+    /**
+     * @brief Histogram of the time messages waited in a queue, log2 buckets in microseconds
+     */
+    struct tLatencyHistogram
+    {
+        uint32_t mBuckets[mLatencyHistogramBuckets];
+    };
+
+    /**
+     * @brief Default number of messages per lane.
+     *
+     * @details
+     * The lane size of each task is set in its tTaskConfig. With the build flag
+     * USE_RINGBUFFER_MSG_QUEUE=true the lanes use the lock-free RingBufferNS::RingBufferQueue
+     * instead of the FreeRTOS queue, the size should then be a power of two.
+     */
+    static constexpr uint8_t mDefaultMessageLaneSize = 8;
+
+    /**
+     * @brief Message queue of an application task with priority lanes.
+     *
+     * @details
+     * The queue holds one FIFO per lane. Each message ID is assigned to a lane with SetLane(),
+     * by default messages are background events. TaskGraph sets the lanes of all queues from
+     * ConfigNS::mcLaneRules: the date and time changed event is critical, commands, requests and
+     * responses go to the command lane. Timers do not pass through the queue, the timer service
+     * notifies the task directly. Pop() takes the oldest message of the highest non-empty lane,
+     * so a burst of background events can not delay a time-critical message by more than the
+     * message currently being processed.
+     *
+     * PopBatch() takes up to a given number of messages at once, the highest lane first, and
+     * reads the time only once for all of them. A time-critical message added while the batch
+     * is processed is taken with the next batch.
+     *
+     * Add() can be called from any task, Pop() and PopBatch() only from the task owning the
+     * queue. Each entry is stamped on Add(), the time it waited in the lane is measured when
+     * it is taken and counted in the lane statistics and in a log2 histogram of the queue.
+     *
+     * The lanes are provided by the derived StaticMessageQueue, which sets their size.
+     */
+    class MessageQueue
+    {
+    protected:
+        /** @brief Queued message with its enqueue time */
+        struct tEntry
+        {
+            MessageNS::Message mMessage;
+            uint32_t           mTimestampUs;
+        };
+
+#if (USE_RINGBUFFER_MSG_QUEUE == true)
+        using LaneQueueBase = RingBufferNS::RingBufferQueueBase<tEntry>;
+        template<uint8_t aLaneSize>
+        using LaneQueue     = RingBufferNS::RingBufferQueue<tEntry, aLaneSize>;
+#else
+        using LaneQueueBase = FreeRTOScpp::QueueTypeBase<tEntry>;
+        template<uint8_t aLaneSize>
+        using LaneQueue     = FreeRTOScpp::Queue<tEntry, aLaneSize>;
+#endif /* (USE_RINGBUFFER_MSG_QUEUE == true) */
+
+        MessageQueue(LaneQueueBase* apCritical, LaneQueueBase* apCommand, LaneQueueBase* apBackground,
+                uint8_t aLaneSize);
+
+    public:
+        virtual ~MessageQueue();
+
+        void SetLane(MessageNS::tMessageId aMessageId, tMessageLane aLane);
+        tMessageLane GetLane(const MessageNS::Message& arMessage) const;
+
+        bool Add(const MessageNS::Message& arMessage, bool& arNotify);
+        bool Pop(MessageNS::Message& arMessage);
+        uint8_t PopBatch(MessageNS::Message* apMessages, uint8_t aMaxCount);
+        bool Empty(void) const;
+
+        tLaneStatistics GetStatistics(tMessageLane aLane) const;
+        tLatencyHistogram GetLatencyHistogram(void) const;
+
+        /** @brief Returns the number of messages per lane */
+        uint8_t GetLaneSize(void) const { return mLaneSize; }
+
+    private:
+        /** @brief Counters of a lane, updated by the producers (atomic) and the owning task */
+        struct tLaneCounters
+        {
+            std::atomic<uint8_t>  mHighWaterMark;
+            std::atomic<uint32_t> mEnqueued;
+            std::atomic<uint32_t> mDropped;
+            uint32_t mDequeued;
+            uint64_t mTotalWaitUs;
+            uint32_t mMaxWaitUs;
+        };
+
+        LaneQueueBase* const mpLanes[NB_OF_LANES];
+        const uint8_t        mLaneSize;
+        tLaneCounters        mCounters[NB_OF_LANES];
+
+        /** @brief Wait time histogram of all lanes, updated by the owning task */
+        tLatencyHistogram mLatencyHistogram = {};
+
+        /** @brief Lane per message ID */
+        tMessageLane mMessageLanes[MessageNS::tMessageId::NB_OF_MESSAGE_IDS];
+
+        void CountWait(uint8_t aLane, uint32_t aWaitUs);
+    };
+
+    /**
+     * @brief Message queue with lanes of aLaneSize messages as members.
+     *
+     * @details
+     * The lanes are part of the object, so a queue declared with static storage duration
+     * needs no heap (the FreeRTOS queues use static allocation).
+     */
+    template<uint8_t aLaneSize>
+    class StaticMessageQueue : public MessageQueue
+    {
+        static_assert(aLaneSize > 0, "Lane size must not be zero");
+#if (USE_RINGBUFFER_MSG_QUEUE == true)
+        static_assert((aLaneSize & (aLaneSize - 1)) == 0, "Lane size of the ring buffer must be a power of two");
+#endif /* (USE_RINGBUFFER_MSG_QUEUE == true) */
+
+    public:
+        StaticMessageQueue()
+            : MessageQueue(&mLaneQueues[LANE_CRITICAL], &mLaneQueues[LANE_COMMAND], &mLaneQueues[LANE_BACKGROUND],
+                    aLaneSize)
+        {
+            // do nothing
+        }
+
+    private:
+        LaneQueue<aLaneSize> mLaneQueues[NB_OF_LANES];
+    };
+
+}   /* end of namespace ApplicationNS */
@@ -0,0 +1,247 @@
+/*
+ * RingBufferQueue.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+
+namespace RingBufferNS
+{
+    /**
+     * @brief Rounds a queue length up to the next power of two.
+     */
+    constexpr uint32_t RoundUpToPowerOfTwo(uint32_t aValue)
+    {
+        uint32_t wResult = 1;
+        while (wResult < aValue)
+        {
+            wResult <<= 1;
+        }
+        return wResult;
+    }
+
+    /**
+     * @brief Lock-free multi-producer single-consumer queue (size independent part).
+     *
+     * @details
+     * The queue is a bounded ring buffer of slots, each slot carries a sequence number
+     * which tells whether the slot is free for the producer of the current lap or holds
+     * an item for the consumer. Producers reserve a slot by a compare-and-swap on the tail
+     * position, copy the item and publish it by advancing the slot sequence. The single
+     * consumer reads the head slot and releases it for the next lap. Neither side takes
+     * a lock or enters a critical section.
+     *
+     * add() reports if the queue was empty for the consumer before the item was published,
+     * i.e. the consumer either waits or will wait for a notification. Only on this
+     * empty-to-non-empty edge the consumer has to be notified, as long as it keeps popping
+     * until pop() fails before it waits for the next notification.
+     *
+     * The interface follows FreeRTOScpp::QueueTypeBase, so the queue can be used as drop-in
+     * replacement for the message queues of the tasks. Operations never block, the ticks
+     * to wait parameters are accepted for compatibility only.
+     */
+    template<class T>
+    class RingBufferQueueBase
+    {
+    protected:
+        /** @brief Slot of the ring buffer */
+        struct tSlot
+        {
+            std::atomic<uint32_t> mSequence;
+            T                     mItem;
+        };
+
+        RingBufferQueueBase(tSlot* apSlots, uint32_t aSize)
+            : mpSlots(apSlots), mMask(aSize - 1), mTail(0), mHead(0)
+        {
+            // do nothing
+        }
+
+        /** @brief Initializes the slot sequences, called once the storage has been constructed */
+        void InitSlots(void)
+        {
+            for (uint32_t wI = 0; wI <= mMask; wI++)
+            {
+                mpSlots[wI].mSequence.store(wI, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        virtual ~RingBufferQueueBase()
+        {
+            // do nothing
+        }
+
+        /**
+         * @brief Adds an item at the end of the queue (any task or ISR).
+         *
+         * @param arItem Item to add
+         * @param aTicks Ignored, the queue never blocks
+         * @param apWasEmpty Optional, set to true if the consumer has to be notified
+         * @return true if the item has been added, false if the queue is full
+         */
+        bool add(T const& arItem, TickType_t aTicks = 0, bool* apWasEmpty = nullptr)
+        {
+            (void) aTicks;
+
+            tSlot*   wpSlot;
+            uint32_t wPosition = mTail.load(std::memory_order_relaxed);
+
+            /* Reserve a slot */
+            for (;;)
+            {
+                wpSlot = &mpSlots[wPosition & mMask];
+
+                uint32_t wSequence = wpSlot->mSequence.load(std::memory_order_acquire);
+                int32_t  wDiff     = static_cast<int32_t>(wSequence - wPosition);
+
+                if (wDiff == 0)
+                {
+                    /* Slot is free in this lap, try to take it */
+                    if (mTail.compare_exchange_weak(wPosition, wPosition + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (wDiff < 0)
+                {
+                    /* Slot still holds an item of the previous lap, queue is full */
+                    return false;
+                }
+                else
+                {
+                    /* Slot taken by another producer, reload tail */
+                    wPosition = mTail.load(std::memory_order_relaxed);
+                }
+            }
+
+            /* Copy and publish the item */
+            wpSlot->mItem = arItem;
+            wpSlot->mSequence.store(wPosition + 1, std::memory_order_seq_cst);
+
+            if (apWasEmpty != nullptr)
+            {
+                /* The consumer stops at the first unpublished slot. If this is our slot,
+                   the queue was empty for the consumer and it has to be notified. */
+                *apWasEmpty = (mHead.load(std::memory_order_seq_cst) == wPosition);
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Removes the first item of the queue (consumer task only).
+         *
+         * @param arVar Variable to store the item
+         * @param aTicks Ignored, the queue never blocks
+         * @return true if an item has been removed, false if the queue is empty
+         */
+        bool pop(T& arVar, TickType_t aTicks = 0)
+        {
+            (void) aTicks;
+
+            uint32_t wPosition = mHead.load(std::memory_order_relaxed);
+            tSlot*   wpSlot    = &mpSlots[wPosition & mMask];
+
+            /* Check if the item is published */
+            uint32_t wSequence = wpSlot->mSequence.load(std::memory_order_seq_cst);
+            if (static_cast<int32_t>(wSequence - (wPosition + 1)) < 0)
+            {
+                return false;
+            }
+
+            arVar = wpSlot->mItem;
+
+            /* Release the slot for the next lap */
+            wpSlot->mSequence.store(wPosition + mMask + 1, std::memory_order_release);
+            mHead.store(wPosition + 1, std::memory_order_seq_cst);
+
+            return true;
+        }
+
+        /**
+         * @brief Reads the first item of the queue without removing it (consumer task only).
+         */
+        bool peek(T& arVar, TickType_t aTicks = 0)
+        {
+            (void) aTicks;
+
+            uint32_t wPosition = mHead.load(std::memory_order_relaxed);
+            tSlot*   wpSlot    = &mpSlots[wPosition & mMask];
+
+            if (static_cast<int32_t>(wpSlot->mSequence.load(std::memory_order_acquire) - (wPosition + 1)) < 0)
+            {
+                return false;
+            }
+
+            arVar = wpSlot->mItem;
+            return true;
+        }
+
+        bool addFromISR(T const& arItem, BaseType_t* apWaken = nullptr, bool* apWasEmpty = nullptr)
+        {
+            (void) apWaken;
+            return add(arItem, 0, apWasEmpty);
+        }
+
+        bool popFromISR(T& arVar, BaseType_t* apWaken = nullptr)
+        {
+            (void) apWaken;
+            return pop(arVar, 0);
+        }
+
+        /** @brief Number of reserved slots (approximation while producers are active) */
+        UBaseType_t waiting(void) const
+        {
+            return mTail.load(std::memory_order_relaxed) - mHead.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Number of free slots (approximation while producers are active) */
+        UBaseType_t available(void) const
+        {
+            return (mMask + 1) - waiting();
+        }
+
+        bool empty(void) const { return waiting() == 0; }
+        bool full(void) const { return available() == 0; }
+
+    private:
+        tSlot* const   mpSlots;
+        const uint32_t mMask;
+
+        /** @brief Next position to be reserved by a producer */
+        std::atomic<uint32_t> mTail;
+        /** @brief Next position to be read by the consumer */
+        std::atomic<uint32_t> mHead;
+    };
+
+    /**
+     * @brief Lock-free multi-producer single-consumer queue with static storage.
+     *
+     * @details
+     * The number of slots is QueueLength rounded up to the next power of two.
+     */
+    template<class T, unsigned QueueLength>
+    class RingBufferQueue : public RingBufferQueueBase<T>
+    {
+    public:
+        explicit RingBufferQueue(char const* apName = nullptr)
+            : RingBufferQueueBase<T>(mSlots, mSize)
+        {
+            (void) apName;
+
+            this->InitSlots();
+        }
+
+    private:
+        static constexpr uint32_t mSize = RoundUpToPowerOfTwo(QueueLength);
+
+        typename RingBufferQueueBase<T>::tSlot mSlots[mSize];
+    };
+
+}   /* end of namespace RingBufferNS */
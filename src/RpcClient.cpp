@@ -0,0 +1,209 @@
+/*
+ * RpcClient.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "Logger.h"
+
+#include "RpcClient.h"
+
+
+/* Log level for this module */
+#define LOG_LEVEL   (LOG_WARN)
+
+
+namespace ApplicationNS
+{
+/**
+ *
+ * Implementation of the ApplicationNS::RpcClient class
+ *
+ */
+RpcClient::RpcClient()
+{
+    // do nothing
+}
+
+RpcClient::~RpcClient()
+{
+    // do nothing
+}
+
+/**
+ * @brief Sends a request and registers its completion callback.
+ *
+ * @details
+ * The request is sent point-to-point to its destination with a new correlation ID. The
+ * source of the request must be the address of the calling task, the response is sent
+ * back to it.
+ *
+ * @param apCommunicationManager Communication manager to send the request with
+ * @param arRequest Request message, the correlation ID is set by this function
+ * @param aResponseId Message ID of the expected response
+ * @param aTimeout Timeout in ticks
+ * @param aCallback Completion callback
+ * @return Handle of the pending request, mInvalidRpcHandle if too many requests are pending
+ */
+tRpcHandle RpcClient::Request(CommunicationNS::CommunicationManager* apCommunicationManager,
+        const MessageNS::Message& arRequest, MessageNS::tMessageId aResponseId,
+        TickType_t aTimeout, tRpcCallback aCallback)
+{
+    tPendingRequest* wpEntry = Find(mInvalidRpcHandle);
+
+    if ((apCommunicationManager == nullptr) || (wpEntry == nullptr))
+    {
+        LOG(LOG_WARN, "RpcClient::Request() Request %d to %s not sent, %d requests pending",
+                static_cast<int>(arRequest.mId), MessageNS::AddressToString(arRequest.mDestination), mPendingCount);
+        return mInvalidRpcHandle;
+    }
+
+    /* Register the request before sending, the response may arrive immediately */
+    wpEntry->mCorrelationId = NextCorrelationId();
+    wpEntry->mResponseId    = aResponseId;
+    wpEntry->mDeadline      = xTaskGetTickCount() + aTimeout;
+    wpEntry->mRequest       = arRequest;
+    wpEntry->mRequest.mCorrelationId = wpEntry->mCorrelationId;
+    wpEntry->mCallback      = aCallback;
+    mPendingCount++;
+
+    apCommunicationManager->SendMessage(wpEntry->mRequest);
+
+    return wpEntry->mCorrelationId;
+}
+
+/**
+ * @brief Cancels a pending request, its callback is not called.
+ *
+ * @param aHandle Handle of the request
+ * @return true if the request was pending, false otherwise
+ */
+bool RpcClient::Cancel(tRpcHandle aHandle)
+{
+    tPendingRequest* wpEntry = (aHandle != mInvalidRpcHandle) ? Find(aHandle) : nullptr;
+
+    if (wpEntry == nullptr)
+    {
+        return false;
+    }
+
+    wpEntry->mCorrelationId = mInvalidRpcHandle;
+    wpEntry->mCallback      = nullptr;
+    mPendingCount--;
+
+    return true;
+}
+
+/**
+ * @brief Completes the pending request matching a received message.
+ *
+ * @param arMessage Message taken from the task queue
+ * @return true if the message is the response of a pending request and was consumed,
+ *         false if it has to be processed as a normal message
+ */
+bool RpcClient::HandleResponse(const MessageNS::Message& arMessage)
+{
+    tPendingRequest* wpEntry = (arMessage.mCorrelationId != mInvalidRpcHandle) ? Find(arMessage.mCorrelationId) : nullptr;
+
+    if ((wpEntry == nullptr) || (wpEntry->mResponseId != arMessage.mId))
+    {
+        return false;
+    }
+
+    /* Free the entry before the callback, which may send a new request */
+    tRpcCallback wCallback = std::move(wpEntry->mCallback);
+    wpEntry->mCorrelationId = mInvalidRpcHandle;
+    wpEntry->mCallback      = nullptr;
+    mPendingCount--;
+
+    if (wCallback)
+    {
+        wCallback(RPC_OK, arMessage);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Completes all expired requests with RPC_TIMEOUT.
+ *
+ * @return Ticks until the next pending request expires, portMAX_DELAY if none is pending,
+ *         0 if requests expired and the pending requests have to be checked again
+ */
+TickType_t RpcClient::ProcessTimeouts(void)
+{
+    TickType_t wWaitTicks = portMAX_DELAY;
+    bool       wExpired   = false;
+
+    for (uint8_t wI = 0; (wI < mRpcMaxPendingRequests) && (mPendingCount != 0); wI++)
+    {
+        tPendingRequest& wEntry = mPendingRequests[wI];
+
+        if (wEntry.mCorrelationId == mInvalidRpcHandle)
+        {
+            continue;
+        }
+
+        /* Remaining ticks, negative once the deadline has passed (tick count wrap safe) */
+        int32_t wRemaining = static_cast<int32_t>(wEntry.mDeadline - xTaskGetTickCount());
+
+        if (wRemaining <= 0)
+        {
+            LOG(LOG_WARN, "RpcClient::ProcessTimeouts() Request %d to %s timed out",
+                    static_cast<int>(wEntry.mRequest.mId), MessageNS::AddressToString(wEntry.mRequest.mDestination));
+
+            /* Free the entry before the callback, which may send a new request */
+            tRpcCallback       wCallback = std::move(wEntry.mCallback);
+            MessageNS::Message wRequest  = wEntry.mRequest;
+            wEntry.mCorrelationId = mInvalidRpcHandle;
+            wEntry.mCallback      = nullptr;
+            mPendingCount--;
+            wExpired = true;
+
+            if (wCallback)
+            {
+                wCallback(RPC_TIMEOUT, wRequest);
+            }
+        }
+        else if (static_cast<TickType_t>(wRemaining) < wWaitTicks)
+        {
+            wWaitTicks = static_cast<TickType_t>(wRemaining);
+        }
+    }
+
+    /* Requests sent by the timeout callbacks are not covered, check again right away */
+    return wExpired ? 0 : wWaitTicks;
+}
+
+/**
+ * @brief Returns the pending request entry with a correlation ID.
+ *
+ * @param aCorrelationId Correlation ID, mInvalidRpcHandle to find a free entry
+ * @return Entry, nullptr if not found
+ */
+RpcClient::tPendingRequest* RpcClient::Find(uint8_t aCorrelationId)
+{
+    for (uint8_t wI = 0; wI < mRpcMaxPendingRequests; wI++)
+    {
+        if (mPendingRequests[wI].mCorrelationId == aCorrelationId)
+        {
+            return &mPendingRequests[wI];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns the next correlation ID, not used by a pending request.
+ */
+uint8_t RpcClient::NextCorrelationId(void)
+{
+    do
+    {
+        mLastCorrelationId++;
+    } while ((mLastCorrelationId == mInvalidRpcHandle) || (Find(mLastCorrelationId) != nullptr));
+
+    return mLastCorrelationId;
+}
+
+};  /* end of namespace ApplicationNS */
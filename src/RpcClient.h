@@ -0,0 +1,111 @@
+/*
+ * RpcClient.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+#include <FreeRTOScpp.h>
+
+#include "Message.h"
+#include "Communication.h"
+
+
+namespace ApplicationNS
+{
+    /**
+     * @brief Completion status of a request
+     */
+    enum tRpcStatus : uint8_t
+    {
+        /** @brief Response received */
+        RPC_OK = 0x00,
+        /** @brief No response received within the timeout */
+        RPC_TIMEOUT,
+    };
+
+    /**
+     * @brief Handle of a pending request, the correlation ID of the request message
+     */
+    typedef uint8_t tRpcHandle;
+
+    /** @brief Invalid request handle, returned if a request could not be sent */
+    static constexpr tRpcHandle mInvalidRpcHandle = 0;
+
+    /** @brief Maximal number of pending requests per task */
+    static constexpr uint8_t mRpcMaxPendingRequests = 4;
+
+    /**
+     * @brief Completion callback of a request.
+     *
+     * @details
+     * Called in the context of the requesting task with the response message, or with
+     * RPC_TIMEOUT and the request message if no response was received in time.
+     */
+    typedef std::function<void(tRpcStatus aStatus, const MessageNS::Message& arMessage)> tRpcCallback;
+
+    /**
+     * @brief Request/response calls of a task over the message bus.
+     *
+     * @details
+     * A request is a message sent point-to-point with a correlation ID in the message header.
+     * The receiving task answers with a response message carrying the same correlation ID,
+     * sent back to the source address of the request, so it ends up in the queue of the
+     * requesting task like any other message. There the task passes it to HandleResponse(),
+     * which completes the matching pending request by calling its callback.
+     *
+     * Every request has a timeout. ProcessTimeouts() completes expired requests with
+     * RPC_TIMEOUT and returns the time to the next deadline, so the task can bound its wait
+     * for notifications accordingly. A response arriving after the timeout is not matched
+     * anymore and handled as a normal message.
+     *
+     * The object is owned by a single task and must only be used from that task.
+     */
+    class RpcClient
+    {
+    public:
+        RpcClient();
+        virtual ~RpcClient();
+
+        tRpcHandle Request(CommunicationNS::CommunicationManager* apCommunicationManager,
+                const MessageNS::Message& arRequest, MessageNS::tMessageId aResponseId,
+                TickType_t aTimeout, tRpcCallback aCallback);
+        bool Cancel(tRpcHandle aHandle);
+
+        bool HandleResponse(const MessageNS::Message& arMessage);
+        TickType_t ProcessTimeouts(void);
+
+        /** @brief Returns true if requests are pending */
+        bool IsPending(void) const { return mPendingCount != 0; }
+
+    private:
+        /** @brief Pending request */
+        struct tPendingRequest
+        {
+            /** @brief Correlation ID, mInvalidRpcHandle if the entry is free */
+            uint8_t               mCorrelationId;
+            /** @brief Expected response message ID */
+            MessageNS::tMessageId mResponseId;
+            /** @brief Tick count at which the request times out */
+            TickType_t            mDeadline;
+            /** @brief Request message, passed to the callback on timeout */
+            MessageNS::Message    mRequest;
+            /** @brief Completion callback */
+            tRpcCallback          mCallback;
+        };
+
+        tPendingRequest mPendingRequests[mRpcMaxPendingRequests] = {};
+        uint8_t         mPendingCount = 0;
+
+        /** @brief Last correlation ID used */
+        uint8_t         mLastCorrelationId = mInvalidRpcHandle;
+
+        tPendingRequest* Find(uint8_t aCorrelationId);
+        uint8_t NextCorrelationId(void);
+    };
+
+}; /* end of namespace ApplicationNS */
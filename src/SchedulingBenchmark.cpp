@@ -0,0 +1,171 @@
+/*
+ * SchedulingBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "Configuration.h"
+
+#include "SchedulingBenchmark.h"
+
+
+namespace SchedulingBenchmarkNS
+{
+/** @brief Names and units of the measurements, printed in the report */
+static constexpr const char* mcMeasurementNames[] = { "minute change", "web control", "web status" };
+static constexpr const char* mcMeasurementUnits[] = { "ms", "us", "us" };
+
+static_assert((sizeof(mcMeasurementNames) / sizeof(mcMeasurementNames[0])) == SchedulingBenchmark::NB_OF_MEASUREMENTS,
+        "Name of a measurement is missing");
+
+
+/**
+ *
+ * Implementation of the SchedulingBenchmarkNS::SchedulingBenchmark class
+ *
+ */
+SchedulingBenchmark::SchedulingBenchmark()
+    : mRunning(false)
+{
+    // do nothing
+}
+
+SchedulingBenchmark::~SchedulingBenchmark()
+{
+    // do nothing
+}
+
+/**
+ * @brief Starts the benchmark, ignored while a benchmark is running.
+ *
+ * @param aDurationMs Duration of the benchmark in milliseconds
+ */
+void SchedulingBenchmark::Start(uint32_t aDurationMs)
+{
+    if (mRunning)
+    {
+        return;
+    }
+
+    CreateLoadTasks();
+
+    portENTER_CRITICAL(&mLock);
+    for (tLatencyStatistics& wStatistics : mStatistics)
+    {
+        wStatistics = {};
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    mStartMs    = millis();
+    mDurationMs = aDurationMs;
+    mRunning    = true;
+
+    Serial.printf("[BEN] Scheduling profile %s, load on %u cores for %lu s\r\n",
+            ConfigNS::mcSchedulingProfile.mpName, mLoadTaskCount, static_cast<unsigned long>(aDurationMs / 1000));
+
+    /* Wake up the load tasks */
+    for (TaskHandle_t wTask : mLoadTasks)
+    {
+        if (wTask != nullptr)
+        {
+            xTaskNotifyGive(wTask);
+        }
+    }
+}
+
+/**
+ * @brief Stops the benchmark after its duration and prints the results, called periodically.
+ */
+void SchedulingBenchmark::Process(void)
+{
+    if (mRunning && ((millis() - mStartMs) >= mDurationMs))
+    {
+        /* Load tasks go back to sleep after their current cycle */
+        mRunning = false;
+        Report();
+    }
+}
+
+/**
+ * @brief Records a measured latency (any task), ignored while no benchmark is running.
+ *
+ * @param aMeasurement Measured latency
+ * @param aValue Latency in the unit of the measurement
+ */
+void SchedulingBenchmark::Record(tMeasurement aMeasurement, uint32_t aValue)
+{
+    if ((mRunning == false) || (aMeasurement >= NB_OF_MEASUREMENTS))
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&mLock);
+    tLatencyStatistics& wStatistics = mStatistics[aMeasurement];
+
+    wStatistics.mCount++;
+    wStatistics.mTotal += aValue;
+    if (aValue > wStatistics.mMax)
+    {
+        wStatistics.mMax = aValue;
+    }
+    portEXIT_CRITICAL(&mLock);
+}
+
+void SchedulingBenchmark::CreateLoadTasks(void)
+{
+    for (uint8_t wI = 0; wI < mLoadTaskCount; wI++)
+    {
+        if (mLoadTasks[wI] == nullptr)
+        {
+            mLoadTasks[wI] = xTaskCreateStaticPinnedToCore(LoadTaskFunction, "BenchmarkLoad",
+                    mLoadTaskStackSize, this, ConfigNS::mSchedulingBenchmarkLoadPriority,
+                    mLoadTaskStacks[wI], &mLoadTaskBuffers[wI], wI);
+        }
+    }
+}
+
+void SchedulingBenchmark::Report(void)
+{
+    Serial.printf("[BEN] Scheduling profile %s, results after %lu s\r\n",
+            ConfigNS::mcSchedulingProfile.mpName, static_cast<unsigned long>(mDurationMs / 1000));
+
+    for (uint8_t wMeasurement = 0; wMeasurement < NB_OF_MEASUREMENTS; wMeasurement++)
+    {
+        portENTER_CRITICAL(&mLock);
+        tLatencyStatistics wStatistics = mStatistics[wMeasurement];
+        portEXIT_CRITICAL(&mLock);
+
+        Serial.printf("[BEN]   %-14s count %lu, avg %lu %s, max %lu %s\r\n", mcMeasurementNames[wMeasurement],
+                static_cast<unsigned long>(wStatistics.mCount),
+                static_cast<unsigned long>((wStatistics.mCount != 0) ? (wStatistics.mTotal / wStatistics.mCount) : 0),
+                mcMeasurementUnits[wMeasurement],
+                static_cast<unsigned long>(wStatistics.mMax), mcMeasurementUnits[wMeasurement]);
+    }
+}
+
+/**
+ * @brief Load task, keeps its core busy while the benchmark is running.
+ */
+void SchedulingBenchmark::LoadTaskFunction(void* apParameter)
+{
+    SchedulingBenchmark* wpBenchmark = static_cast<SchedulingBenchmark*>(apParameter);
+
+    for (;;)
+    {
+        /* Wait for the start of a benchmark */
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (wpBenchmark->mRunning)
+        {
+            /* Busy phase, the idle phase lets lower priority tasks and the idle task run */
+            uint32_t wStartUs = micros();
+            while ((micros() - wStartUs) < (ConfigNS::mSchedulingBenchmarkLoadBusyMs * 1000))
+            {
+                // busy wait
+            }
+            vTaskDelay(pdMS_TO_TICKS(ConfigNS::mSchedulingBenchmarkLoadIdleMs));
+        }
+    }
+}
+
+}   /* end of namespace SchedulingBenchmarkNS */
@@ -0,0 +1,107 @@
+/*
+ * SchedulingBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include <FreeRTOScpp.h>
+
+
+namespace SchedulingBenchmarkNS
+{
+    /** @brief Number of load tasks, one per core */
+    static constexpr uint8_t mLoadTaskCount = portNUM_PROCESSORS;
+
+    /** @brief Stack size of a load task */
+    static constexpr uint32_t mLoadTaskStackSize = configMINIMAL_STACK_SIZE + 1024;
+
+    /**
+     * @brief Statistics of a measured latency
+     */
+    struct tLatencyStatistics
+    {
+        /** @brief Number of measurements */
+        uint32_t mCount;
+        /** @brief Sum of the latencies */
+        uint64_t mTotal;
+        /** @brief Highest latency */
+        uint32_t mMax;
+    };
+
+    /**
+     * @brief Measures the minute change and web response latencies of the tasks under CPU load.
+     *
+     * @details
+     * Start() wakes a load task on every core, which keeps the core busy for most of the time at
+     * the default task priority, and resets the measurements. After the benchmark duration the load
+     * tasks go back to sleep and the results are printed on the serial console, prefixed with "[BEN]"
+     * and the name of the scheduling profile, so builds with different SCHEDULING_PROFILE can be
+     * compared.
+     *
+     * Measured are:
+     * - the minute change latency, from the minute boundary until the display shows the new time,
+     * - the duration of the web UI control callbacks, in the context of the web server,
+     * - the round trip of the status requests of the web site to the other tasks.
+     *
+     * The benchmark is only compiled in with the build flag USE_SCHEDULING_BENCHMARK=true, see
+     * SCHEDULING_BENCHMARK_RECORD().
+     */
+    class SchedulingBenchmark
+    {
+    public:
+        /** @brief Measured latency */
+        enum tMeasurement : uint8_t
+        {
+            /** @brief Minute change shown by the display, in milliseconds */
+            MEASURE_MINUTE_CHANGE = 0x00,
+            /** @brief Web UI control callback, in microseconds */
+            MEASURE_WEB_CONTROL,
+            /** @brief Web site status request round trip, in microseconds */
+            MEASURE_WEB_STATUS,
+            NB_OF_MEASUREMENTS
+        };
+
+        SchedulingBenchmark();
+        virtual ~SchedulingBenchmark();
+
+        void Start(uint32_t aDurationMs);
+        void Process(void);
+
+        void Record(tMeasurement aMeasurement, uint32_t aValue);
+
+    private:
+        portMUX_TYPE mLock = portMUX_INITIALIZER_UNLOCKED;
+
+        tLatencyStatistics mStatistics[NB_OF_MEASUREMENTS] = {};
+
+        std::atomic<bool> mRunning;
+        uint32_t          mStartMs    = 0;
+        uint32_t          mDurationMs = 0;
+
+        TaskHandle_t      mLoadTasks[mLoadTaskCount] = {};
+        StaticTask_t      mLoadTaskBuffers[mLoadTaskCount];
+        StackType_t       mLoadTaskStacks[mLoadTaskCount][mLoadTaskStackSize];
+
+        void CreateLoadTasks(void);
+        void Report(void);
+
+        static void LoadTaskFunction(void* apParameter);
+    };
+
+}   /* end of namespace SchedulingBenchmarkNS */
+
+
+#if (USE_SCHEDULING_BENCHMARK == true)
+    /* Declare the object as extern for global access  */
+    extern SchedulingBenchmarkNS::SchedulingBenchmark SchedulingBenchmark;
+
+    #define SCHEDULING_BENCHMARK_RECORD(measurement, value) \
+            SchedulingBenchmark.Record(SchedulingBenchmarkNS::SchedulingBenchmark::measurement, (value))
+#else
+    #define SCHEDULING_BENCHMARK_RECORD(measurement, value)
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
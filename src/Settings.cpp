@@ -33,6 +33,8 @@ Settings::~Settings()
  */
 void Settings::Clear(void)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     /* Open preferences in read-write mode */
     if (mPrefs.begin(mcPrefsParamNamespace, false))
     {
@@ -50,6 +52,8 @@ void Settings::Clear(void)
  */
 bool Settings::HasKey(const tKey& arKey)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     bool wRetValue = false;
 
     /* Open preferences in read-only mode */
@@ -75,6 +79,8 @@ bool Settings::HasKey(const tKey& arKey)
  */
 bool Settings::RemoveKey(const tKey& arKey)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     bool wRetValue = false;
 
     /* Open preferences in read-write mode */
@@ -102,6 +108,8 @@ bool Settings::RemoveKey(const tKey& arKey)
  */
 bool Settings::GetBytes(const tKey& arKey, uint8_t* apData, const size_t aDataSize)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     size_t wRetSize = 0;
 
     /* Open preferences in read-only mode */
@@ -132,6 +140,8 @@ bool Settings::GetBytes(const tKey& arKey, uint8_t* apData, const size_t aDataSi
  */
 bool Settings::SetBytes(const tKey& arKey, const uint8_t* apData, const size_t aDataSize)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     size_t wRetSize = 0;
 
     /* Open preferences in read-write mode */
@@ -172,6 +182,8 @@ bool Settings::SetBytes(const tKey& arKey, const uint8_t* apData, const size_t a
  */
 bool Settings::IncreaseCounter(const tKey& arKey, const uint32_t aNewValue)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     size_t wRetSize = 0;
 
     /* Get current counter value */
@@ -207,6 +219,8 @@ bool Settings::IncreaseCounter(const tKey& arKey, const uint32_t aNewValue)
  */
 uint32_t Settings::GetCounter(const tKey& arKey, const uint32_t aDefaultValue)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     uint32_t wCounter = aDefaultValue;
 
     /* Open preferences in read-only mode */
@@ -8,6 +8,7 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include <mutex>
 
 #include "Logger.h"
 
@@ -130,6 +131,9 @@ namespace SettingsNS
      * through templated GetValue and SetValue methods, as well as byte arrays and counters.
      * The class also offers methods to clear all settings, check for the existence of keys,
      * remove keys, and increment counters. All operations are performed within the "prefs" namespace.
+     *
+     * The object is shared by all tasks, every operation holds a recursive mutex, as the
+     * Preferences object and the key string buffer are not reentrant.
      */
     class Settings
     {
@@ -164,6 +168,9 @@ namespace SettingsNS
 
         Preferences mPrefs;
 
+        /** @brief Serializes the access of the tasks, recursive as GetValue() calls HasKey() */
+        std::recursive_mutex mMutex;
+
         /**
          * @brief Converts a tKey to its string representation.
          *
@@ -32,6 +32,8 @@ namespace SettingsNS
 template<typename T>
 T Settings::GetValue(const tKey& arKey, const T aDefaultValue)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     T wRetValue = aDefaultValue;
 
     /* Check if key exists and open preferences in read-only mode */
@@ -101,6 +103,8 @@ T Settings::GetValue(const tKey& arKey, const T aDefaultValue)
 template<typename T>
 bool Settings::SetValue(const tKey& arKey, const T aValue)
 {
+    std::lock_guard<std::recursive_mutex> wLock(mMutex);
+
     size_t wRetSize = 0;
 
     /* Open preferences in read-write mode */
@@ -0,0 +1,196 @@
+/*
+ * TaskGraph.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include <tuple>
+#include <type_traits>
+
+#include "Application.h"
+#include "BusStatistics.h"
+#include "Communication.h"
+#include "Configuration.h"
+#include "MessageCoalescer.h"
+#include "MessageQueue.h"
+
+
+namespace ApplicationNS
+{
+    /**
+     * @brief Statically allocated application task.
+     *
+     * @details
+     * The StaticTask class template holds the task object of type TaskType together with its stack,
+     * its FreeRTOS task control block, its message queue, coalescer and receiver. All of them are
+     * members, so an instance declared with static storage duration needs no heap at startup and
+     * its RAM use is known at link time.
+     *
+     * The task is described by the constexpr configuration Config (name, bus address, priority,
+     * stack size, core, message batch budget, message lane size, message and fast event
+     * subscriptions), see ConfigNS.
+     *
+     * Init() creates the FreeRTOS task and wires it to the communication manager, Start() lets the
+     * task run. Tasks are declared in a TaskGraph, which initializes and starts them in order.
+     */
+    template<class TaskType, const tTaskConfig& Config>
+    class StaticTask
+    {
+        static_assert(std::is_base_of<Task, TaskType>::value, "TaskType must be derived from ApplicationNS::Task");
+        static_assert(Config.mStackSize >= configMINIMAL_STACK_SIZE, "Stack size of the task is too small");
+        static_assert(Config.mAddress < MessageNS::tAddress::NB_OF_ADDRESSES, "Invalid address of the task");
+        static_assert(Config.mMessageBatchBudget > 0, "Message batch budget of the task must not be zero");
+        static_assert(Config.mMessageBatchBudget <= mMaxMessageBatchBudget, "Message batch budget of the task is too big");
+
+    public:
+        /** @brief Configuration of the task */
+        static constexpr const tTaskConfig& mcConfig = Config;
+
+        StaticTask() : mTask(Config.mpName, Config.mPriority, Config.mStackSize)
+        {
+            // do nothing
+        }
+
+        /**
+         * @brief Creates the task and registers it at the communication manager.
+         *
+         * @details
+         * The task is created in the static stack and waits for Start(). The lane and coalescing
+         * rules of ConfigNS are applied to its message queue, the task is initialized and its
+         * subscriptions are registered.
+         *
+         * @param arCommunicationManager Communication manager of the application
+         */
+        void Init(CommunicationNS::CommunicationManager& arCommunicationManager)
+        {
+            /* Create task in the static stack and control block */
+            if (!mTask.Create(mStack, &mTaskBuffer, Config.mCore))
+            {
+                return;
+            }
+
+            /* Assign messages to the lanes of the message queue */
+            for (const ConfigNS::tLaneRule& wRule : ConfigNS::mcLaneRules)
+            {
+                mMessageQueue.SetLane(wRule.mMessageId, wRule.mLane);
+            }
+
+            /* Apply coalescing rules to the message queue */
+            for (const ConfigNS::tCoalescingRule& wRule : ConfigNS::mcCoalescingRules)
+            {
+                mMessageCoalescer.SetPolicy(wRule.mMessageId, wRule.mPolicy);
+            }
+
+            /* Initialize task objects */
+            mMessageReceiver.Init(&mMessageQueue, mTask.getTaskHandle(), mTaskNotificationMsgQueue,
+                    &mMessageCoalescer);
+
+            mTaskObjects.mpCommunicationManager = &arCommunicationManager;
+            mTaskObjects.mpMessageQueue         = &mMessageQueue;
+            mTaskObjects.mpMessageCoalescer     = &mMessageCoalescer;
+            mTaskObjects.mMessageBatchBudget    = Config.mMessageBatchBudget;
+
+            /* Initialize task */
+            mTask.Init(&mTaskObjects);
+
+            /* Register message receiver and subscriptions at the communication manager */
+            arCommunicationManager.RegisterCallback(Config.mAddress, &mMessageReceiver);
+            for (uint8_t wI = 0; wI < Config.mSubscriptionCount; wI++)
+            {
+                arCommunicationManager.Subscribe(Config.mpSubscriptions[wI], Config.mAddress);
+            }
+            for (uint8_t wI = 0; wI < Config.mFastEventSubscriptionCount; wI++)
+            {
+                arCommunicationManager.SubscribeFastEvent(Config.mpFastEventSubscriptions[wI], Config.mAddress);
+            }
+
+            /* Register message queue for bus statistics */
+            BusStatistics.Register(Config.mAddress, &mMessageQueue, &mMessageCoalescer);
+        }
+
+        /**
+         * @brief Lets the task run, after all tasks are initialized.
+         */
+        void Start(void)
+        {
+            if (mTask.getTaskHandle() != nullptr)
+            {
+                xTaskNotify(mTask.getTaskHandle(), mTaskNotificationStart, eSetBits);
+            }
+        }
+
+    private:
+        TaskType         mTask;
+        StaticMessageQueue<Config.mMessageLaneSize> mMessageQueue;
+        MessageCoalescer mMessageCoalescer;
+        MessageReceiver  mMessageReceiver;
+        tTaskObjects     mTaskObjects;
+
+        StaticTask_t     mTaskBuffer;
+        StackType_t      mStack[Config.mStackSize];
+    };
+
+
+    /**
+     * @brief Compile-time declared graph of the application tasks.
+     *
+     * @details
+     * The TaskGraph class template holds the ApplicationNS::StaticTask instances of the application.
+     * Init() initializes and Start() starts them in the declared order, so a task which depends on
+     * the initialization of others is declared after them.
+     */
+    template<class... StaticTasks>
+    class TaskGraph
+    {
+        static_assert(sizeof...(StaticTasks) <= MessageNS::tAddress::NB_OF_ADDRESSES, "Too many tasks");
+
+    public:
+        /**
+         * @brief Initializes all tasks in the declared order.
+         *
+         * @param arCommunicationManager Communication manager of the application
+         */
+        void Init(CommunicationNS::CommunicationManager& arCommunicationManager)
+        {
+            static_assert(HasUniqueAddresses(), "Tasks must have different addresses");
+
+            std::apply([&arCommunicationManager](StaticTasks&... arTasks)
+                    { (arTasks.Init(arCommunicationManager), ...); }, mTasks);
+        }
+
+        /**
+         * @brief Starts all tasks in the declared order.
+         */
+        void Start(void)
+        {
+            std::apply([](StaticTasks&... arTasks) { (arTasks.Start(), ...); }, mTasks);
+        }
+
+    private:
+        /** @brief Returns true if no two tasks have the same address */
+        static constexpr bool HasUniqueAddresses(void)
+        {
+            constexpr MessageNS::tAddress wcAddresses[] = { StaticTasks::mcConfig.mAddress... };
+
+            for (size_t wI = 0; wI < sizeof...(StaticTasks); wI++)
+            {
+                for (size_t wJ = wI + 1; wJ < sizeof...(StaticTasks); wJ++)
+                {
+                    if (wcAddresses[wI] == wcAddresses[wJ])
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        std::tuple<StaticTasks...> mTasks;
+    };
+
+}; /* end of namespace ApplicationNS */
+
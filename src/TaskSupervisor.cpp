@@ -0,0 +1,204 @@
+/*
+ * TaskSupervisor.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include <esp_task_wdt.h>
+
+#include "Logger.h"
+#include "Configuration.h"
+
+#include "TaskSupervisor.h"
+
+
+/* Log level for this module */
+#define LOG_LEVEL   (LOG_DEBUG)
+
+
+namespace TaskSupervisorNS
+{
+
+/**
+ *
+ * Implementation of the TaskSupervisorNS::TaskSupervisor class
+ *
+ */
+TaskSupervisor::TaskSupervisor()
+{
+    for (tTask& wTask : mTasks)
+    {
+        wTask.mpName          = nullptr;
+        wTask.mpMessageQueue  = nullptr;
+        wTask.mBusy           = false;
+        wTask.mHandler        = 0;
+        wTask.mDispatchMs     = 0;
+        wTask.mHeartbeats     = 0;
+        wTask.mBacklog        = false;
+        wTask.mBacklogSinceMs = 0;
+        wTask.mStalled        = false;
+    }
+}
+
+TaskSupervisor::~TaskSupervisor()
+{
+    // do nothing
+}
+
+/**
+ * @brief Subscribes the calling task to the task watchdog, Process() has to be called by the same task.
+ */
+void TaskSupervisor::Init(void)
+{
+    esp_err_t wResult = esp_task_wdt_add(nullptr);
+
+    mWatchdogSubscribed = (wResult == ESP_OK);
+    if (!mWatchdogSubscribed)
+    {
+        LOG(LOG_ERROR, "TaskSupervisor::Init() Subscribe to the task watchdog failed (%d)", wResult);
+    }
+
+    mLastCheckMs = millis();
+}
+
+/**
+ * @brief Registers a task to be supervised.
+ *
+ * @param apName Name of the task
+ * @param apMessageQueue Message queue of the task, optional
+ * @return Supervised task to pass to Enter() and Leave(), mInvalidSupervisedTask if all tasks are registered
+ */
+tSupervisedTask TaskSupervisor::RegisterTask(const char* apName, const ApplicationNS::MessageQueue* apMessageQueue)
+{
+    if (mTaskCount >= mSupervisedTaskCount)
+    {
+        LOG(LOG_ERROR, "TaskSupervisor::RegisterTask() No slot for task %s", apName);
+        return mInvalidSupervisedTask;
+    }
+
+    tTask& wTask = mTasks[mTaskCount];
+
+    wTask.mpName         = apName;
+    wTask.mpMessageQueue = apMessageQueue;
+
+    return mTaskCount++;
+}
+
+/**
+ * @brief Reports the start of a handler invocation (supervised task).
+ *
+ * @param aTask Supervised task
+ * @param aHandler Handler, message ID, mHandlerTimer, mHandlerNotification or mHandlerFastEvent
+ */
+void TaskSupervisor::Enter(tSupervisedTask aTask, HandlerProfilerNS::tHandler aHandler)
+{
+    if (aTask >= mTaskCount)
+    {
+        return;
+    }
+
+    tTask& wTask = mTasks[aTask];
+
+    wTask.mHandler.store(aHandler, std::memory_order_relaxed);
+    wTask.mDispatchMs.store(millis(), std::memory_order_relaxed);
+    wTask.mBusy.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Reports the end of a handler invocation, the heartbeat of the task (supervised task).
+ *
+ * @param aTask Supervised task
+ */
+void TaskSupervisor::Leave(tSupervisedTask aTask)
+{
+    if (aTask >= mTaskCount)
+    {
+        return;
+    }
+
+    tTask& wTask = mTasks[aTask];
+
+    wTask.mHeartbeats.fetch_add(1, std::memory_order_relaxed);
+    wTask.mBusy.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Checks all tasks every ConfigNS::mTaskSupervisorPeriodMs and feeds the task watchdog if they are healthy.
+ */
+void TaskSupervisor::Process(void)
+{
+    uint32_t wNowMs = millis();
+
+    if ((wNowMs - mLastCheckMs) < ConfigNS::mTaskSupervisorPeriodMs)
+    {
+        return;
+    }
+    mLastCheckMs = wNowMs;
+
+    bool wHealthy = true;
+    for (uint8_t wI = 0; wI < mTaskCount; wI++)
+    {
+        if (CheckTask(mTasks[wI], wNowMs) == false)
+        {
+            wHealthy = false;
+        }
+    }
+
+    if (wHealthy && mWatchdogSubscribed)
+    {
+        esp_task_wdt_reset();
+    }
+}
+
+/**
+ * @brief Checks a task, logs a stall and the recovery from a stall.
+ *
+ * @return true if the task is healthy, false if it is stalled
+ */
+bool TaskSupervisor::CheckTask(tTask& arTask, uint32_t aNowMs)
+{
+    /* Track since when messages are waiting in the queue */
+    bool wBacklog = (arTask.mpMessageQueue != nullptr) && (arTask.mpMessageQueue->Empty() == false);
+    if (wBacklog && !arTask.mBacklog)
+    {
+        arTask.mBacklogSinceMs = aNowMs;
+    }
+    arTask.mBacklog = wBacklog;
+
+    bool     wBusy       = arTask.mBusy.load(std::memory_order_acquire);
+    uint32_t wDispatchMs = arTask.mDispatchMs.load(std::memory_order_relaxed);
+    uint32_t wBusyMs     = aNowMs - wDispatchMs;
+
+    if (wBusy && (wBusyMs >= ConfigNS::mTaskStallTimeoutMs))
+    {
+        if (!arTask.mStalled)
+        {
+            arTask.mStalled = true;
+
+            /* Count the waiting messages of all lanes */
+            uint32_t wWaiting = 0;
+            for (uint8_t wLane = 0; wLane < ApplicationNS::NB_OF_LANES; wLane++)
+            {
+                wWaiting += arTask.mpMessageQueue->GetStatistics(static_cast<ApplicationNS::tMessageLane>(wLane)).mDepth;
+            }
+
+            LOG(LOG_ERROR, "TaskSupervisor::CheckTask() Task %s stalled in handler %u for %lu ms, "
+                    "%lu messages waiting for %lu ms, %lu heartbeats",
+                    arTask.mpName, arTask.mHandler.load(std::memory_order_relaxed),
+                    static_cast<unsigned long>(wBusyMs), static_cast<unsigned long>(wWaiting),
+                    static_cast<unsigned long>(wBacklog ? (aNowMs - arTask.mBacklogSinceMs) : 0),
+                    static_cast<unsigned long>(arTask.mHeartbeats.load(std::memory_order_relaxed)));
+        }
+        return false;
+    }
+
+    if (arTask.mStalled)
+    {
+        arTask.mStalled = false;
+        LOG(LOG_WARN, "TaskSupervisor::CheckTask() Task %s recovered", arTask.mpName);
+    }
+
+    return true;
+}
+
+}   /* end of namespace TaskSupervisorNS */
@@ -0,0 +1,116 @@
+/*
+ * TaskSupervisor.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include <FreeRTOScpp.h>
+
+#include "HandlerProfiler.h"
+#include "MessageQueue.h"
+
+
+namespace TaskSupervisorNS
+{
+    /** @brief Number of tasks which can be supervised */
+    static constexpr uint8_t mSupervisedTaskCount = 6;
+
+    /** @brief Supervised task, returned by TaskSupervisor::RegisterTask() */
+    typedef uint8_t tSupervisedTask;
+
+    /** @brief Invalid supervised task, returned if all tasks are registered */
+    static constexpr tSupervisedTask mInvalidSupervisedTask = 0xFF;
+
+    /**
+     * @brief Detects stalled tasks and feeds the task watchdog only while all tasks are healthy.
+     *
+     * @details
+     * The task loop reports the start of every handler invocation with Enter() and its end with
+     * Leave(), see TASK_SUPERVISOR_ENTER() and TASK_SUPERVISOR_LEAVE(). Handlers are identified
+     * like in the HandlerProfilerNS::HandlerProfiler, by message ID or timer, notification and
+     * fast event handler. Every Leave() is a heartbeat of the task.
+     *
+     * Process() checks the tasks periodically. A task which is in the same handler invocation
+     * for longer than ConfigNS::mTaskStallTimeoutMs is stalled, e.g. in a blocking call. A task
+     * which waits for notifications is healthy, however long it waits. The stall is logged with
+     * the task, the handler, the stall duration and since when messages are waiting in the queue
+     * of the task.
+     *
+     * Init() subscribes the calling task to the ESP task watchdog. Process() feeds it only while
+     * no task is stalled, so a stall which lasts longer than the watchdog timeout resets the
+     * device, after the stall was logged. Process() has to be called by this task more often
+     * than the watchdog timeout.
+     *
+     * The supervisor is only compiled in with the build flag USE_TASK_SUPERVISOR=true.
+     * Tasks shall be registered during the application initialization.
+     */
+    class TaskSupervisor
+    {
+    public:
+        TaskSupervisor();
+        virtual ~TaskSupervisor();
+
+        void Init(void);
+
+        tSupervisedTask RegisterTask(const char* apName, const ApplicationNS::MessageQueue* apMessageQueue);
+
+        void Enter(tSupervisedTask aTask, HandlerProfilerNS::tHandler aHandler);
+        void Leave(tSupervisedTask aTask);
+
+        void Process(void);
+
+    private:
+        /** @brief Supervised task */
+        struct tTask
+        {
+            const char*                         mpName;
+            const ApplicationNS::MessageQueue*  mpMessageQueue;
+
+            /* Updated by the supervised task */
+
+            /** @brief Task is in a handler */
+            std::atomic<bool>                        mBusy;
+            /** @brief Current or last handler */
+            std::atomic<HandlerProfilerNS::tHandler> mHandler;
+            /** @brief Start time of the current or last handler invocation (millis) */
+            std::atomic<uint32_t>                    mDispatchMs;
+            /** @brief Number of finished handler invocations */
+            std::atomic<uint32_t>                    mHeartbeats;
+
+            /* Updated by Process() */
+
+            /** @brief Messages are waiting in the queue since mBacklogSinceMs */
+            bool     mBacklog;
+            uint32_t mBacklogSinceMs;
+            /** @brief Stall has been logged */
+            bool     mStalled;
+        };
+
+        tTask   mTasks[mSupervisedTaskCount];
+        uint8_t mTaskCount = 0;
+
+        /** @brief Calling task of Init() is subscribed to the task watchdog */
+        bool     mWatchdogSubscribed = false;
+        uint32_t mLastCheckMs = 0;
+
+        bool CheckTask(tTask& arTask, uint32_t aNowMs);
+    };
+
+}   /* end of namespace TaskSupervisorNS */
+
+
+#if (USE_TASK_SUPERVISOR == true)
+    /* Declare the object as extern for global access  */
+    extern TaskSupervisorNS::TaskSupervisor TaskSupervisor;
+
+    #define TASK_SUPERVISOR_ENTER(task, handler)    TaskSupervisor.Enter((task), (handler))
+    #define TASK_SUPERVISOR_LEAVE(task)             TaskSupervisor.Leave(task)
+#else
+    #define TASK_SUPERVISOR_ENTER(task, handler)
+    #define TASK_SUPERVISOR_LEAVE(task)
+#endif /* (USE_TASK_SUPERVISOR == true) */
@@ -11,8 +11,9 @@
 
 #include "Logger.h"
 #include "Configuration.h"
-#include "Serialize.h"
+#include "MessagePayload.h"
 #include "Settings.hpp"
+#include "ClockSnapshot.h"
 
 #include "Timezone.h"
 
@@ -22,9 +23,51 @@
 /* Log level for this module */
 #define LOG_LEVEL               (LOG_DEBUG)
 
-/* Periodical task timer */
-static constexpr uint32_t mPeriodicalTaskTimerId = 0x01;
-static constexpr uint32_t mPeriodicalTaskTimerPeriodMs = 1000; // 1 second
+/* Minute timer */
+static constexpr uint32_t mMinuteTimerId = 0x01;
+static constexpr uint32_t mMinuteMs      = 60000;
+/* The timer expires this early and the remaining time is waited with kernel tick resolution */
+static constexpr uint32_t mMinuteLeadMs = 2 * TimerServiceNS::mTimerTickMs;
+/* Expirations closer to the minute boundary are early ones, the minute did not change */
+static constexpr uint32_t mMinuteEarlyMarginMs = 1000;
+
+
+/**
+ * @brief Converts a broken-down time of the C library to a DateTimeNS::tDateTime.
+ */
+static DateTimeNS::tDateTime ToDateTime(const tm& arTime)
+{
+    DateTimeNS::tDateTime wDateTime;
+
+    /* Get date */
+    wDateTime.mDate.mDay     = arTime.tm_mday;
+    wDateTime.mDate.mMonth   = arTime.tm_mon + 1;
+    wDateTime.mDate.mYear    = arTime.tm_year + 1900;
+    wDateTime.mDate.mWeekDay = arTime.tm_wday;
+
+    /* Get time */
+    wDateTime.mTime.mHour    = arTime.tm_hour;
+    wDateTime.mTime.mMinute  = arTime.tm_min;
+    wDateTime.mTime.mSecond  = arTime.tm_sec;
+
+    return wDateTime;
+}
+
+/**
+ * @brief Returns the offset in minutes between the local and the UTC broken-down time of the same instant.
+ */
+static int16_t GetUtcOffsetMinutes(const tm& arLocalTime, const tm& arUtcTime)
+{
+    /* Both times are at most one day apart, also across a year boundary */
+    int32_t wDays = arLocalTime.tm_yday - arUtcTime.tm_yday;
+    if (arLocalTime.tm_year != arUtcTime.tm_year)
+    {
+        wDays = (arLocalTime.tm_year > arUtcTime.tm_year) ? 1 : -1;
+    }
+
+    return static_cast<int16_t>((wDays * 24 * 60) +
+            ((arLocalTime.tm_hour - arUtcTime.tm_hour) * 60) + (arLocalTime.tm_min - arUtcTime.tm_min));
+}
 
 
 /**
@@ -41,15 +84,8 @@ TimeManager::TimeManager(char const* apName, ApplicationNS::tTaskPriority aPrior
  */
 TimeManager::~TimeManager()
 {
-	/* Clean up task timer */
-    if (mpTimer)
-    {
-		/* Stop running timer */
-        mpTimer->stop();
-		/*    and destroy it */
-        delete mpTimer;
-        mpTimer = nullptr;
-    }
+    /* Stop task timer */
+    StopTimer(mMinuteTimer);
 }
 
 void TimeManager::Init(ApplicationNS::tTaskObjects* apTaskObjects)
@@ -57,13 +93,6 @@ void TimeManager::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     /* Initialize base class */
     ApplicationNS::Task::Init(apTaskObjects);
 
-    /* Create periodical timer */
-	mTimerObjects.mTaskHandle = this->getTaskHandle();
-	mTimerObjects.mpTaskMessagesQueue = this->mpTaskObjects->mpMessageQueue;
-
-    mpTimer = new ApplicationNS::TaskTimer(mPeriodicalTaskTimerId, mPeriodicalTaskTimerPeriodMs, true);
-	mpTimer->Init(&mTimerObjects);
-
 //    /* Initialize local time with compilation time */
 //    DateTimeNS::tDateTime wCompileTime = DateTimeNS::CompileTime();
 //    SetLocalTime(wCompileTime);
@@ -83,18 +112,21 @@ void TimeManager::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     NTP.setTimeZone(ConfigNS::mcTimezones[mTimeZone]);
 
    /* Set sync parameters */
-    NTP.setInterval(Settings.GetValue<uint32_t>(
-            ConfigNS::mKeyNtpSyncPeriod, ConfigNS::mDefaultNtpSyncPeriod));
+    mNtpSyncPeriod = Settings.GetValue<uint32_t>(ConfigNS::mKeyNtpSyncPeriod, ConfigNS::mDefaultNtpSyncPeriod);
+    NTP.setInterval(mNtpSyncPeriod);
     NTP.setNTPTimeout(Settings.GetValue<uint32_t>(
             ConfigNS::mKeyNtpSyncTimeout, ConfigNS::mDefaultNtpSyncTimeout));
 //    NTP.setMinSyncAccuracy(5000);
 //    NTP.settimeSyncThreshold(3000);
+
+    /* Publish the not synchronized clock */
+    PublishClock();
 }
 
 void TimeManager::task(void)
 {
-    /* Start notification timer for this task */
-    mpTimer->start();
+    /* Start minute timer for this task */
+    StartMinuteTimer();
 
     /* Execute base class task */
     ApplicationNS::Task::task();
@@ -102,10 +134,37 @@ void TimeManager::task(void)
 
 void TimeManager::ProcessTimerEvent(const uint32_t aTimerId)
 {
-    if (aTimerId == mPeriodicalTaskTimerId)
+    if (aTimerId == mMinuteTimerId)
     {
-        /* Send changed time */
-        SendTime();
+        uint32_t wMsInMinute = GetMillisecondsInMinute();
+
+        if ((mMinuteMs - wMsInMinute) <= mMinuteLeadMs)
+        {
+            /* Wait for the boundary, much finer than the timer resolution */
+            vTaskDelay(pdMS_TO_TICKS(mMinuteMs - wMsInMinute) + 1);
+            wMsInMinute = GetMillisecondsInMinute();
+        }
+
+        if ((mMinuteMs - wMsInMinute) > mMinuteEarlyMarginMs)
+        {
+            /* Minute boundary passed, the milliseconds into the new minute are the latency */
+            mMinuteLatency.mLastMs = static_cast<uint16_t>(wMsInMinute);
+            if (mMinuteLatency.mLastMs > mMinuteLatency.mMaxMs)
+            {
+                mMinuteLatency.mMaxMs = mMinuteLatency.mLastMs;
+            }
+            LOG(LOG_VERBOSE, "TimeManager::ProcessTimerEvent() Minute latency %u ms (max %u ms)",
+                    mMinuteLatency.mLastMs, mMinuteLatency.mMaxMs);
+
+            /* Publish new minute to the clock snapshot */
+            PublishClock();
+
+            /* Send changed time */
+            SendTime();
+        }
+
+        /* Arm for the next minute boundary, or again for the current one after an early expiration */
+        StartMinuteTimer();
     }
     else
     {
@@ -139,12 +198,41 @@ void TimeManager::ProcessIncomingMessage(const MessageNS::Message &arMessage)
 
             /* Set local time from the last NTP sync time */
             SetLocalTimeFromNTP();
+
+            /* Publish synchronized clock */
+            PublishClock();
+
+            /* Send time, the correction may have changed the minute */
+            SendTime();
+            break;
+
+        case MessageNS::tMessageId::REQ_NTP_LAST_SYNC:
+        {
+            /* Answer the last sync request, 0 if NTP time was never synchronized */
+            uint32_t wLastSync = mNtpTimeSynced ? static_cast<uint32_t>(NTP.getLastNTPSync()) : 0;
+            SendMessage(MessageNS::MakeResponse<MessageNS::tMessageId::REQ_NTP_LAST_SYNC>(arMessage, wLastSync));
+        }
+            break;
+
+        case MessageNS::tMessageId::REQ_MINUTE_LATENCY:
+            /* Answer the minute latency request */
+            SendMessage(MessageNS::MakeResponse<MessageNS::tMessageId::REQ_MINUTE_LATENCY>(arMessage, mMinuteLatency));
+            break;
+
+        default:
+            // do nothing
             break;
+    }
+}
 
-        case MessageNS::tMessageId::MSG_EVENT_SETTINGS_CHANGED:
+void TimeManager::ProcessFastEvent(MessageNS::tFastEvent aEvent)
+{
+    switch (aEvent)
+    {
+        case MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED:
         {
             // Settings changed, re-read settings if needed
-            LOG(LOG_DEBUG, "TimeManager::ProcessIncomingMessage() Settings changed");
+            LOG(LOG_DEBUG, "TimeManager::ProcessFastEvent() Settings changed");
 
             /* Get NTP server and time zone from settings */
             uint8_t wNtpServer = Settings.GetValue<uint8_t>(ConfigNS::mKeyNtpServer, ConfigNS::mDefaultNtpServer);
@@ -166,6 +254,9 @@ void TimeManager::ProcessIncomingMessage(const MessageNS::Message &arMessage)
                 mTimeZone = wTimeZone;
                 NTP.setTimeZone(ConfigNS::mcTimezones[mTimeZone]);
 
+                /* Publish new UTC offset */
+                PublishClock();
+
                 if (mNtpTimeSynced)
                 {
                     /* Update local time */
@@ -190,6 +281,9 @@ void TimeManager::SetLocalTimeFromNTP(void)
     {
         DateTimeNS::tDateTime wNTPTime = GetNtpTime();
         SetLocalTime(wNTPTime);
+
+        /* The clock was corrected, re-arm the minute timer */
+        StartMinuteTimer();
     }
 }
 
@@ -202,7 +296,9 @@ void TimeManager::SetLocalTime(DateTimeNS::tDateTime aDateTime)
 void TimeManager::SetLocalTime(uint8_t aHour, uint8_t aMinute, uint8_t aSecond, uint8_t aDay, uint8_t aMonth, uint16_t aYear)
 {
     /* Get local time to keep DST (Daylight Saving Time) info */
-    time_t wTime = time(nullptr);
+    timeval wTimeval;
+    gettimeofday(&wTimeval, nullptr);
+    time_t wTime = wTimeval.tv_sec;
     tm*  wpLocalTime = localtime(&wTime);
 
     /* Set date */
@@ -217,31 +313,25 @@ void TimeManager::SetLocalTime(uint8_t aHour, uint8_t aMinute, uint8_t aSecond,
 
     /* Make new local time */
     time_t  wNewTime = mktime(wpLocalTime);
-    timeval wNewTimeval = { .tv_sec = wNewTime };
 
-    /* Set new local time */
-    settimeofday(&wNewTimeval, nullptr);
+    /* Set new local time if changed, keep the fraction of the second to not shift the minute boundary */
+    if (wNewTime != wTime)
+    {
+        timeval wNewTimeval = { .tv_sec = wNewTime, .tv_usec = wTimeval.tv_usec };
+        settimeofday(&wNewTimeval, nullptr);
+    }
 }
 
 DateTimeNS::tDateTime TimeManager::GetLocalTime(void)
 {
-    DateTimeNS::tDateTime wDateTime;
-
-    /* Get local time */
-    time_t wTime = time(NULL);
-    tm*  wpLocalTime = localtime(&wTime);
-
-    /* Get date */
-    wDateTime.mDate.mDay    = wpLocalTime->tm_mday;
-    wDateTime.mDate.mMonth  = wpLocalTime->tm_mon + 1;
-    wDateTime.mDate.mYear   = wpLocalTime->tm_year + 1900;
-
-    /* Get time */
-    wDateTime.mTime.mHour   = wpLocalTime->tm_hour;
-    wDateTime.mTime.mMinute = wpLocalTime->tm_min;
-    wDateTime.mTime.mSecond = wpLocalTime->tm_sec;
-
-    return wDateTime;
+    /* Get local time from the clock of the minute boundary, see GetMillisecondsInMinute() */
+    timeval wTimeval;
+    gettimeofday(&wTimeval, nullptr);
+    time_t wTime = wTimeval.tv_sec;
+    tm     wLocalTime;
+    localtime_r(&wTime, &wLocalTime);
+
+    return ToDateTime(wLocalTime);
 }
 
 DateTimeNS::tDateTime TimeManager::GetNtpTime(void)
@@ -251,9 +341,9 @@ DateTimeNS::tDateTime TimeManager::GetNtpTime(void)
     /* Check if NTP sync ever happened */
     if (NTP.getLastNTPSync() != 0)
     {
-        uint8_t wHour, wMinute, wSecond;
-        uint8_t wDay,  wMonth;
-        uint16_t wYear;
+        /* sscanf %d requires int arguments */
+        int wHour, wMinute, wSecond;
+        int wDay,  wMonth,  wYear;
 
         /* Parse time string and date strings */
         if ((sscanf(NTP.getTimeStr(), "%d:%d:%d", &wHour, &wMinute, &wSecond) == 3) &&      // 'HH:MM:SS'  , e.g. 00:23:56
@@ -279,6 +369,35 @@ DateTimeNS::tDateTime TimeManager::GetNtpTime(void)
     return wDateTime;
 }
 
+/**
+ * @brief Starts the minute timer for the next minute boundary of the system clock.
+ *
+ * @details
+ * The timer expires up to mMinuteLeadMs before the boundary, as the timer service may
+ * expire a timer up to one tick early or late. A running minute timer is stopped, so the
+ * function is also used to re-arm the timer after the clock was corrected. Daylight saving
+ * time and time zone offsets shift the local time by whole minutes, the boundaries of
+ * local and system time are the same.
+ */
+void TimeManager::StartMinuteTimer(void)
+{
+    uint32_t wRemainingMs = mMinuteMs - GetMillisecondsInMinute();
+
+    StopTimer(mMinuteTimer);
+    mMinuteTimer = StartTimer(mMinuteTimerId, (wRemainingMs > mMinuteLeadMs) ? (wRemainingMs - mMinuteLeadMs) : 0, false);
+}
+
+/**
+ * @brief Returns the milliseconds elapsed since the last minute boundary of the system clock.
+ */
+uint32_t TimeManager::GetMillisecondsInMinute(void)
+{
+    timeval wTimeval;
+    gettimeofday(&wTimeval, nullptr);
+
+    return (static_cast<uint32_t>(wTimeval.tv_sec % 60) * 1000) + (wTimeval.tv_usec / 1000);
+}
+
 void TimeManager::SendTime(void)
 {
     /* Check NTP time sync */
@@ -295,27 +414,10 @@ void TimeManager::SendTime(void)
             LOG(LOG_VERBOSE, "TimeManager::SendTime() Time to send: " PRINTF_DATETIME_PATTERN,
                     PRINTF_DATETIME_FORMAT(wCurrTime));
 
-            /* Create message */
-            MessageNS::Message wMessage;
-            wMessage.mSource = MessageNS::tAddress::TIME_MANAGER;
-            wMessage.mDestination = MessageNS::tAddress::DISPLAY_MANAGER;
-
-            wMessage.mId = MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED;
-
-            /* Serialize DateTime in message payload */
+            /* Publish DateTime as dword */
             uint32_t wDword = DateTimeNS::DateTimeToDword(wCurrTime);
-            if (SerializeNS::SerializeData(wDword, wMessage.mPayload) == sizeof(wDword))
-            {
-                /* Set payload length */
-                wMessage.mPayloadLength = sizeof(wDword);
-                /* Send message */
-                SendMessage(wMessage);
-            }
-            else
-            {
-                //TODO handle serialization error
-            }
-
+            PublishMessage(MessageNS::MakeMessage<MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED>(
+                    MessageNS::tAddress::TIME_MANAGER, MessageNS::tAddress::APPLICATION_MANAGER, wDword));
 
             /* Update previous time*/
             mSentTime = wCurrTime;
@@ -323,6 +425,41 @@ void TimeManager::SendTime(void)
     }
 }
 
+/**
+ * @brief Publishes the local time, UTC offset, DST flag and sync quality to the ClockSnapshot.
+ *
+ * @details
+ * Called at every minute change, after a NTP synchronization and after the time zone changed,
+ * so other tasks read the time from the snapshot instead of converting it themselves.
+ */
+void TimeManager::PublishClock(void)
+{
+    ClockSnapshotNS::tClockState wState = {};
+
+    timeval wTimeval;
+    gettimeofday(&wTimeval, nullptr);
+    time_t wTime = wTimeval.tv_sec;
+    tm     wLocalTime;
+    tm     wUtcTime;
+    localtime_r(&wTime, &wLocalTime);
+    gmtime_r(&wTime, &wUtcTime);
+
+    wState.mLocalTime        = ToDateTime(wLocalTime);
+    wState.mUtcTime          = static_cast<uint32_t>(wTime);
+    wState.mUtcOffsetMinutes = GetUtcOffsetMinutes(wLocalTime, wUtcTime);
+    wState.mDst              = (wLocalTime.tm_isdst > 0);
+    wState.mSyncQuality      = ClockSnapshotNS::tSyncQuality::CLOCK_NOT_SYNCED;
+
+    if (mNtpTimeSynced)
+    {
+        wState.mLastSync    = static_cast<uint32_t>(NTP.getLastNTPSync());
+        wState.mSyncQuality = ((wState.mUtcTime - wState.mLastSync) > (ClockSnapshotNS::mStaleSyncPeriods * mNtpSyncPeriod))
+                ? ClockSnapshotNS::tSyncQuality::CLOCK_SYNC_STALE : ClockSnapshotNS::tSyncQuality::CLOCK_SYNCED;
+    }
+
+    ClockSnapshot.Publish(wState);
+}
+
 void TimeManager::HandleNTPSyncEvent(NTPEvent_t aEvent)
 {
     /* LOG */
@@ -338,15 +475,9 @@ void TimeManager::HandleNTPSyncEvent(NTPEvent_t aEvent)
 //            LOG(LOG_VERBOSE, "TimeManager::HandleNTPSyncEvent() Successful NTP sync at: %s",
 //                    NTP.getTimeDateString(NTP.getLastNTPSync()));
 
-            /* Create message */
-            MessageNS::Message wMessage;
-            wMessage.mSource = MessageNS::tAddress::TIME_MANAGER;
-            wMessage.mDestination = MessageNS::tAddress::TIME_MANAGER;
-
-            wMessage.mId = MessageNS::tMessageId::MGS_EVENT_NTP_LASTSYNC_TIME;
-
             /* Send message */
-            SendMessage(wMessage);
+            SendMessage(MessageNS::MakeMessage<MessageNS::tMessageId::MGS_EVENT_NTP_LASTSYNC_TIME>(
+                    MessageNS::tAddress::TIME_MANAGER, MessageNS::tAddress::TIME_MANAGER));
         }
             break;
 
@@ -11,6 +11,7 @@
 #include <ESPNtpClient.h>
 
 #include "Application.h"
+#include "MessagePayload.h"
 
 #include "DateTime.h"
 
@@ -25,9 +26,11 @@ public:
     void Init(ApplicationNS::tTaskObjects* apTaskObjects) override;
 
 private:
-	/* Periodical timer for this task */
-	ApplicationNS::tTaskTimerObjects mTimerObjects;
-    ApplicationNS::TaskTimer* mpTimer;
+    /* One-shot timer expiring at the next minute boundary */
+    TimerServiceNS::tTimerHandle mMinuteTimer = TimerServiceNS::mInvalidTimerHandle;
+
+    /* Latency of the minute changes behind the minute boundary */
+    MessageNS::tMinuteLatency mMinuteLatency = {};
 
     /* Last sent datatime */
     DateTimeNS::tDateTime mSentTime;
@@ -35,6 +38,9 @@ private:
     /* Flag indicates that the NTP time is synchronized */
     bool mNtpTimeSynced = false;
 
+    /* NTP sync period in seconds */
+    uint32_t mNtpSyncPeriod;
+
     uint8_t mNtpServer;
     uint8_t mTimeZone;
 
@@ -44,6 +50,8 @@ private:
     void ProcessTimerEvent(const uint32_t aTimerId = 0) override;
     /* ApplicationNS::Task::ProcessIncomingMessage() */
     void ProcessIncomingMessage(const MessageNS::Message &arMessage) override;
+    /* ApplicationNS::Task::ProcessFastEvent() */
+    void ProcessFastEvent(MessageNS::tFastEvent aEvent) override;
 
     DateTimeNS::tDateTime GetLocalTime(void);
     DateTimeNS::tDateTime GetNtpTime(void);
@@ -55,7 +63,11 @@ private:
 
     void HandleNTPSyncEvent(NTPEvent_t aEvent);
 
+    void StartMinuteTimer(void);
+    uint32_t GetMillisecondsInMinute(void);
+
     void SendTime(void);
+    void PublishClock(void);
 };
 
 #endif /* TIME_MANAGER_H_ */
\ No newline at end of file
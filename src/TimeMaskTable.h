@@ -0,0 +1,120 @@
+/*
+ * TimeMaskTable.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include "BitMatrix.h"
+#include "WordClockLayout.h"
+
+
+namespace TimeMaskNS
+{
+    /**
+     * @brief Mask of the lit LEDs in front panel order, see LedMappingNS::LedMap for the stripe order.
+     */
+    typedef BitMatrix<MATRIX_WIDTH, MATRIX_HEIGHT> tLedMask;
+
+    /**
+     * @brief LED masks of all times, generated at compile time.
+     *
+     * @details
+     * The mask of a time is the union of the mask of the hour and minute step, the mask of the
+     * extra minutes (if enabled) and the "ES IST" mask (if enabled).
+     */
+    struct tTimeMaskTable
+    {
+        /** @brief Minute and hour words per mode, hour (0..11, 0 is 12 o'clock) and minute step */
+        tLedMask mTimeMasks[WORDCLOCK_MODE_NUMBER][HOURS_COUNT][MINUTE_COUNT];
+        /** @brief Extra minute words, none and +1 ... +4 */
+        tLedMask mExtraMinuteMasks[EXTRA_MINUTE_COUNT];
+        /** @brief "ES IST" words */
+        tLedMask mItIsMask;
+    };
+
+    /** @brief Sets the LEDs of a word in the mask, the end of words marker is ignored */
+    constexpr void AddWord(tLedMask& arMask, const tWord aWord)
+    {
+        if ((aWord > WORD_END_OF_WORDS) && (aWord < WORD_MAX_NUMBER))
+        {
+            const tWordData& wWordData = mcWordDataArray[aWord];
+            arMask.SetLine(wWordData.mRow, wWordData.mColumn, wWordData.mLength);
+        }
+    }
+
+    /** @brief Returns the mask of a single word */
+    constexpr tLedMask GetWordMask(const tWord aWord)
+    {
+        tLedMask wMask;
+        AddWord(wMask, aWord);
+        return wMask;
+    }
+
+    /**
+     * @brief Returns the mask of the minute and hour words of a time.
+     *
+     * @param aMode WordClock display mode
+     * @param aHour Hour 0..11 (0 is 12 o'clock), the hour offset of the minute step is applied here
+     * @param aMinuteStep Minute step 0..11 (0, 5, ... 55 minutes)
+     */
+    constexpr tLedMask GetTimeMask(const tWordClockMode aMode, const uint8_t aHour, const uint8_t aMinuteStep)
+    {
+        tLedMask wMask;
+        const tMinuteDisplay& wMinuteDisplay = mcWordMinutesTable[aMode][aMinuteStep];
+
+        /* Correct hour offset */
+        uint8_t wHour = aHour;
+        if ((wMinuteDisplay.mFlags & HOUR_OFFSET_1) == HOUR_OFFSET_1)
+        {
+            wHour = (wHour + 1) % HOURS_COUNT;
+        }
+
+        for (uint8_t wI = 0; wI < MAX_MINUTE_WORDS; wI++)
+        {
+            AddWord(wMask, wMinuteDisplay.wMinuteWords[wI]);
+        }
+
+        for (uint8_t wI = 0; wI < MAX_HOUR_WORDS; wI++)
+        {
+            AddWord(wMask, mcWordHoursTable[wMinuteDisplay.mHourMode][wHour][wI]);
+        }
+
+        return wMask;
+    }
+
+    /** @brief Generates the masks of all times */
+    constexpr tTimeMaskTable GenerateTimeMaskTable(void)
+    {
+        tTimeMaskTable wTable;
+
+        for (uint8_t wMode = 0; wMode < WORDCLOCK_MODE_NUMBER; wMode++)
+        {
+            for (uint8_t wHour = 0; wHour < HOURS_COUNT; wHour++)
+            {
+                for (uint8_t wMinuteStep = 0; wMinuteStep < MINUTE_COUNT; wMinuteStep++)
+                {
+                    wTable.mTimeMasks[wMode][wHour][wMinuteStep] =
+                            GetTimeMask(static_cast<tWordClockMode>(wMode), wHour, wMinuteStep);
+                }
+            }
+        }
+
+        for (uint8_t wExtra = 0; wExtra < EXTRA_MINUTE_COUNT; wExtra++)
+        {
+            for (uint8_t wI = 0; wI < MAX_EXTRA_MINUTE_WORDS; wI++)
+            {
+                AddWord(wTable.mExtraMinuteMasks[wExtra], mcWordExtraMinutesTable[wExtra][wI]);
+            }
+        }
+
+        AddWord(wTable.mItIsMask, WORD_ES);
+        AddWord(wTable.mItIsMask, WORD_IST);
+
+        return wTable;
+    }
+
+}   /* end of namespace TimeMaskNS */
@@ -0,0 +1,690 @@
+/*
+ * TimerService.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#include "Logger.h"
+
+#include "TimerService.h"
+
+
+/* Log level for this module */
+#define LOG_LEVEL   (LOG_WARN)
+
+
+namespace TimerServiceNS
+{
+/**
+ *
+ * Implementation of the TimerServiceNS::TimerService::TickTimer class
+ *
+ */
+TimerService::TickTimer::TickTimer(TimerService* apService)
+    : FreeRTOScpp::TimerClass("TimerService", pdMS_TO_TICKS(mTimerTickMs), false), mpService(apService)
+{
+    // do nothing
+}
+
+void TimerService::TickTimer::timer(void)
+{
+    mpService->Advance();
+}
+
+
+/**
+ *
+ * Implementation of the TimerServiceNS::TimerService class
+ *
+ */
+TimerService::TimerService()
+{
+    /* All timers are free */
+    for (uint16_t wI = 0; wI < mTimerCount; wI++)
+    {
+        mTimers[wI] = {};
+        mTimers[wI].mNext = ((wI + 1) < mTimerCount) ? (wI + 1) : mcNoTimer;
+    }
+    mFreeHead = 0;
+
+    for (uint16_t wI = 0; wI < mcSlotCount; wI++)
+    {
+        mSlots[wI] = mcNoTimer;
+    }
+}
+
+TimerService::~TimerService()
+{
+    // do nothing
+}
+
+/**
+ * @brief Creates the software timer advancing the wheel.
+ *
+ * @details
+ * The tick timer is a static object created on the first call, once the kernel runs. There is
+ * a single timer service, Init() is called once. The tick timer is armed when the first timer
+ * is started.
+ */
+void TimerService::Init(void)
+{
+    static TickTimer mTickTimer(this);
+
+    portENTER_CRITICAL(&mLock);
+    mNextKernelTicks = xTaskGetTickCount() + pdMS_TO_TICKS(mTimerTickMs);
+    mpTickTimer      = &mTickTimer;
+    portEXIT_CRITICAL(&mLock);
+
+    ArmTick(portMAX_DELAY);
+}
+
+/**
+ * @brief Registers a task as client of the timer service.
+ *
+ * @param aTaskHandle Handle of the task to notify about expired timers
+ * @param aNotificationBitsToSet Notification bits to set when timers of the client expired
+ * @return Client to pass to the other functions, mInvalidTimerClient if all clients are registered
+ */
+tTimerClient TimerService::RegisterClient(TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet)
+{
+    tTimerClient wClient = mInvalidTimerClient;
+
+    portENTER_CRITICAL(&mLock);
+    if (mClientCount < mTimerClientCount)
+    {
+        wClient = mClientCount++;
+        mClients[wClient] = { aTaskHandle, aNotificationBitsToSet, mcNoTimer, mcNoTimer };
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    if (wClient == mInvalidTimerClient)
+    {
+        LOG(LOG_ERROR, "TimerService::RegisterClient() Too many clients");
+    }
+
+    return wClient;
+}
+
+/**
+ * @brief Starts a timer expiring once after a delay.
+ *
+ * @param aClient Client owning the timer
+ * @param aTimerId ID passed to the client on expiration
+ * @param aDelayMs Delay in milliseconds, rounded up to the timer resolution
+ * @return Handle of the timer, mInvalidTimerHandle if no timer is available
+ */
+tTimerHandle TimerService::StartOneShot(tTimerClient aClient, uint32_t aTimerId, uint32_t aDelayMs)
+{
+    return Start(aClient, aTimerId, MsToTicks(aDelayMs), 0);
+}
+
+/**
+ * @brief Starts a timer expiring periodically.
+ *
+ * @details
+ * The expirations do not drift, each one is scheduled one period after the previous one.
+ *
+ * @param aClient Client owning the timer
+ * @param aTimerId ID passed to the client on expiration
+ * @param aPeriodMs Period in milliseconds, rounded up to the timer resolution
+ * @return Handle of the timer, mInvalidTimerHandle if no timer is available
+ */
+tTimerHandle TimerService::StartPeriodic(tTimerClient aClient, uint32_t aTimerId, uint32_t aPeriodMs)
+{
+    uint32_t wPeriodTicks = MsToTicks(aPeriodMs);
+    if (wPeriodTicks == 0)
+    {
+        wPeriodTicks = 1;
+    }
+    return Start(aClient, aTimerId, wPeriodTicks, wPeriodTicks);
+}
+
+/**
+ * @brief Starts a timer expiring once at a point in time.
+ *
+ * @param aClient Client owning the timer
+ * @param aTimerId ID passed to the client on expiration
+ * @param aDeadlineMs Expiration time as millis() value, a passed deadline expires with the next tick
+ * @return Handle of the timer, mInvalidTimerHandle if no timer is available
+ */
+tTimerHandle TimerService::StartAt(tTimerClient aClient, uint32_t aTimerId, uint32_t aDeadlineMs)
+{
+    int32_t wDelayMs = static_cast<int32_t>(aDeadlineMs - millis());
+    return Start(aClient, aTimerId, MsToTicks((wDelayMs > 0) ? wDelayMs : 0), 0);
+}
+
+/**
+ * @brief Stops a timer, a pending expiration is not delivered anymore.
+ *
+ * @param aHandle Handle of the timer
+ * @return true if the timer was stopped, false if the handle is invalid or the timer already expired
+ */
+bool TimerService::Stop(tTimerHandle aHandle)
+{
+    uint16_t wIndex  = static_cast<uint16_t>(aHandle & 0xFFFF);
+    bool     wResult = false;
+
+    portENTER_CRITICAL(&mLock);
+    if ((wIndex < mTimerCount) &&
+        (mTimers[wIndex].mGeneration == static_cast<uint16_t>(aHandle >> 16)) &&
+        ((mTimers[wIndex].mState == TIMER_ARMED) || (mTimers[wIndex].mState == TIMER_FIRED)))
+    {
+        tTimer& wTimer = mTimers[wIndex];
+
+        if (wTimer.mState == TIMER_ARMED)
+        {
+            Unlink(wIndex);
+        }
+
+        if (wTimer.mQueued)
+        {
+            /* Still in the expired list of the client, freed when taken */
+            wTimer.mState = TIMER_STOPPED;
+        }
+        else
+        {
+            Free(wIndex);
+        }
+        wResult = true;
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    return wResult;
+}
+
+/**
+ * @brief Takes the oldest expired timer of a client (client task).
+ *
+ * @param aClient Client
+ * @param arTimerId ID of the expired timer
+ * @return true if a timer expired, false if the expired list is empty
+ */
+bool TimerService::PopExpired(tTimerClient aClient, uint32_t& arTimerId)
+{
+    bool wResult = false;
+
+    if (aClient >= mClientCount)
+    {
+        return false;
+    }
+
+    tClient& wClient = mClients[aClient];
+
+    portENTER_CRITICAL(&mLock);
+    while ((wResult == false) && (wClient.mExpiredHead != mcNoTimer))
+    {
+        uint16_t wIndex = wClient.mExpiredHead;
+        tTimer&  wTimer = mTimers[wIndex];
+
+        /* Remove from the expired list */
+        wClient.mExpiredHead = wTimer.mNextExpired;
+        if (wClient.mExpiredHead == mcNoTimer)
+        {
+            wClient.mExpiredTail = mcNoTimer;
+        }
+        wTimer.mQueued = false;
+
+        switch (wTimer.mState)
+        {
+            case TIMER_ARMED:
+                /* Periodic timer, stays armed */
+                arTimerId = wTimer.mTimerId;
+                wResult   = true;
+                break;
+
+            case TIMER_FIRED:
+                /* One-shot timer, done */
+                arTimerId = wTimer.mTimerId;
+                wResult   = true;
+                Free(wIndex);
+                break;
+
+            default:
+                /* Stopped after the expiration */
+                Free(wIndex);
+                break;
+        }
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    return wResult;
+}
+
+/**
+ * @brief Allocates, links and arms a timer.
+ */
+tTimerHandle TimerService::Start(tTimerClient aClient, uint32_t aTimerId, uint32_t aDelayTicks, uint32_t aPeriodTicks)
+{
+    tTimerHandle wHandle = mInvalidTimerHandle;
+
+    if (aClient >= mClientCount)
+    {
+        return mInvalidTimerHandle;
+    }
+
+    if (aDelayTicks > mcMaxDelayTicks)
+    {
+        aDelayTicks = mcMaxDelayTicks;
+    }
+    if (aPeriodTicks > mcMaxDelayTicks)
+    {
+        aPeriodTicks = mcMaxDelayTicks;
+    }
+
+    bool wArmTick = false;
+
+    portENTER_CRITICAL(&mLock);
+    uint32_t wNowTick = Synchronize();
+    if (mFreeHead != mcNoTimer)
+    {
+        uint16_t wIndex = mFreeHead;
+        tTimer&  wTimer = mTimers[wIndex];
+
+        mFreeHead = wTimer.mNext;
+
+        wTimer.mExpiry  = wNowTick + aDelayTicks;
+        wTimer.mPeriod  = aPeriodTicks;
+        wTimer.mTimerId = aTimerId;
+        wTimer.mState   = TIMER_ARMED;
+        wTimer.mClient  = aClient;
+        wTimer.mQueued  = false;
+        Link(wIndex);
+
+        /* Wake up earlier if the slot of the timer is processed before the next wake-up */
+        uint32_t wEventTick = GetSlotTick(wTimer.mSlot);
+        if ((mIsWakeArmed == false) || (static_cast<int32_t>(wEventTick - mWakeTick) < 0))
+        {
+            mWakeTick    = wEventTick;
+            mIsWakeArmed = true;
+            wArmTick     = true;
+        }
+
+        mActiveCount++;
+        wHandle = (static_cast<tTimerHandle>(wTimer.mGeneration) << 16) | wIndex;
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    if (wArmTick)
+    {
+        ArmTick(portMAX_DELAY);
+    }
+
+    if (wHandle == mInvalidTimerHandle)
+    {
+        LOG(LOG_ERROR, "TimerService::Start() No timer available for timer ID %lu", static_cast<unsigned long>(aTimerId));
+    }
+
+    return wHandle;
+}
+
+/**
+ * @brief Processes the wheel ticks due (timer service task).
+ *
+ * @details
+ * Only the ticks with work to do are processed, the empty ticks between them are skipped.
+ * Catches up if the software timer was delayed. The clients are notified after leaving the
+ * critical section, then the software timer is armed for the next tick with work to do.
+ */
+void TimerService::Advance(void)
+{
+    uint32_t wClientsToNotify = 0;
+
+    portENTER_CRITICAL(&mLock);
+    for (;;)
+    {
+        mIsWakeArmed = GetNextEvent(mWakeTick);
+        if ((mIsWakeArmed == false) ||
+            (static_cast<int32_t>(xTaskGetTickCount() - GetKernelTicks(mWakeTick)) < 0))
+        {
+            /* Wheel empty or next tick with work not due yet */
+            break;
+        }
+
+        /* Skip the empty ticks */
+        mNextKernelTicks = GetKernelTicks(mWakeTick);
+        mNextTick        = mWakeTick;
+
+        uint32_t wTick = mNextTick;
+
+        /* Once per revolution of a level, move the timers of the next upper slot one level down */
+        if ((wTick & (mcLevel0Slots - 1)) == 0)
+        {
+            for (uint8_t wLevel = 1; (wLevel < mcLevelCount) && (Cascade(wLevel, wTick) == 0); wLevel++)
+            {
+                // cascade further up
+            }
+        }
+
+        mNextTick++;
+        mNextKernelTicks += pdMS_TO_TICKS(mTimerTickMs);
+
+        /* Expire the timers of the current slot */
+        uint16_t wSlot  = wTick & (mcLevel0Slots - 1);
+        uint16_t wIndex = mSlots[wSlot];
+        mSlots[wSlot] = mcNoTimer;
+
+        while (wIndex != mcNoTimer)
+        {
+            uint16_t wNext = mTimers[wIndex].mNext;
+            wClientsToNotify |= Expire(wIndex);
+            wIndex = wNext;
+        }
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    for (tTimerClient wClient = 0; wClientsToNotify != 0; wClient++, wClientsToNotify >>= 1)
+    {
+        if ((wClientsToNotify & 0x01) != 0)
+        {
+            xTaskNotify(mClients[wClient].mTaskHandle, mClients[wClient].mNotificationBits, eSetBits);
+        }
+    }
+
+    /* Called by the timer service task, its command queue must not be waited for */
+    ArmTick(0);
+}
+
+/**
+ * @brief Arms the software timer for the wake-up tick, outside of the critical section.
+ *
+ * @details
+ * Another task may start a timer and send an earlier wake-up between reading and sending the
+ * wake-up tick. The command sent last wins, so the wake-up is sent again until it did not
+ * change while it was sent. A wake-up which is not needed anymore only costs a call of
+ * Advance(), so the software timer is not stopped.
+ *
+ * @param aTicksToWait Ticks to wait for space in the command queue of the timer service task
+ */
+void TimerService::ArmTick(TickType_t aTicksToWait)
+{
+    bool       wIsArmed;
+    TickType_t wWakeKernelTicks = 0;
+    bool       wChanged = true;
+
+    portENTER_CRITICAL(&mLock);
+    wIsArmed = mIsWakeArmed && (mpTickTimer != nullptr);
+    if (wIsArmed)
+    {
+        wWakeKernelTicks = GetKernelTicks(mWakeTick);
+    }
+    portEXIT_CRITICAL(&mLock);
+
+    while (wIsArmed && wChanged)
+    {
+        int32_t wDelay = static_cast<int32_t>(wWakeKernelTicks - xTaskGetTickCount());
+        if (mpTickTimer->period((wDelay > 0) ? static_cast<TickType_t>(wDelay) : 1, aTicksToWait) == false)
+        {
+            LOG(LOG_ERROR, "TimerService::ArmTick() Command queue of the timer service task full");
+        }
+
+        portENTER_CRITICAL(&mLock);
+        wIsArmed = mIsWakeArmed;
+        wChanged = wIsArmed && (GetKernelTicks(mWakeTick) != wWakeKernelTicks);
+        if (wChanged)
+        {
+            wWakeKernelTicks = GetKernelTicks(mWakeTick);
+        }
+        portEXIT_CRITICAL(&mLock);
+    }
+}
+
+/**
+ * @brief Skips the empty ticks of the wheel up to the current time (critical section held).
+ *
+ * @details
+ * Without a tick with work to do, the software timer is not running and the next tick to
+ * process falls behind the time. It is moved forward, but never beyond the wake-up tick,
+ * which may be overdue while the timer service task did not run yet.
+ *
+ * @return Next tick to process if the wheel advanced every tick, the start of new timers
+ */
+uint32_t TimerService::Synchronize(void)
+{
+    int32_t wLateTicks = static_cast<int32_t>(xTaskGetTickCount() - mNextKernelTicks);
+    if (wLateTicks < 0)
+    {
+        return mNextTick;
+    }
+
+    /* First tick not due before now, as if all due ticks were processed */
+    uint32_t wNowTick  = mNextTick + ((wLateTicks + pdMS_TO_TICKS(mTimerTickMs) - 1) / pdMS_TO_TICKS(mTimerTickMs));
+    uint32_t wSkipTick = wNowTick;
+    if (mIsWakeArmed && (static_cast<int32_t>(wSkipTick - mWakeTick) > 0))
+    {
+        wSkipTick = mWakeTick;
+    }
+
+    mNextKernelTicks = GetKernelTicks(wSkipTick);
+    mNextTick        = wSkipTick;
+
+    return wNowTick;
+}
+
+/**
+ * @brief Returns the next tick with work to do (critical section held).
+ *
+ * @param arTick Next tick processing a non-empty slot
+ * @return true if a slot is not empty, false if no timer is armed
+ */
+bool TimerService::GetNextEvent(uint32_t& arTick) const
+{
+    bool wFound = false;
+
+    for (uint16_t wSlot = 0; wSlot < mcSlotCount; wSlot++)
+    {
+        if (mSlots[wSlot] != mcNoTimer)
+        {
+            uint32_t wTick = GetSlotTick(wSlot);
+            if ((wFound == false) || (static_cast<int32_t>(wTick - arTick) < 0))
+            {
+                arTick = wTick;
+                wFound = true;
+            }
+        }
+    }
+
+    return wFound;
+}
+
+/**
+ * @brief Returns the next tick processing a slot: expiring a first level slot or cascading an upper one.
+ */
+uint32_t TimerService::GetSlotTick(uint16_t aSlot) const
+{
+    if (aSlot < mcLevel0Slots)
+    {
+        return mNextTick + ((aSlot - mNextTick) & (mcLevel0Slots - 1));
+    }
+
+    uint8_t  wLevel      = 1 + (aSlot - mcLevel0Slots) / mcLevelNSlots;
+    uint16_t wLevelIndex = (aSlot - mcLevel0Slots) % mcLevelNSlots;
+    uint8_t  wShift      = mcLevel0Bits + (wLevel - 1) * mcLevelNBits;
+
+    /* The slots of the level are cascaded in turn, on the ticks with all lower level bits clear */
+    uint32_t wTick = (mNextTick + (static_cast<uint32_t>(1) << wShift) - 1) & ~((static_cast<uint32_t>(1) << wShift) - 1);
+    uint16_t wTickIndex = (wTick >> wShift) & (mcLevelNSlots - 1);
+
+    return wTick + (static_cast<uint32_t>((wLevelIndex - wTickIndex) & (mcLevelNSlots - 1)) << wShift);
+}
+
+/**
+ * @brief Returns the kernel tick count at which a wheel tick is due.
+ */
+TickType_t TimerService::GetKernelTicks(uint32_t aTick) const
+{
+    return mNextKernelTicks + static_cast<TickType_t>((aTick - mNextTick) * pdMS_TO_TICKS(mTimerTickMs));
+}
+
+/**
+ * @brief Moves the timers of an upper level slot to the lower levels.
+ *
+ * @param aLevel Upper level, 1 .. mcLevelCount - 1
+ * @param aTick Tick being processed
+ * @return Index of the cascaded slot in its level, the next level is cascaded if 0
+ */
+uint16_t TimerService::Cascade(uint8_t aLevel, uint32_t aTick)
+{
+    uint16_t wLevelIndex = (aTick >> (mcLevel0Bits + (aLevel - 1) * mcLevelNBits)) & (mcLevelNSlots - 1);
+    uint16_t wSlot       = mcLevel0Slots + (aLevel - 1) * mcLevelNSlots + wLevelIndex;
+
+    uint16_t wIndex = mSlots[wSlot];
+    mSlots[wSlot] = mcNoTimer;
+
+    while (wIndex != mcNoTimer)
+    {
+        uint16_t wNext = mTimers[wIndex].mNext;
+        Link(wIndex);
+        wIndex = wNext;
+    }
+
+    return wLevelIndex;
+}
+
+/**
+ * @brief Handles the expiration of a timer, already removed from its slot.
+ *
+ * @return Bit of the client if the timer was added to its expired list, 0 otherwise
+ */
+uint32_t TimerService::Expire(uint16_t aIndex)
+{
+    tTimer& wTimer = mTimers[aIndex];
+
+    if (wTimer.mPeriod != 0)
+    {
+        /* Re-arm periodic timer */
+        wTimer.mExpiry += wTimer.mPeriod;
+        Link(aIndex);
+    }
+    else
+    {
+        wTimer.mState = TIMER_FIRED;
+    }
+
+    if (wTimer.mQueued)
+    {
+        /* Previous expiration not taken yet */
+        mOverrunCount++;
+        return 0;
+    }
+
+    /* Append to the expired list of the client */
+    tClient& wClient = mClients[wTimer.mClient];
+
+    wTimer.mQueued      = true;
+    wTimer.mNextExpired = mcNoTimer;
+    if (wClient.mExpiredTail == mcNoTimer)
+    {
+        wClient.mExpiredHead = aIndex;
+    }
+    else
+    {
+        mTimers[wClient.mExpiredTail].mNextExpired = aIndex;
+    }
+    wClient.mExpiredTail = aIndex;
+
+    return static_cast<uint32_t>(1) << wTimer.mClient;
+}
+
+/**
+ * @brief Links a timer in the wheel slot of its expiration.
+ */
+void TimerService::Link(uint16_t aIndex)
+{
+    tTimer&  wTimer = mTimers[aIndex];
+    uint16_t wSlot  = GetSlot(wTimer.mExpiry);
+
+    wTimer.mSlot = wSlot;
+    wTimer.mPrev = mcNoTimer;
+    wTimer.mNext = mSlots[wSlot];
+    if (wTimer.mNext != mcNoTimer)
+    {
+        mTimers[wTimer.mNext].mPrev = aIndex;
+    }
+    mSlots[wSlot] = aIndex;
+}
+
+/**
+ * @brief Unlinks a timer from its wheel slot.
+ */
+void TimerService::Unlink(uint16_t aIndex)
+{
+    tTimer& wTimer = mTimers[aIndex];
+
+    if (wTimer.mPrev != mcNoTimer)
+    {
+        mTimers[wTimer.mPrev].mNext = wTimer.mNext;
+    }
+    else
+    {
+        mSlots[wTimer.mSlot] = wTimer.mNext;
+    }
+
+    if (wTimer.mNext != mcNoTimer)
+    {
+        mTimers[wTimer.mNext].mPrev = wTimer.mPrev;
+    }
+}
+
+/**
+ * @brief Returns a timer to the free list.
+ *
+ * @details
+ * The generation is incremented, so existing handles of the timer become invalid.
+ */
+void TimerService::Free(uint16_t aIndex)
+{
+    tTimer& wTimer = mTimers[aIndex];
+
+    wTimer.mState = TIMER_FREE;
+    wTimer.mGeneration++;
+    wTimer.mNext  = mFreeHead;
+    mFreeHead     = aIndex;
+
+    mActiveCount--;
+}
+
+/**
+ * @brief Returns the wheel slot of an expiration tick.
+ *
+ * @details
+ * The level is chosen by the distance to the next tick to process, the slot within the level
+ * by the bits of the expiration tick of that level. Passed expirations go to the next slot.
+ */
+uint16_t TimerService::GetSlot(uint32_t aExpiry) const
+{
+    int32_t wDelta = static_cast<int32_t>(aExpiry - mNextTick);
+
+    if (wDelta < 0)
+    {
+        return mNextTick & (mcLevel0Slots - 1);
+    }
+
+    if (static_cast<uint32_t>(wDelta) < mcLevel0Slots)
+    {
+        return aExpiry & (mcLevel0Slots - 1);
+    }
+
+    for (uint8_t wLevel = 1; wLevel < mcLevelCount; wLevel++)
+    {
+        uint8_t wShift = mcLevel0Bits + (wLevel - 1) * mcLevelNBits;
+
+        if ((static_cast<uint32_t>(wDelta) >> (wShift + mcLevelNBits)) == 0)
+        {
+            return mcLevel0Slots + (wLevel - 1) * mcLevelNSlots + ((aExpiry >> wShift) & (mcLevelNSlots - 1));
+        }
+    }
+
+    /* Beyond the wheel (delays are clamped), take the farthest slot */
+    return mcLevel0Slots + (mcLevelCount - 2) * mcLevelNSlots +
+            ((aExpiry >> (mcLevel0Bits + (mcLevelCount - 2) * mcLevelNBits)) & (mcLevelNSlots - 1));
+}
+
+/**
+ * @brief Converts milliseconds to wheel ticks, rounded up so a timer never expires early.
+ */
+uint32_t TimerService::MsToTicks(uint32_t aMs) const
+{
+    return (aMs / mTimerTickMs) + (((aMs % mTimerTickMs) != 0) ? 1 : 0);
+}
+
+}   /* end of namespace TimerServiceNS */
@@ -0,0 +1,209 @@
+/*
+ * TimerService.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#include <FreeRTOScpp.h>
+#include <TimerCPP.h>
+
+
+namespace TimerServiceNS
+{
+    /** @brief Resolution of the timers in milliseconds (one wheel tick) */
+    static constexpr uint32_t mTimerTickMs      = 10;
+    /** @brief Number of timers available for all tasks */
+    static constexpr uint16_t mTimerCount       = 128;
+    /** @brief Number of tasks which can use timers */
+    static constexpr uint8_t  mTimerClientCount = 8;
+
+    /**
+     * @brief Handle of a timer.
+     *
+     * @details
+     * Index of the timer in the low half word and a generation counter in the high half word,
+     * so a stale handle of an expired or stopped timer does not refer to a reused timer.
+     */
+    typedef uint32_t tTimerHandle;
+
+    /** @brief Invalid timer handle, returned if no timer is available */
+    static constexpr tTimerHandle mInvalidTimerHandle = 0xFFFFFFFF;
+
+    /** @brief Client (task) of the timer service, returned by TimerService::RegisterClient() */
+    typedef uint8_t tTimerClient;
+
+    /** @brief Invalid client, returned if all clients are registered */
+    static constexpr tTimerClient mInvalidTimerClient = 0xFF;
+
+    /**
+     * @brief Timers of all tasks on a hierarchical timing wheel.
+     *
+     * @details
+     * The wheel has four levels: 256 slots of one mTimerTickMs tick, then three levels of 64
+     * slots, each slot spanning a full revolution of the level below (2.56 s, 164 s and 2.9 h
+     * with 10 ms ticks). Starting or stopping a timer links or unlinks it in a slot in O(1), a
+     * tick only visits the current slot of the first level and, once per revolution, moves the
+     * timers of one upper slot one level down. Delays beyond the last level (about 7.7 days) are
+     * clamped.
+     *
+     * A single one-shot FreeRTOS software timer advances the wheel. It is armed for the next
+     * tick with work to do, the expiration of a first level slot or the cascade of an upper
+     * slot, and the empty ticks up to it are skipped. So a task waiting for the next minute
+     * wakes the system about twice per minute instead of every tick, and the software timer
+     * stays idle while no timer is armed. Starting a timer with an earlier expiration re-arms
+     * it.
+     *
+     * Timers are taken from a fixed pool, so no kernel objects or heap are needed per timer.
+     * One-shot, periodic and deadline timers (expiring at a given millis() value) are supported.
+     *
+     * Expirations are not sent as messages. The expired timer is appended to the expired list
+     * of its client and the client task is notified with its timer notification bits. The task
+     * then takes the expired timer IDs with PopExpired(). A periodic timer expiring again before
+     * it was taken is counted as overrun and delivered once.
+     *
+     * Clients shall be registered during the application initialization.
+     */
+    class TimerService
+    {
+    public:
+        TimerService();
+        virtual ~TimerService();
+
+        void Init(void);
+
+        tTimerClient RegisterClient(TaskHandle_t aTaskHandle, uint32_t aNotificationBitsToSet);
+
+        tTimerHandle StartOneShot(tTimerClient aClient, uint32_t aTimerId, uint32_t aDelayMs);
+        tTimerHandle StartPeriodic(tTimerClient aClient, uint32_t aTimerId, uint32_t aPeriodMs);
+        tTimerHandle StartAt(tTimerClient aClient, uint32_t aTimerId, uint32_t aDeadlineMs);
+        bool Stop(tTimerHandle aHandle);
+
+        bool PopExpired(tTimerClient aClient, uint32_t& arTimerId);
+
+        /** @brief Returns the number of timers in use */
+        uint16_t GetActiveCount(void) const { return mActiveCount; }
+        /** @brief Returns the number of periodic expirations merged because the previous one was not taken yet */
+        uint32_t GetOverrunCount(void) const { return mOverrunCount; }
+
+    private:
+        /** @brief Index of no timer in the linked lists */
+        static constexpr uint16_t mcNoTimer = 0xFFFF;
+
+        /* Wheel geometry */
+        static constexpr uint8_t  mcLevelCount      = 4;
+        static constexpr uint8_t  mcLevel0Bits      = 8;
+        static constexpr uint8_t  mcLevelNBits      = 6;
+        static constexpr uint16_t mcLevel0Slots     = 1 << mcLevel0Bits;
+        static constexpr uint16_t mcLevelNSlots     = 1 << mcLevelNBits;
+        static constexpr uint16_t mcSlotCount       = mcLevel0Slots + (mcLevelCount - 1) * mcLevelNSlots;
+        static constexpr uint32_t mcMaxDelayTicks   = (static_cast<uint32_t>(1) <<
+                (mcLevel0Bits + (mcLevelCount - 1) * mcLevelNBits)) - 1;
+
+        /** @brief State of a timer */
+        enum tTimerState : uint8_t
+        {
+            TIMER_FREE = 0x00,
+            /** @brief Linked in a wheel slot */
+            TIMER_ARMED,
+            /** @brief One-shot timer expired, waiting in the expired list */
+            TIMER_FIRED,
+            /** @brief Stopped while waiting in the expired list, freed when taken */
+            TIMER_STOPPED,
+        };
+
+        /** @brief Timer of the pool */
+        struct tTimer
+        {
+            /** @brief Wheel slot list, mNext links the free list for free timers */
+            uint16_t     mNext;
+            uint16_t     mPrev;
+            /** @brief Wheel slot the timer is linked in */
+            uint16_t     mSlot;
+            /** @brief Expired list of the client */
+            uint16_t     mNextExpired;
+            /** @brief Generation, incremented each time the timer is freed */
+            uint16_t     mGeneration;
+            /** @brief Wheel tick of the expiration */
+            uint32_t     mExpiry;
+            /** @brief Period in ticks, 0 for one-shot timers */
+            uint32_t     mPeriod;
+            /** @brief Timer ID passed to the client */
+            uint32_t     mTimerId;
+            tTimerState  mState;
+            tTimerClient mClient;
+            /** @brief Timer is in the expired list of the client */
+            bool         mQueued;
+        };
+
+        /** @brief Client (task) of the timer service */
+        struct tClient
+        {
+            TaskHandle_t mTaskHandle;
+            uint32_t     mNotificationBits;
+            /** @brief Expired list, oldest first */
+            uint16_t     mExpiredHead;
+            uint16_t     mExpiredTail;
+        };
+
+        /** @brief Software timer advancing the wheel */
+        class TickTimer : public FreeRTOScpp::TimerClass
+        {
+        public:
+            TickTimer(TimerService* apService);
+
+        private:
+            TimerService* mpService;
+
+            void timer(void) override;
+        };
+
+        portMUX_TYPE mLock = portMUX_INITIALIZER_UNLOCKED;
+
+        tTimer   mTimers[mTimerCount];
+        uint16_t mFreeHead;
+
+        /** @brief Heads of the wheel slot lists, level 0 slots first, then the upper levels */
+        uint16_t mSlots[mcSlotCount];
+
+        tClient  mClients[mTimerClientCount];
+        uint8_t  mClientCount = 0;
+
+        /** @brief Software timer advancing the wheel, set by Init() */
+        TickTimer* mpTickTimer = nullptr;
+
+        /** @brief Next wheel tick to process */
+        uint32_t   mNextTick = 0;
+        /** @brief Kernel tick count at which the next wheel tick is due */
+        TickType_t mNextKernelTicks = 0;
+
+        /** @brief Wheel tick the software timer is armed for, valid if mIsWakeArmed is set */
+        uint32_t   mWakeTick    = 0;
+        bool       mIsWakeArmed = false;
+
+        uint16_t mActiveCount  = 0;
+        uint32_t mOverrunCount = 0;
+
+        tTimerHandle Start(tTimerClient aClient, uint32_t aTimerId, uint32_t aDelayTicks, uint32_t aPeriodTicks);
+        void Advance(void);
+        void ArmTick(TickType_t aTicksToWait);
+        uint32_t Synchronize(void);
+        bool GetNextEvent(uint32_t& arTick) const;
+        uint32_t GetSlotTick(uint16_t aSlot) const;
+        TickType_t GetKernelTicks(uint32_t aTick) const;
+        void Link(uint16_t aIndex);
+        void Unlink(uint16_t aIndex);
+        uint16_t Cascade(uint8_t aLevel, uint32_t aTick);
+        uint32_t Expire(uint16_t aIndex);
+        void Free(uint16_t aIndex);
+        uint16_t GetSlot(uint32_t aExpiry) const;
+        uint32_t MsToTicks(uint32_t aMs) const;
+    };
+
+}   /* end of namespace TimerServiceNS */
+
+/* Declare the object as extern for global access  */
+extern TimerServiceNS::TimerService TimerService;
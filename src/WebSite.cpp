@@ -7,7 +7,11 @@
 #include <ESPUI.h>
 
 #include "Logger.h"
+#include "BufferPool.h"
+#include "ClockSnapshot.h"
 #include "DateTime.h"
+#include "MessagePayload.h"
+#include "SchedulingBenchmark.h"
 #include "Settings.hpp"
 
 #include "WebSite.h"
@@ -66,6 +70,10 @@ void WebSite::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     mWebUIControlID.mDisplayClockSingleMinutes = AddSwitcherControl("Show single minutes",
             ConfigNS::mKeyDisplayClockSingleMins, ConfigNS::mDefaultDisplayClockSingleMins);
 
+    /* Transition between two times */
+    mWebUIControlID.mDisplayTransition = AddSelectControl("Transition", ConfigNS::mcTransitionItems, ConfigNS::mcTransitionItemsCount,
+            ConfigNS::mKeyDisplayTransition, ConfigNS::mDefaultDisplayTransition);
+
     /* Section LED settings */
     ESPUI.addControl(Control::Type::Separator, "LED colors", "", Control::Color::Alizarin, Control::noParent);
 
@@ -120,6 +128,26 @@ void WebSite::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     mWebUIControlID.mWifiConnectButton = AddButtonControl("Connect to selected network");
     mWebUIControlID.mWifiScanButton = AddButtonControl("Scan WiFi networks");
 
+    /* Section status */
+    ESPUI.addControl(Control::Type::Separator, "Status", "", Control::Color::Alizarin, Control::noParent);
+
+    mWebUIControlID.mStatusClock = AddLabelControl("Clock");
+    mWebUIControlID.mStatusWifi = AddLabelControl("WiFi");
+    mWebUIControlID.mStatusNtpLastSync = AddLabelControl("Last NTP sync");
+    mWebUIControlID.mStatusMinuteLatency = AddLabelControl("Minute change latency");
+
+#if (USE_HANDLER_PROFILER == true)
+    /* Section handler profiler, one label per profiled task */
+    ESPUI.addControl(Control::Type::Separator, "Handler profiler", "", Control::Color::Alizarin, Control::noParent);
+
+    for (HandlerProfilerNS::tProfilerTask wTask = 0; wTask < HandlerProfiler.GetTaskCount(); wTask++)
+    {
+        HandlerProfilerNS::tTaskSummary wSummary;
+        HandlerProfiler.GetTaskSummary(wTask, wSummary);
+        mWebUIControlID.mProfilerTasks[wTask] = AddLabelControl(wSummary.mpName);
+    }
+#endif /* (USE_HANDLER_PROFILER == true) */
+
     
     /* Update LED brightness controls */
     UpdateLedBrightnessControls();
@@ -139,6 +167,8 @@ void WebSite::ProcessIncomingMessage(const MessageNS::Message &arMessage)
             ESPUI.captivePortal = false;
             /* Start WEB UI */
             ESPUI.begin("Wordclock");
+            /* Query status */
+            RequestStatus();
             break;
 
         case MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STARTED:
@@ -149,35 +179,44 @@ void WebSite::ProcessIncomingMessage(const MessageNS::Message &arMessage)
             ESPUI.captivePortal = true;
             /* Start WEB UI */
             ESPUI.begin("Wordclock");
+            /* Query status */
+            RequestStatus();
             break;
 
-        case MessageNS::tMessageId::MSG_EVENT_SETTINGS_CHANGED:
-        {
-            /* Check if message sent by this task */
-            if (arMessage.mSource == MessageNS::tAddress::WEB_MANAGER)
-            {
-                /* Update LED brightness controls */
-                UpdateLedBrightnessControls();
-
-                /* Redirect this message to display manager */
-                MessageNS::Message wMessage = arMessage;
+        case MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED:
+            /* Refresh status every minute */
+            RequestStatus();
+            UpdateProfilerControls();
+            break;
 
-                /* Send message to display */
-                wMessage.mDestination = MessageNS::tAddress::DISPLAY_MANAGER;
-                SendMessage(wMessage);
+        case MessageNS::tMessageId::MSG_EVENT_WIFI_SCAN_DONE:
+        {
+            /* WiFi scan finished, take the scan results from the message buffer */
+            BufferPoolNS::tBufferHandle wBuffer = BufferPoolNS::GetBuffer(arMessage);
+            const ConfigNS::tSSIDEntry* wpEntries =
+                    reinterpret_cast<const ConfigNS::tSSIDEntry*>(BufferPool.GetData(wBuffer));
+            size_t wEntriesCount = BufferPool.GetLength(wBuffer) / sizeof(ConfigNS::tSSIDEntry);
 
-                /* Send message to time manager */
-                wMessage.mDestination = MessageNS::tAddress::TIME_MANAGER;
-                SendMessage(wMessage);
+            mLocalSsidList.assign(wpEntries, wpEntries + wEntriesCount);
 
-                break;
-            }
+            /* Update WiFi settings */
+            UpdateWiFiSettingsControls();
         }
             break;
 
-        case MessageNS::tMessageId::MSG_EVENT_WIFI_SCAN_DONE:
-            /* WiFi scan finished, update WiFi settings */
-            UpdateWiFiSettingsControls();
+        default:
+            // do nothing
+            break;
+    }
+}
+
+void WebSite::ProcessFastEvent(MessageNS::tFastEvent aEvent)
+{
+    switch (aEvent)
+    {
+        case MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED:
+            /* Update LED brightness controls */
+            UpdateLedBrightnessControls();
             break;
 
         default:
@@ -188,8 +227,6 @@ void WebSite::ProcessIncomingMessage(const MessageNS::Message &arMessage)
 
 void WebSite::HandleControl(Control* apControl, int aType)
 {
-    MessageNS::Message wMessage;
-
     if (apControl->GetId() == mWebUIControlID.mDisplayClockMode)
     {
         /* Clock mode changed */
@@ -205,6 +242,11 @@ void WebSite::HandleControl(Control* apControl, int aType)
         /* Single minutes switcher changed */
         HandleSwitcherControl(apControl, aType, ConfigNS::mKeyDisplayClockSingleMins);
     }
+    else if (apControl->GetId() == mWebUIControlID.mDisplayTransition)
+    {
+        /* Transition changed */
+        HandleSelectControl(apControl, aType, ConfigNS::mKeyDisplayTransition);
+    }
     else if (apControl->GetId() == mWebUIControlID.mDisplayColorTime)
     {
         /* Time color changed */
@@ -317,11 +359,8 @@ void WebSite::HandleControl(Control* apControl, int aType)
             Settings.SetValue<String>(ConfigNS::mKeyWifiPassword, wPassw.c_str());
 
             /* Send message to WiFi manager to connect */
-            wMessage.mSource = MessageNS::tAddress::WEB_MANAGER;
-            wMessage.mDestination = MessageNS::tAddress::WIFI_MANAGER;
-            wMessage.mId = MessageNS::tMessageId::CMD_WIFI_CONNECT;
-            
-            SendMessage(wMessage);
+            SendMessage(MessageNS::MakeMessage<MessageNS::tMessageId::CMD_WIFI_CONNECT>(
+                    MessageNS::tAddress::WEB_MANAGER, MessageNS::tAddress::WIFI_MANAGER));
         }
 
         return;
@@ -339,11 +378,8 @@ void WebSite::HandleControl(Control* apControl, int aType)
             ESPUI.jsonReload();
 
             /* Send message to WiFi manager to start scan */
-            wMessage.mSource = MessageNS::tAddress::WEB_MANAGER;
-            wMessage.mDestination = MessageNS::tAddress::WIFI_MANAGER;
-            wMessage.mId = MessageNS::tMessageId::CMD_WIFI_START_SCAN;
-            
-            SendMessage(wMessage);
+            SendMessage(MessageNS::MakeMessage<MessageNS::tMessageId::CMD_WIFI_START_SCAN>(
+                    MessageNS::tAddress::WEB_MANAGER, MessageNS::tAddress::WIFI_MANAGER));
         }
 
         return;
@@ -354,14 +390,8 @@ void WebSite::HandleControl(Control* apControl, int aType)
         return;
     }
 
-    /* Create message */
-    wMessage.mSource = MessageNS::tAddress::WEB_MANAGER;
-    wMessage.mDestination = MessageNS::tAddress::WEB_MANAGER;
-
-    wMessage.mId = MessageNS::tMessageId::MSG_EVENT_SETTINGS_CHANGED;
-
-    /* Send message */
-    SendMessage(wMessage);
+    /* Signal all subscribers */
+    PublishFastEvent(MessageNS::tFastEvent::FAST_EVENT_SETTINGS_CHANGED);
 }
 
 Control::ControlId_t WebSite::AddColorControl(const char* apTitle, SettingsNS::tKey aSettingsKey, const uint32_t aDefaultColor)
@@ -469,6 +499,15 @@ Control::ControlId_t WebSite::AddButtonControl(const char* apTitle)
     return wControlId;
 }
 
+Control::ControlId_t WebSite::AddLabelControl(const char* apTitle)
+{
+    Control::ControlId_t wControlId = ESPUI.label(apTitle, Control::Color::Dark, "-");
+
+    LOG(LOG_DEBUG, "WebSite::AddLabelControl() Control %04X", wControlId);
+
+    return wControlId;
+}
+
 void WebSite::UpdateLedBrightnessControls(bool aForceUpdate)
 {
     bool wUseNightMode = Settings.GetValue<bool>(ConfigNS::mKeyDisplayUseNightMode, ConfigNS::mDefaultDisplayUseNightMode);
@@ -501,9 +540,6 @@ void WebSite::UpdateLedBrightnessControls(bool aForceUpdate)
 
 void WebSite::UpdateWiFiSettingsControls(bool aForceUpdate)
 {
-    /* Snapshot to avoid race condition with WiFi event handler (different task context) */    
-    mLocalSsidList = ConfigNS::mSSSIDList;
-
     LOG(LOG_DEBUG, "WebSite::UpdateWiFiSettingsControls() Force update %d", aForceUpdate);
 
     /* Remove all existing options from the select control */
@@ -669,10 +705,155 @@ void WebSite::HandleTimerControl(Control* aControl, int aType, SettingsNS::tKey
     Settings.SetValue<uint32_t>(aSettingsKey, wTimeDword);
 }
 
+/**
+ * @brief Queries the WiFi, NTP and clock status and updates the status labels with the responses.
+ */
+void WebSite::RequestStatus(void)
+{
+    static constexpr TickType_t wTimeout = pdMS_TO_TICKS(ConfigNS::mRpcDefaultTimeoutMs);
+
+    /* The clock is read from the snapshot of the time manager, no request needed */
+    UpdateClockStatus();
+
+    /* Start of the requests, for the round trip of the scheduling benchmark */
+    uint32_t wStartUs = micros();
+
+    Request(MessageNS::MakeMessage<MessageNS::tMessageId::REQ_WIFI_STATUS>(
+                MessageNS::tAddress::WEB_MANAGER, MessageNS::tAddress::WIFI_MANAGER),
+            MessageNS::ResponseId<MessageNS::tMessageId::REQ_WIFI_STATUS>, wTimeout,
+            [this, wStartUs](ApplicationNS::tRpcStatus aStatus, const MessageNS::Message& arMessage)
+            {
+                static constexpr const char* wcStatusNames[] = { "Not connected", "Connecting", "Online", "Access point" };
+
+                String wText = "Unknown";
+                if (aStatus == ApplicationNS::tRpcStatus::RPC_OK)
+                {
+                    SCHEDULING_BENCHMARK_RECORD(MEASURE_WEB_STATUS, micros() - wStartUs);
+                    MessageNS::tWiFiStatus wStatus = MessageNS::GetPayload<MessageNS::tMessageId::RSP_WIFI_STATUS>(arMessage);
+                    if (wStatus < (sizeof(wcStatusNames) / sizeof(wcStatusNames[0])))
+                    {
+                        wText = wcStatusNames[wStatus];
+                    }
+                }
+                LOG(LOG_DEBUG, "WebSite::RequestStatus() WiFi status: %s", wText.c_str());
+                ESPUI.updateLabel(mWebUIControlID.mStatusWifi, wText);
+            });
+
+    Request(MessageNS::MakeMessage<MessageNS::tMessageId::REQ_NTP_LAST_SYNC>(
+                MessageNS::tAddress::WEB_MANAGER, MessageNS::tAddress::TIME_MANAGER),
+            MessageNS::ResponseId<MessageNS::tMessageId::REQ_NTP_LAST_SYNC>, wTimeout,
+            [this, wStartUs](ApplicationNS::tRpcStatus aStatus, const MessageNS::Message& arMessage)
+            {
+                String wText = "Unknown";
+                if (aStatus == ApplicationNS::tRpcStatus::RPC_OK)
+                {
+                    SCHEDULING_BENCHMARK_RECORD(MEASURE_WEB_STATUS, micros() - wStartUs);
+                    time_t wLastSync = MessageNS::GetPayload<MessageNS::tMessageId::RSP_NTP_LAST_SYNC>(arMessage);
+                    if (wLastSync == 0)
+                    {
+                        wText = "Never";
+                    }
+                    else
+                    {
+                        char wBuffer[24];
+                        struct tm wTime;
+                        strftime(wBuffer, sizeof(wBuffer), "%d.%m.%Y %H:%M:%S", localtime_r(&wLastSync, &wTime));
+                        wText = wBuffer;
+                    }
+                }
+                LOG(LOG_DEBUG, "WebSite::RequestStatus() Last NTP sync: %s", wText.c_str());
+                ESPUI.updateLabel(mWebUIControlID.mStatusNtpLastSync, wText);
+            });
+
+    Request(MessageNS::MakeMessage<MessageNS::tMessageId::REQ_MINUTE_LATENCY>(
+                MessageNS::tAddress::WEB_MANAGER, MessageNS::tAddress::TIME_MANAGER),
+            MessageNS::ResponseId<MessageNS::tMessageId::REQ_MINUTE_LATENCY>, wTimeout,
+            [this, wStartUs](ApplicationNS::tRpcStatus aStatus, const MessageNS::Message& arMessage)
+            {
+                String wText = "Unknown";
+                if (aStatus == ApplicationNS::tRpcStatus::RPC_OK)
+                {
+                    SCHEDULING_BENCHMARK_RECORD(MEASURE_WEB_STATUS, micros() - wStartUs);
+                    MessageNS::tMinuteLatency wLatency = MessageNS::GetPayload<MessageNS::tMessageId::RSP_MINUTE_LATENCY>(arMessage);
+                    wText = String(wLatency.mLastMs) + " ms (max " + String(wLatency.mMaxMs) + " ms)";
+                }
+                LOG(LOG_DEBUG, "WebSite::RequestStatus() Minute change latency: %s", wText.c_str());
+                ESPUI.updateLabel(mWebUIControlID.mStatusMinuteLatency, wText);
+            });
+}
+
+/**
+ * @brief Updates the clock status label with the last published state of the ClockSnapshot.
+ */
+void WebSite::UpdateClockStatus(void)
+{
+    static constexpr const char* wcSyncQualityNames[] = { "not synchronized", "sync stale", "synchronized" };
+
+    ClockSnapshotNS::tClockState wState = ClockSnapshot.Read();
+    uint16_t wOffset = abs(wState.mUtcOffsetMinutes);
+
+    char wBuffer[64];
+    snprintf(wBuffer, sizeof(wBuffer), "%02u:%02u %02u.%02u.%04u UTC%c%02u:%02u%s, %s",
+            wState.mLocalTime.mTime.mHour, wState.mLocalTime.mTime.mMinute,
+            wState.mLocalTime.mDate.mDay, wState.mLocalTime.mDate.mMonth, wState.mLocalTime.mDate.mYear,
+            (wState.mUtcOffsetMinutes < 0) ? '-' : '+', wOffset / 60, wOffset % 60,
+            wState.mDst ? " DST" : "",
+            (wState.mSyncQuality < (sizeof(wcSyncQualityNames) / sizeof(wcSyncQualityNames[0])))
+                    ? wcSyncQualityNames[wState.mSyncQuality] : "unknown");
+
+    LOG(LOG_DEBUG, "WebSite::UpdateClockStatus() Clock: %s", wBuffer);
+    ESPUI.updateLabel(mWebUIControlID.mStatusClock, wBuffer);
+}
+
+/**
+ * @brief Updates the handler profiler labels with the summaries of the profiled tasks.
+ */
+void WebSite::UpdateProfilerControls(void)
+{
+#if (USE_HANDLER_PROFILER == true)
+    for (HandlerProfilerNS::tProfilerTask wTask = 0; wTask < HandlerProfiler.GetTaskCount(); wTask++)
+    {
+        HandlerProfilerNS::tTaskSummary wSummary;
+        HandlerProfiler.GetTaskSummary(wTask, wSummary);
+
+        /* Handler with the longest execution time */
+        char wHandler[16];
+        if (wSummary.mMaxHandler == HandlerProfilerNS::mHandlerTimer)
+        {
+            snprintf(wHandler, sizeof(wHandler), "timer");
+        }
+        else if (wSummary.mMaxHandler == HandlerProfilerNS::mHandlerNotification)
+        {
+            snprintf(wHandler, sizeof(wHandler), "notification");
+        }
+        else if (wSummary.mMaxHandler == HandlerProfilerNS::mHandlerFastEvent)
+        {
+            snprintf(wHandler, sizeof(wHandler), "fast event");
+        }
+        else
+        {
+            snprintf(wHandler, sizeof(wHandler), "message %u", wSummary.mMaxHandler);
+        }
+
+        char wBuffer[80];
+        snprintf(wBuffer, sizeof(wBuffer), "CPU %u.%02u %%, %lu calls, max %lu us (%s)",
+                wSummary.mCpuShare / 100, wSummary.mCpuShare % 100,
+                static_cast<unsigned long>(wSummary.mCount), static_cast<unsigned long>(wSummary.mMaxUs), wHandler);
+        ESPUI.updateLabel(mWebUIControlID.mProfilerTasks[wTask], wBuffer);
+    }
+#endif /* (USE_HANDLER_PROFILER == true) */
+}
+
 void WebSite::ControlCallback(Control* apSender, int aType)
 {
     if (mpWebSiteInstance)
     {
+#if (USE_SCHEDULING_BENCHMARK == true)
+        uint32_t wStartUs = micros();
+        mpWebSiteInstance->HandleControl(apSender, aType);
+        SCHEDULING_BENCHMARK_RECORD(MEASURE_WEB_CONTROL, micros() - wStartUs);
+#else
         mpWebSiteInstance->HandleControl(apSender, aType);
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
     }
 }
@@ -30,6 +30,7 @@ private:
         Control::ControlId_t mDisplayClockMode;
         Control::ControlId_t mDisplayClockItIs;
         Control::ControlId_t mDisplayClockSingleMinutes;
+        Control::ControlId_t mDisplayTransition;
         Control::ControlId_t mDisplayColorTime;
         Control::ControlId_t mDisplayColorBackground;
 
@@ -52,6 +53,12 @@ private:
         Control::ControlId_t mWifiScanButton;
         Control::ControlId_t mWifiConnectButton;
 
+        Control::ControlId_t mStatusClock;
+        Control::ControlId_t mStatusWifi;
+        Control::ControlId_t mStatusNtpLastSync;
+        Control::ControlId_t mStatusMinuteLatency;
+
+        Control::ControlId_t mProfilerTasks[HandlerProfilerNS::mProfilerTaskCount];
     };
 
     /** @brief "This" pointer for created WebSite instance */
@@ -64,6 +71,8 @@ private:
 
     /* ApplicationNS::Task::ProcessIncomingMessage() */
     void ProcessIncomingMessage(const MessageNS::Message &arMessage) override;
+    /* ApplicationNS::Task::ProcessFastEvent() */
+    void ProcessFastEvent(MessageNS::tFastEvent aEvent) override;
 
     void HandleControl(Control* apControl, int aType);
 
@@ -82,11 +91,17 @@ private:
     Control::ControlId_t AddTimeControl(const char* apTitle, SettingsNS::tKey aSettingsKey, const uint32_t aDefaultTime = 0);
     Control::ControlId_t AddPasswordControl(const char* apTitle);
     Control::ControlId_t AddButtonControl(const char* apTitle);
+    Control::ControlId_t AddLabelControl(const char* apTitle);
 
     void UpdateLedBrightnessControls(bool aForceUpdate = false);
 
     void UpdateWiFiSettingsControls(bool aForceUpdate = false);
 
+    void RequestStatus(void);
+    void UpdateClockStatus(void);
+
+    void UpdateProfilerControls(void);
+
     static void ControlCallback(Control* apSender, int aType);
 
 };
@@ -31,8 +31,9 @@
 #include <esp_wifi.h>
 
 #include "Logger.h"
+#include "BufferPool.h"
 #include "Configuration.h"
-#include "Serialize.h"
+#include "MessagePayload.h"
 
 #include "WiFiManager.h"
 
@@ -58,15 +59,8 @@ WiFiManager::WiFiManager(char const* apName, ApplicationNS::tTaskPriority aPrior
  */
 WiFiManager::~WiFiManager()
 {
-    /* Clean up task timer */
-    if (mpTimer)
-    {
-        /* Stop running timer */
-        mpTimer->stop();
-        /*    and destroy it */
-        delete mpTimer;
-        mpTimer = nullptr;
-    }
+    /* Stop task timer */
+    StopTimer(mTimer);
 }
 
 void WiFiManager::Init(ApplicationNS::tTaskObjects* apTaskObjects)
@@ -74,13 +68,6 @@ void WiFiManager::Init(ApplicationNS::tTaskObjects* apTaskObjects)
     /* Initialize base class */
     ApplicationNS::Task::Init(apTaskObjects);
 
-    /* Create periodical timer */
-    mTimerObjects.mTaskHandle = this->getTaskHandle();
-    mTimerObjects.mpTaskMessagesQueue = this->mpTaskObjects->mpMessageQueue;
-
-    mpTimer = new ApplicationNS::TaskTimer(mPeriodicalTaskTimerId, 10000, true); // Period 10 seconds
-    mpTimer->Init(&mTimerObjects);
-
     /* Register WiFi events listener */
     WiFi.onEvent(
         std::bind(&WiFiManager::HandleWifiEvent, this, std::placeholders::_1));
@@ -92,8 +79,8 @@ void WiFiManager::task(void)
 {
     LOG(LOG_VERBOSE, "WiFiManager::task()");
 
-    /* Start notification timer for this task */
-    mpTimer->start();
+    /* Start periodical timer for this task */
+    mTimer = StartTimer(mPeriodicalTaskTimerId, 10000);
 
     /* Execute base class task */
     ApplicationNS::Task::task();
@@ -118,13 +105,9 @@ void WiFiManager::ProcessIncomingMessage(const MessageNS::Message &arMessage)
     {
         case MessageNS::tMessageId::MGS_EVENT_WIFI_EVENT_TRIGGERED:
         {
-            /* Deserialize wifi event */
-            uint8_t wEvent;
-            if (SerializeNS::DeserializeData(arMessage.mPayload, &wEvent) == sizeof(wEvent))
-            {
-                /* Process WiFi event */
-                ProcessState(static_cast<WiFiEvent_t>(wEvent));
-            }
+            /* Process WiFi event */
+            ProcessState(static_cast<WiFiEvent_t>(
+                    MessageNS::GetPayload<MessageNS::tMessageId::MGS_EVENT_WIFI_EVENT_TRIGGERED>(arMessage)));
         }
             break;
 
@@ -144,6 +127,11 @@ void WiFiManager::ProcessIncomingMessage(const MessageNS::Message &arMessage)
         }
             break;
 
+        case MessageNS::tMessageId::REQ_WIFI_STATUS:
+            /* Answer the status request */
+            SendMessage(MessageNS::MakeResponse<MessageNS::tMessageId::REQ_WIFI_STATUS>(arMessage, GetStatus()));
+            break;
+
         default:
             // do nothing
             break;
@@ -191,11 +179,9 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
     switch (mState)
     {
         case STATE_IDLE:
-            /* Try connect to wifi router or start access point */
-            if (ConnectWifi() == false)
-            {
-                ConnectAP();
-            }
+            /* Try connect to wifi router or start access point, the sequence continues in the background */
+            mConnectionStart = millis();
+            StartCoroutine(mConnectCoroutine);
 
             /* Move to next state */
             mState = STATE_CONNECTING;
@@ -211,7 +197,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                     /* Move to the next state*/
                     mState  = STATE_STA_CONNECTED;
                     /* Notify */
-                    SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED);
+                    PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED>();
                     break;
 
                 case ARDUINO_EVENT_WIFI_AP_START:
@@ -227,7 +213,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                     /* Move to the next state*/
                     mState  = STATE_AP_STARTED;
                     /* Notify */
-                    SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STARTED);
+                    PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STARTED>();
                     break;
                 
                 default:
@@ -248,7 +234,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                         mState  = STATE_RECONNECTING;
 
                         /* Notify */
-                        SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_STA_DISCONNECTED);
+                        PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_STA_DISCONNECTED>();
                     }
                     break;
             };
@@ -266,7 +252,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                     {
                         LOG(LOG_DEBUG, "WiFiManager::ProcessState() We are online");
                         /* Notify */
-                        SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_INTERNET_AVAILABLE);
+                        PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_INTERNET_AVAILABLE>();
                     }
                     else
                     {
@@ -281,7 +267,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                     /* Move to the next state */
                     mState  = STATE_RECONNECTING;
                     /* Notify */
-                    SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_STA_DISCONNECTED);
+                    PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_STA_DISCONNECTED>();
                     break;
 
                 default:
@@ -302,7 +288,7 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
                         /* Move to the next state */
                         mState = STATE_IDLE;
                         /* Notify */
-                        SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STOPPED);
+                        PublishEvent<MessageNS::tMessageId::MSG_EVENT_WIFI_AP_STOPPED>();
                     }
                     break;
 
@@ -317,10 +303,46 @@ void WiFiManager::ProcessState(const WiFiEvent_t aEvent)
     }
 }
 
+/**
+ * @brief Returns the connection status derived from the state machine state.
+ */
+MessageNS::tWiFiStatus WiFiManager::GetStatus(void) const
+{
+    switch (mState)
+    {
+        case STATE_CONNECTING:
+        case STATE_RECONNECTING:
+            return MessageNS::tWiFiStatus::WIFI_STATUS_CONNECTING;
+
+        case STATE_STA_CONNECTED:
+            return MessageNS::tWiFiStatus::WIFI_STATUS_ONLINE;
+
+        case STATE_AP_STARTED:
+            return MessageNS::tWiFiStatus::WIFI_STATUS_AP_MODE;
+
+        default:
+            return MessageNS::tWiFiStatus::WIFI_STATUS_NOT_CONNECTED;
+    }
+}
+
 void WiFiManager::HandleWiFiScanFinished(void)
 {
+    /* Maximal number of scan results fitting in a pool buffer */
+    static constexpr size_t wMaxEntries = BufferPoolNS::mBufferBlockSize / sizeof(ConfigNS::tSSIDEntry);
+
+    /* Allocate buffer for the scan results */
+    BufferPoolNS::tBufferHandle wBuffer = BufferPool.Allocate(0);
+    if (wBuffer == BufferPoolNS::mInvalidBufferHandle)
+    {
+        LOG(LOG_ERROR, "WiFiManager::HandleWiFiScanFinished() No buffer available for scan results");
+        return;
+    }
+
+    ConfigNS::tSSIDEntry* wpEntries = reinterpret_cast<ConfigNS::tSSIDEntry*>(BufferPool.GetData(wBuffer));
+    size_t wEntriesCount = 0;
+
     /* Save scan results */
-    for (int wI = 0; wI < WiFi.scanComplete(); wI++)
+    for (int wI = 0; (wI < WiFi.scanComplete()) && (wEntriesCount < wMaxEntries); wI++)
     {
         ConfigNS::tSSIDEntry wEntry;
 
@@ -332,9 +354,9 @@ void WiFiManager::HandleWiFiScanFinished(void)
 
         // Search for duplicates in the list
         bool wDuplicateFound = false;
-        for (const auto& existingEntry : ConfigNS::mSSSIDList)
+        for (size_t wJ = 0; wJ < wEntriesCount; wJ++)
         {
-            if (strcmp(existingEntry.mSsid, wEntry.mSsid) == 0)
+            if (strcmp(wpEntries[wJ].mSsid, wEntry.mSsid) == 0)
             {
                 wDuplicateFound = true;
                 break;
@@ -344,41 +366,39 @@ void WiFiManager::HandleWiFiScanFinished(void)
         if (!wDuplicateFound)
         {
             // Add entry to the list
-            ConfigNS::mSSSIDList.push_back(wEntry);
+            wpEntries[wEntriesCount++] = wEntry;
         }
     }
 
+    /* Set length of the scan results */
+    BufferPool.SetLength(wBuffer, static_cast<uint16_t>(wEntriesCount * sizeof(ConfigNS::tSSIDEntry)));
+
     /* LOG */
-    LOG(LOG_DEBUG, "WiFiManager::HandleWiFiScanFinished() WiFi scan done, found %d networks", ConfigNS::mSSSIDList.size());
+    LOG(LOG_DEBUG, "WiFiManager::HandleWiFiScanFinished() WiFi scan done, found %d networks", wEntriesCount);
 
 #if (LOG_LEVEL == LOG_VERBOSE)  // don't compile this code each time
     /* Log all found network */
-    for (const auto& entry : ConfigNS::mSSSIDList)
+    for (size_t wJ = 0; wJ < wEntriesCount; wJ++)
     {
         LOG(LOG_VERBOSE, "WiFiManager::HandleWiFiScanFinished()     %s, RSSI: %d dBm, Encryption: %s",
-                entry.mSsid, entry.mRssi, entry.mEncrypted ? "Encrypted" : "Open");
+                wpEntries[wJ].mSsid, wpEntries[wJ].mRssi, wpEntries[wJ].mEncrypted ? "Encrypted" : "Open");
     }
 #endif /* (LOG_LEVEL == LOG_VERBOSE) */
 
-    SendMessage(MessageNS::tMessageId::MSG_EVENT_WIFI_SCAN_DONE);
+    /* Publish scan results */
+    PublishMessage(MessageNS::MakeMessage<MessageNS::tMessageId::MSG_EVENT_WIFI_SCAN_DONE>(
+            MessageNS::tAddress::WIFI_MANAGER, MessageNS::tAddress::APPLICATION_MANAGER, wBuffer));
+
+    /* Release own reference, the subscribers hold their own */
+    BufferPool.Release(wBuffer);
 }
 
-void WiFiManager::SendMessage(MessageNS::tMessageId wMessageId)
+template<MessageNS::tMessageId Id>
+void WiFiManager::PublishEvent(void)
 {
-    /* Create message */
-    MessageNS::Message wMessage;
-    wMessage.mSource = MessageNS::tAddress::WIFI_MANAGER;
-
-    /* Set selected message ID */
-    wMessage.mId = wMessageId;
-
-    /* Send message to the time manager */
-    wMessage.mDestination = MessageNS::tAddress::TIME_MANAGER;
-    Task::SendMessage(wMessage);
-
-    /* Send message to the web manager */
-    wMessage.mDestination = MessageNS::tAddress::WEB_MANAGER;
-    Task::SendMessage(wMessage);
+    /* Publish message without payload to all subscribers */
+    PublishMessage(MessageNS::MakeMessage<Id>(
+            MessageNS::tAddress::WIFI_MANAGER, MessageNS::tAddress::APPLICATION_MANAGER));
 }
 
 /**
@@ -409,16 +429,16 @@ bool WiFiManager::IsInternetAvailable(void)
 }
 
 /**
- * @brief Connect to a WiFi network using stored credentials or SDK configuration
- * 
- * @details This function attempts to connect to a WiFi network using either stored credentials (if USE_CREDENTIALS is defined)
- *          or the SDK configuration. It handles the necessary WiFi mode settings and connection initiation.
- * 
- * @return true if the connection attempt was initiated successfully, false otherwise
+ * @brief Connection sequence, connects to a WiFi network or starts an access point without credentials
+ *
+ * @details The WiFi driver needs some time after a disconnect and after a mode change. The sequence
+ *          is a coroutine, so the task keeps processing messages while it waits.
+ *
+ * @param arCoroutine Coroutine of the sequence, mConnectCoroutine
  */
-bool WiFiManager::ConnectWifi(void)
+void WiFiManager::Connect(ApplicationNS::Coroutine& arCoroutine)
 {
-    bool wRetValue = false;
+    COROUTINE_BEGIN(arCoroutine);
 
     /* Disconnect from the network (close AP) */
     WiFi.softAPdisconnect(true);
@@ -426,22 +446,71 @@ bool WiFiManager::ConnectWifi(void)
     WiFi.disconnect(true);
 
     /* Wait a moment */
-    delay(100);
+    COROUTINE_DELAY(arCoroutine, mWifiSettleTime);
 
-    /* FIX problem:
-     *    unable to connect to the router
-     *    if previous connection failed
-     *    (the bugfix seems to work)
-     */
-    /* Disable persistent for ESP32 */
-    WiFi.persistent(false);
+    if (HasWifiCredentials())
+    {
+        /* FIX problem:
+         *    unable to connect to the router
+         *    if previous connection failed
+         *    (the bugfix seems to work)
+         */
+        /* Disable persistent for ESP32 */
+        WiFi.persistent(false);
 
-    /* Start WiFi Station mode */
-    WiFi.mode(WIFI_STA);
+        /* Start WiFi Station mode */
+        WiFi.mode(WIFI_STA);
 
-    /* Wait a moment */
-    delay(100);
+        /* Wait a moment */
+        COROUTINE_DELAY(arCoroutine, mWifiSettleTime);
+
+        /* Start Wifi connection */
+        ConnectWifi();
+    }
+    else
+    {
+        /* Set WiFi soft-AP mode */
+        LOG(LOG_DEBUG, "WiFiManager::Connect() Start AP/STA mode");
+        WiFi.mode(WIFI_AP_STA);
+
+        /* Wait a moment */
+        COROUTINE_DELAY(arCoroutine, mWifiSettleTime);
+
+        /* Start WiFi AP connection */
+        ConnectAP();
+    }
+
+    COROUTINE_END(arCoroutine);
+}
+
+/**
+ * @brief Check if credentials of a WiFi network are available
+ *
+ * @return true if the credentials are defined (USE_CREDENTIALS) or a SSID is stored in the settings
+ */
+bool WiFiManager::HasWifiCredentials(void)
+{
+#ifdef USE_CREDENTIALS
+    return true;
+#else
+    if (Settings.GetValue<String>(ConfigNS::mKeyWifiSSID, "").length() > 0)
+    {
+        return true;
+    }
+
+    LOG(LOG_ERROR, "WiFiManager::HasWifiCredentials() Failed to get WiFi SSID from settings");
+    return false;
+#endif /* ifdef USE_CREDENTIALS */
+}
 
+/**
+ * @brief Connect to a WiFi network using stored credentials or SDK configuration
+ * 
+ * @details This function starts the connection to a WiFi network using either stored credentials (if USE_CREDENTIALS
+ *          is defined) or the SDK configuration. The WiFi Station mode is already set by Connect().
+ */
+void WiFiManager::ConnectWifi(void)
+{
     /* Set connection start time */
     mConnectionStart = millis();
 
@@ -450,51 +519,24 @@ bool WiFiManager::ConnectWifi(void)
     LOG(LOG_DEBUG, "WiFiManager::ConnectWifi() Start WiFi Station mode, credentials SSID: %s", CRED_WIFI_SSID);
     /* Start Wifi connection */
     WiFi.begin(CRED_WIFI_SSID, CRED_WIFI_PASS);
-
-    wRetValue = true;
 #else
 
     /* Get SSID and password from settings */
     String wSsid  = Settings.GetValue<String>(ConfigNS::mKeyWifiSSID, "");
     String wPassw = Settings.GetValue<String>(ConfigNS::mKeyWifiPassword, "");
 
-    /* Check if SSID is valid */
-    if (wSsid.length() > 0)
-    {
-        /* LOG */
-        LOG(LOG_DEBUG, "WiFiManager::ConnectWifi() Start WiFi Station mode, SSID: %s", wSsid.c_str());
-        /* Start Wifi connection */
-        WiFi.begin(wSsid.c_str(), wPassw.c_str());
-        
-        wRetValue = true;
-    }
-    else
-    {
-        LOG(LOG_ERROR, "WiFiManager::ConnectWifi() Failed to get WiFi SSID from settings");
-    }
+    /* LOG */
+    LOG(LOG_DEBUG, "WiFiManager::ConnectWifi() Start WiFi Station mode, SSID: %s", wSsid.c_str());
+    /* Start Wifi connection */
+    WiFi.begin(wSsid.c_str(), wPassw.c_str());
 #endif /* ifdef USE_CREDENTIALS */
-
-    return wRetValue;
 }
 
 /**
- * @brief Set the ESP32 as an access point
+ * @brief Set the ESP32 as an access point, the WiFi soft-AP mode is already set by Connect()
  */
 void WiFiManager::ConnectAP(void)
 {
-    /* Disconnect from the network (close AP) */
-    WiFi.softAPdisconnect(true);
-    /* Disconnect from the network */
-    WiFi.disconnect(true);
-    /* Wait a moment */
-    delay(100);
-
-    /* Set WiFi soft-AP mode */
-    LOG(LOG_DEBUG, "WifiMangerClass::ConnectAP() Start AP/STA mode");
-    WiFi.mode(WIFI_AP_STA);
-    /* Wait a moment */
-    delay(100);
-
     /* Start WiFi AP connection */
     if (WiFi.softAP(ConfigNS::mWiFiApSSID, ConfigNS::mWiFiApPASS) == true)
     {
@@ -541,24 +583,10 @@ void WiFiManager::HandleWifiEvent(WiFiEvent_t aEvent)
 
     if (wNotifyTask)
     {
-        /* Create message */
-        MessageNS::Message wMessage;
-        wMessage.mSource = MessageNS::tAddress::WIFI_MANAGER;
-        wMessage.mDestination = MessageNS::tAddress::WIFI_MANAGER;
-
-        wMessage.mId = MessageNS::tMessageId::MGS_EVENT_WIFI_EVENT_TRIGGERED;
-
-        /* Serialize wifi event in message payload */
-        if (SerializeNS::SerializeData(static_cast<uint8_t>(aEvent), wMessage.mPayload) == sizeof(uint8_t))
-        {
-            /* Set payload length */
-            wMessage.mPayloadLength = sizeof(uint8_t);
-            /* Send message */
-            mpTaskObjects->mpCommunicationManager->SendMessage(wMessage);
-        }
-        else
-        {
-            //TODO handle serialization error
-        }
+        /* Send wifi event to own task */
+        mpTaskObjects->mpCommunicationManager->SendMessage(
+                MessageNS::MakeMessage<MessageNS::tMessageId::MGS_EVENT_WIFI_EVENT_TRIGGERED>(
+                        MessageNS::tAddress::WIFI_MANAGER, MessageNS::tAddress::WIFI_MANAGER,
+                        static_cast<uint8_t>(aEvent)));
     }
 }
\ No newline at end of file
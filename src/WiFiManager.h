@@ -15,6 +15,7 @@
 #include <DNSServer.h>
 
 #include "Application.h"
+#include "MessagePayload.h"
 
 
 class WiFiManager : public ApplicationNS::Task
@@ -28,14 +29,6 @@ public:
 
 private:
 
-    typedef enum tStatus
-    {
-        STATUS_NOT_CONNECTED,
-        STATUS_CONNECTING,
-        STATUS_ONLINE,
-        STATUS_AP_MODE,
-    } tStatus;
-
     /** @brief WiFi manager state machine states */
     typedef enum tState
     {
@@ -50,8 +43,7 @@ private:
     } tState;
 
     /* Periodical timer for this task */
-    ApplicationNS::tTaskTimerObjects mTimerObjects;
-    ApplicationNS::TaskTimer* mpTimer;
+    TimerServiceNS::tTimerHandle mTimer = TimerServiceNS::mInvalidTimerHandle;
 
     /** @brief DNS server instance */
     DNSServer mDnsServer;
@@ -66,6 +58,12 @@ private:
     /** @brief Flag to indicate if WiFi scan has been run once */
     bool mWifiScanRunOnce = false;
 
+    /** @brief Settle time of the WiFi driver after a disconnect or a mode change */
+    static constexpr uint32_t mWifiSettleTime = 100U;   // 100 milliseconds
+    /** @brief Connection sequence, station mode or access point */
+    ApplicationNS::Coroutine mConnectCoroutine{
+            [this](ApplicationNS::Coroutine& arCoroutine) { Connect(arCoroutine); }};
+
     /* ApplicationNS::Task::task() */
     void task(void) override;
     /* ApplicationNS::Task::ProcessTimerEvent() */
@@ -76,13 +74,20 @@ private:
 
     void ProcessState(const WiFiEvent_t aEvent = ARDUINO_EVENT_MAX);
 
+    MessageNS::tWiFiStatus GetStatus(void) const;
+
     void HandleWiFiScanFinished(void);
 
-    void SendMessage(MessageNS::tMessageId wMessageId);
+    template<MessageNS::tMessageId Id>
+    void PublishEvent(void);
 
     bool IsInternetAvailable(void);
 
-    bool ConnectWifi(void);
+    void Connect(ApplicationNS::Coroutine& arCoroutine);
+
+    bool HasWifiCredentials(void);
+
+    void ConnectWifi(void);
 
     void ConnectAP(void);
 
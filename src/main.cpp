@@ -2,12 +2,21 @@
 
 #include "Logger.h"
 #include "Settings.hpp"
+#include "BufferPool.h"
+#include "BusRecorder.h"
+#include "BusStatistics.h"
+#include "ClockSnapshot.h"
+#include "HandlerProfiler.h"
+#include "SchedulingBenchmark.h"
+#include "TaskSupervisor.h"
+#include "TimerService.h"
 
 #include "Configuration.h"
 
 #include "Application.h"
 #include "Communication.h"
 #include "Message.h"
+#include "TaskGraph.h"
 
 #include "Display.h"
 #include "TimeManager.h"
@@ -62,6 +71,11 @@ static void MultiResetDetection(void);
 static void CheckResetReason(void);
 static void InitApplication(void);
 static void RunApplication(void);
+#if (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) || \
+    (USE_SCHEDULING_BENCHMARK == true)
+static void ProcessDiagnostics(void);
+#endif /* (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) ||
+          (USE_SCHEDULING_BENCHMARK == true) */
 
 
 /******************************************************************************
@@ -70,28 +84,15 @@ static void RunApplication(void);
 
 static MultiResetDetector* mpMultiResetDetector;
 
-static Display*     mpDisplay;
-static TimeManager* mpTimeManager;
-static WiFiManager* mpWiFiManager;
-static WebSite*     mpWebSite;
+/* Communication manager of the tasks */
+static CommunicationNS::CommunicationManager mCommunicationManager;
 
-static CommunicationNS::CommunicationManager* mpCommunicationManager = nullptr;
-
-static ApplicationNS::MessageQueue*     mpDisplayMessageQueue;
-static ApplicationNS::MessageReceiver*  mpDisplayMessageReceiver;
-static ApplicationNS::tTaskObjects      mDisplayTaskObjects;
-
-static ApplicationNS::MessageQueue*     mpTimeManagerMessageQueue;
-static ApplicationNS::MessageReceiver*  mpTimeManagerMessageReceiver;
-static ApplicationNS::tTaskObjects      mTimeManagerTaskObjects;
-
-static ApplicationNS::MessageQueue*     mpWifiManagerMessageQueue;
-static ApplicationNS::MessageReceiver*  mpWifiManagerMessageReceiver;
-static ApplicationNS::tTaskObjects      mWifiManagerTaskObjects;
-
-static ApplicationNS::MessageQueue*     mpWebSiteMessageQueue;
-static ApplicationNS::MessageReceiver*  mpWebSiteMessageReceiver;
-static ApplicationNS::tTaskObjects      mWebSiteTaskObjects;
+/* Tasks of the application, initialized in this order; the web site uses the registered tasks */
+static ApplicationNS::TaskGraph<
+        ApplicationNS::StaticTask<Display,     ConfigNS::mcDisplayTask>,
+        ApplicationNS::StaticTask<TimeManager, ConfigNS::mcTimeManagerTask>,
+        ApplicationNS::StaticTask<WiFiManager, ConfigNS::mcWifiManagerTask>,
+        ApplicationNS::StaticTask<WebSite,     ConfigNS::mcWebSiteTask>> mTaskGraph;
 
 
 /******************************************************************************
@@ -101,6 +102,38 @@ static ApplicationNS::tTaskObjects      mWebSiteTaskObjects;
 /* Instance of Settings class */
 SettingsNS::Settings Settings;
 
+/* Instance of BufferPool class */
+BufferPoolNS::BufferPool BufferPool;
+
+/* Instance of BusStatistics class */
+BusStatisticsNS::BusStatistics BusStatistics;
+
+/* Instance of TimerService class */
+TimerServiceNS::TimerService TimerService;
+
+/* Instance of ClockSnapshot class */
+ClockSnapshotNS::ClockSnapshot ClockSnapshot;
+
+#if (USE_BUS_RECORDER == true)
+/* Instance of BusRecorder class */
+BusRecorderNS::BusRecorder BusRecorder;
+#endif /* (USE_BUS_RECORDER == true) */
+
+#if (USE_HANDLER_PROFILER == true)
+/* Instance of HandlerProfiler class */
+HandlerProfilerNS::HandlerProfiler HandlerProfiler;
+#endif /* (USE_HANDLER_PROFILER == true) */
+
+#if (USE_SCHEDULING_BENCHMARK == true)
+/* Instance of SchedulingBenchmark class */
+SchedulingBenchmarkNS::SchedulingBenchmark SchedulingBenchmark;
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
+
+#if (USE_TASK_SUPERVISOR == true)
+/* Instance of TaskSupervisor class */
+TaskSupervisorNS::TaskSupervisor TaskSupervisor;
+#endif /* (USE_TASK_SUPERVISOR == true) */
+
 
 /******************************************************************************
     PUBLIC FUNCTION CODE
@@ -129,6 +162,11 @@ void setup()
 
 void loop()
 {
+#if (USE_TASK_SUPERVISOR == true)
+    /* Check the tasks and feed the task watchdog, also during the multi reset detection */
+    TaskSupervisor.Process();
+#endif /* (USE_TASK_SUPERVISOR == true) */
+
     /* Call the multi reset detector loop method every so often, 
        so that it can recognise when the timeout expires. */
     if ((mpMultiResetDetector != nullptr) &&
@@ -141,8 +179,19 @@ void loop()
     }
     else
     {
+#if (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) || \
+    (USE_SCHEDULING_BENCHMARK == true)
+        /* Serve diagnostic outputs, everything else is handled in tasks */
+        ProcessDiagnostics();
+        vTaskDelay(pdMS_TO_TICKS(ConfigNS::mDiagnosticsPollPeriodMs));
+#elif (USE_TASK_SUPERVISOR == true)
+        /* Wait for the next check of the task supervisor, everything else is handled in tasks */
+        vTaskDelay(pdMS_TO_TICKS(ConfigNS::mTaskSupervisorPeriodMs));
+#else
         /* Do nothing, everything is handled in tasks */
         vTaskDelay(portMAX_DELAY);
+#endif /* (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) ||
+          (USE_SCHEDULING_BENCHMARK == true) */
     }
 }
 
@@ -224,96 +273,77 @@ static void CheckResetReason(void)
 
 static void InitApplication(void)
 {
-    /* Create tasks */
-    mpDisplay = new Display(ConfigNS::mDisplayTaskName, ConfigNS::mDisplayTaskPriority,
-            ConfigNS::mDisplayTaskStackSize);
-    mpTimeManager = new TimeManager(ConfigNS::mTimeManagerTaskName, ConfigNS::mTimeManagerTaskPriority,
-            ConfigNS::mTimeManagerTaskStackSize);
-    mpWiFiManager = new WiFiManager(ConfigNS::mWifiManagerTaskName, ConfigNS::mWifiManagerTaskPriority,
-            ConfigNS::mWifiManagerTaskStackSize);
-    mpWebSite = new WebSite(ConfigNS::mWebSiteTaskName, ConfigNS::mWebSiteTaskPriority,
-            ConfigNS::mWebSiteTaskStackSize);
-
-    /* Create communication manager */
-    mpCommunicationManager = new CommunicationNS::CommunicationManager();
-
-    /* Create message queue and receiver for tasks */
-    mpDisplayMessageQueue        = new ApplicationNS::MessageQueue();
-    mpDisplayMessageReceiver     = new ApplicationNS::MessageReceiver();
-
-    mpTimeManagerMessageQueue    = new ApplicationNS::MessageQueue();
-    mpTimeManagerMessageReceiver = new ApplicationNS::MessageReceiver();
-
-    mpWifiManagerMessageQueue    = new ApplicationNS::MessageQueue();
-    mpWifiManagerMessageReceiver = new ApplicationNS::MessageReceiver();
-
-    mpWebSiteMessageQueue        = new ApplicationNS::MessageQueue();
-    mpWebSiteMessageReceiver     = new ApplicationNS::MessageReceiver();
-
-    /* Initialize task objects */
-    mpDisplayMessageReceiver->Init(mpDisplayMessageQueue,
-        mpDisplay->getTaskHandle(), ApplicationNS::mTaskNotificationMsgQueue);
-    mpTimeManagerMessageReceiver->Init(mpTimeManagerMessageQueue,
-        mpTimeManager->getTaskHandle(), ApplicationNS::mTaskNotificationMsgQueue);
-    mpWifiManagerMessageReceiver->Init(mpWifiManagerMessageQueue,
-        mpWiFiManager->getTaskHandle(), ApplicationNS::mTaskNotificationMsgQueue);
-    mpWebSiteMessageReceiver->Init(mpWebSiteMessageQueue,
-        mpWebSite->getTaskHandle(), ApplicationNS::mTaskNotificationMsgQueue);
-
-    mDisplayTaskObjects.mpMessageQueue             = mpDisplayMessageQueue;
-    mDisplayTaskObjects.mpCommunicationManager     = mpCommunicationManager;
-
-    mTimeManagerTaskObjects.mpMessageQueue         = mpTimeManagerMessageQueue;
-    mTimeManagerTaskObjects.mpCommunicationManager = mpCommunicationManager;
-
-    mWifiManagerTaskObjects.mpMessageQueue         = mpWifiManagerMessageQueue;
-    mWifiManagerTaskObjects.mpCommunicationManager = mpCommunicationManager;
-
-    mWebSiteTaskObjects.mpMessageQueue             = mpWebSiteMessageQueue;
-    mWebSiteTaskObjects.mpCommunicationManager     = mpCommunicationManager;
-
-    /* Initialize tasks */
-    mpDisplay->Init(&mDisplayTaskObjects);
-    mpTimeManager->Init(&mTimeManagerTaskObjects);
-    mpWiFiManager->Init(&mWifiManagerTaskObjects);
-    mpWebSite->Init(&mWebSiteTaskObjects);
-
-    /* Register messages receiver an communication manager */
-    mpCommunicationManager->RegisterCallback(
-        MessageNS::tAddress::DISPLAY_MANAGER, mpDisplayMessageReceiver);
-    mpCommunicationManager->RegisterCallback(
-        MessageNS::tAddress::TIME_MANAGER,    mpTimeManagerMessageReceiver);
-    mpCommunicationManager->RegisterCallback(
-        MessageNS::tAddress::WIFI_MANAGER,    mpWifiManagerMessageReceiver);
-    mpCommunicationManager->RegisterCallback(
-        MessageNS::tAddress::WEB_MANAGER,     mpWebSiteMessageReceiver);
+#if (USE_TASK_SUPERVISOR == true)
+    /* Subscribe the main loop to the task watchdog, tasks register during their initialization */
+    TaskSupervisor.Init();
+#endif /* (USE_TASK_SUPERVISOR == true) */
+
+    /* Start timer service, tasks register as clients during their initialization */
+    TimerService.Init();
+
+    /* Create, wire and initialize the statically allocated tasks */
+    mTaskGraph.Init(mCommunicationManager);
 }
 
 static void RunApplication(void)
 {
     /* Trigger all tasks */
+    mTaskGraph.Start();
+}
 
-    if ((mpDisplay != nullptr) &&
-        (mpDisplay->getTaskHandle() != nullptr))
-    {
-            xTaskNotifyGive(mpDisplay->getTaskHandle());
-    }
+#if (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) || \
+    (USE_SCHEDULING_BENCHMARK == true)
+static void ProcessDiagnostics(void)
+{
+#if (USE_BUS_STATISTICS_DUMP == true)
+    static uint32_t wLastDumpMs = 0;
 
-    if ((mpTimeManager != nullptr) &&
-        (mpTimeManager->getTaskHandle() != nullptr))
+    /* Dump message bus statistics every so often */
+    if ((millis() - wLastDumpMs) >= ConfigNS::mBusStatisticsDumpPeriodMs)
     {
-            xTaskNotifyGive(mpTimeManager->getTaskHandle());
+        wLastDumpMs = millis();
+        BusStatistics.Dump();
     }
+#endif /* (USE_BUS_STATISTICS_DUMP == true) */
 
-    if ((mpWiFiManager != nullptr) &&
-        (mpWiFiManager->getTaskHandle() != nullptr))
-    {
-            xTaskNotifyGive(mpWiFiManager->getTaskHandle());
-    }
+#if (USE_SCHEDULING_BENCHMARK == true)
+    /* Report the scheduling benchmark when it is finished */
+    SchedulingBenchmark.Process();
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
 
-    if ((mpWebSite != nullptr) &&
-        (mpWebSite->getTaskHandle() != nullptr))
+#if (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) || (USE_SCHEDULING_BENCHMARK == true)
+    /* Handle commands from the serial console */
+    while (Serial.available() > 0)
     {
-            xTaskNotifyGive(mpWebSite->getTaskHandle());
+        switch (Serial.read())
+        {
+#if (USE_BUS_RECORDER == true)
+            case ConfigNS::mBusRecorderDumpCommand:
+                BusRecorder.Dump();
+                break;
+
+            case ConfigNS::mBusRecorderClearCommand:
+                BusRecorder.Clear();
+                break;
+#endif /* (USE_BUS_RECORDER == true) */
+
+#if (USE_HANDLER_PROFILER == true)
+            case ConfigNS::mHandlerProfilerDumpCommand:
+                HandlerProfiler.Dump();
+                break;
+#endif /* (USE_HANDLER_PROFILER == true) */
+
+#if (USE_SCHEDULING_BENCHMARK == true)
+            case ConfigNS::mSchedulingBenchmarkCommand:
+                SchedulingBenchmark.Start(ConfigNS::mSchedulingBenchmarkDurationMs);
+                break;
+#endif /* (USE_SCHEDULING_BENCHMARK == true) */
+
+            default:
+                break;
+        }
     }
-}
\ No newline at end of file
+#endif /* (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) || (USE_SCHEDULING_BENCHMARK == true) */
+}
+#endif /* (USE_BUS_STATISTICS_DUMP == true) || (USE_BUS_RECORDER == true) || (USE_HANDLER_PROFILER == true) ||
+          (USE_SCHEDULING_BENCHMARK == true) */
@@ -0,0 +1,287 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host check and benchmark of the fixed-size BitMatrix: random operations must give the same
+ * bits as a bool array reference, then the mask to color expansion and the row flips of the
+ * LED mask are measured against LegacyNS::BitMatrix, the heap allocated byte array it replaced.
+ *   pio test -e native -f test_bit_matrix -v
+ */
+#include <chrono>
+#include <random>
+#include <vector>
+#include <unity.h>
+
+#include <FastLED.h>
+
+#include "BitMatrix.h"
+#include "TimeMaskTable.h"
+#include "../legacy/LegacyBitMatrix.h"
+
+
+/* Rounds per measurement */
+static constexpr uint32_t mcRounds = 500000;
+
+static constexpr TimeMaskNS::tTimeMaskTable mcTimeMaskTable = TimeMaskNS::GenerateTimeMaskTable();
+
+static CRGB mLeds[MATRIX_SIZE];
+
+/* The matrix is usable in constant expressions */
+static constexpr BitMatrix<16, 16> MakeArea(void)
+{
+    BitMatrix<16, 16> wMatrix;
+    wMatrix.SetArea(2, 3, 5, 4);
+    wMatrix.FlipRow(2);
+    return wMatrix;
+}
+static_assert(MakeArea().Count() == 20, "BitMatrix is not usable in constant expressions");
+
+/*
+ * Bool array reference of a matrix. LegacyNS::BitMatrix can not be the reference, it indexed
+ * rows with the height and did not check the flip arguments.
+ */
+template<uint16_t aWidth, uint16_t aHeight>
+class Reference
+{
+public:
+    void Set(uint32_t aIndex, bool aValue) { if (aIndex < (aWidth * aHeight)) { mBits[aIndex] = aValue; } }
+    bool Get(uint32_t aIndex) const { return mBits[aIndex]; }
+    void Swap(uint32_t aIndexA, uint32_t aIndexB) { bool wBit = mBits[aIndexA]; mBits[aIndexA] = mBits[aIndexB]; mBits[aIndexB] = wBit; }
+    void Fill(bool aValue) { mBits.assign(aWidth * aHeight, aValue); }
+
+    void SetLine(uint16_t aRow, uint16_t aCol, uint16_t aLength)
+    {
+        if ((aLength > 0) && (aRow < aHeight) && (aCol < aWidth) && ((aCol + aLength) <= aWidth))
+        {
+            for (uint16_t wI = 0; wI < aLength; wI++)
+            {
+                mBits[(aRow * aWidth) + aCol + wI] = true;
+            }
+        }
+    }
+
+    void FlipRow(uint16_t aRow)
+    {
+        for (uint16_t wI = 0; (aRow < aHeight) && (wI < (aWidth / 2)); wI++)
+        {
+            Swap((aRow * aWidth) + wI, (aRow * aWidth) + aWidth - 1 - wI);
+        }
+    }
+
+    void FlipColumn(uint16_t aCol)
+    {
+        for (uint16_t wI = 0; (aCol < aWidth) && (wI < (aHeight / 2)); wI++)
+        {
+            Swap((wI * aWidth) + aCol, ((aHeight - 1 - wI) * aWidth) + aCol);
+        }
+    }
+
+private:
+    std::vector<bool> mBits = std::vector<bool>(aWidth * aHeight, false);
+};
+
+/* Applies random operations to the matrix and the reference, arguments also out of range */
+template<uint16_t aWidth, uint16_t aHeight>
+static void CheckRandomOperations(std::mt19937& arRandom)
+{
+    for (uint32_t wIteration = 0; wIteration < 2000; wIteration++)
+    {
+        BitMatrix<aWidth, aHeight> wMatrix;
+        Reference<aWidth, aHeight> wReference;
+
+        for (uint8_t wOperation = 0; wOperation < 20; wOperation++)
+        {
+            uint16_t wRow    = arRandom() % (aHeight + 1);
+            uint16_t wCol    = arRandom() % (aWidth + 1);
+            uint16_t wWidth  = arRandom() % (aWidth + 1);
+            uint16_t wHeight = arRandom() % (aHeight + 1);
+            uint32_t wIndex  = arRandom() % ((aWidth * aHeight) + 2);
+
+            switch (arRandom() % 9)
+            {
+                case 0:
+                    wMatrix.SetBit(wRow, wCol);
+                    if ((wRow < aHeight) && (wCol < aWidth))
+                    {
+                        wReference.Set((wRow * aWidth) + wCol, true);
+                    }
+                    break;
+                case 1: wMatrix.SetBit(wIndex);   wReference.Set(wIndex, true);  break;
+                case 2: wMatrix.ClearBit(wIndex); wReference.Set(wIndex, false); break;
+                case 3: wMatrix.SetLine(wRow, wCol, wWidth); wReference.SetLine(wRow, wCol, wWidth); break;
+                case 4:
+                    wMatrix.SetArea(wRow, wCol, wWidth, wHeight);
+                    if ((wRow < aHeight) && ((wRow + wHeight) <= aHeight))
+                    {
+                        for (uint16_t wI = 0; wI < wHeight; wI++)
+                        {
+                            wReference.SetLine(wRow + wI, wCol, wWidth);
+                        }
+                    }
+                    break;
+                case 5: wMatrix.FlipRow(wRow);    wReference.FlipRow(wRow);    break;
+                case 6: wMatrix.FlipColumn(wCol); wReference.FlipColumn(wCol); break;
+                case 7:
+                    wMatrix.FlipHorizontal();
+                    for (uint16_t wI = 0; wI < aHeight; wI++)
+                    {
+                        wReference.FlipRow(wI);
+                    }
+                    break;
+                default:
+                    if ((arRandom() % 2) == 0) { wMatrix.SetAll();   wReference.Fill(true);  }
+                    else                       { wMatrix.ClearAll(); wReference.Fill(false); }
+                    break;
+            }
+        }
+
+        /* Same bits, count and set bit order */
+        std::vector<uint32_t> wExpected;
+        for (uint32_t wI = 0; wI < (aWidth * aHeight); wI++)
+        {
+            TEST_ASSERT_EQUAL(wReference.Get(wI), wMatrix.IsBitSet(wI));
+            if (wReference.Get(wI))
+            {
+                wExpected.push_back(wI);
+            }
+        }
+
+        std::vector<uint32_t> wVisited;
+        wMatrix.ForEachSetBit([&wVisited](uint32_t aIndex) { wVisited.push_back(aIndex); });
+        TEST_ASSERT_TRUE(wVisited == wExpected);
+        TEST_ASSERT_EQUAL_UINT32(wExpected.size(), wMatrix.Count());
+
+        /* Bits beyond the matrix stay clear */
+        constexpr uint32_t mcUsedBits = (aWidth * aHeight) % 32;
+        if (mcUsedBits != 0)
+        {
+            TEST_ASSERT_EQUAL_UINT32(0, wMatrix.GetWord(BitMatrix<aWidth, aHeight>::mNumbOfWords - 1) >> mcUsedBits);
+        }
+    }
+}
+
+void setUp(void)
+{
+    // do nothing
+}
+
+void tearDown(void)
+{
+    // do nothing
+}
+
+static void test_bit_matrix_matches_reference(void)
+{
+    std::mt19937 wRandom(1);
+
+    CheckRandomOperations<16, 16>(wRandom);
+    CheckRandomOperations<11, 7>(wRandom);
+    CheckRandomOperations<8, 4>(wRandom);
+    CheckRandomOperations<32, 3>(wRandom);
+    CheckRandomOperations<40, 2>(wRandom);
+    CheckRandomOperations<5, 13>(wRandom);
+}
+
+static void test_mask_to_color_benchmark(void)
+{
+    volatile uint8_t wSink = 0;
+    LegacyNS::BitMatrix wLegacy(MATRIX_WIDTH, MATRIX_HEIGHT);
+    double wTestAllNs = 0;
+    double wSetBitsNs = 0;
+
+    for (uint8_t wTime = 0; wTime < 8; wTime++)
+    {
+        const TimeMaskNS::tLedMask& wMask = mcTimeMaskTable.mTimeMasks[WORDCLOCK_MODE_1][wTime][wTime];
+        wLegacy.ClearAll();
+        wMask.ForEachSetBit([&wLegacy](uint32_t aIndex) { wLegacy.SetBit(aIndex); });
+
+        /* Test every bit, as SetLedColor() did */
+        auto wStart = std::chrono::steady_clock::now();
+        for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+        {
+            const CRGB wColor(1, static_cast<uint8_t>(wRound), 3);
+            for (uint16_t wI = 0; wI < wLegacy.GetSize(); wI++)
+            {
+                if (wLegacy.IsBitSet(static_cast<uint32_t>(wI)))
+                {
+                    mLeds[wI] = wColor;
+                }
+            }
+            wSink += mLeds[wRound % MATRIX_SIZE].g;
+        }
+        auto wMiddle = std::chrono::steady_clock::now();
+
+        /* Visit only the set bits */
+        for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+        {
+            const CRGB wColor(1, static_cast<uint8_t>(wRound), 3);
+            wMask.ForEachSetBit([wColor](uint32_t aIndex) { mLeds[aIndex] = wColor; });
+            wSink += mLeds[wRound % MATRIX_SIZE].g;
+        }
+        auto wEnd = std::chrono::steady_clock::now();
+
+        wTestAllNs += std::chrono::duration<double, std::nano>(wMiddle - wStart).count();
+        wSetBitsNs += std::chrono::duration<double, std::nano>(wEnd - wMiddle).count();
+    }
+
+    char wText[128];
+    snprintf(wText, sizeof(wText), "Mask to color: test all bits %.1f ns, set bits %.1f ns per mask",
+            wTestAllNs / (8.0 * mcRounds), wSetBitsNs / (8.0 * mcRounds));
+    TEST_MESSAGE(wText);
+}
+
+static void test_flip_rows_benchmark(void)
+{
+    volatile uint8_t wSink = 0;
+    TimeMaskNS::tLedMask wMask = mcTimeMaskTable.mTimeMasks[WORDCLOCK_MODE_1][3][4];
+    LegacyNS::BitMatrix  wLegacy(MATRIX_WIDTH, MATRIX_HEIGHT);
+    wLegacy.ClearAll();
+    wMask.ForEachSetBit([&wLegacy](uint32_t aIndex) { wLegacy.SetBit(aIndex); });
+
+    /* Flip the even rows, as the zigzag wiring did before the LED map */
+    auto wStart = std::chrono::steady_clock::now();
+    for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+    {
+        for (uint16_t wRow = 0; wRow < MATRIX_HEIGHT; wRow += 2)
+        {
+            wLegacy.FlipRow(wRow);
+        }
+        wSink += wLegacy.IsBitSet(wRound % MATRIX_SIZE);
+    }
+    auto wMiddle = std::chrono::steady_clock::now();
+    for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+    {
+        for (uint16_t wRow = 0; wRow < MATRIX_HEIGHT; wRow += 2)
+        {
+            wMask.FlipRow(wRow);
+        }
+        wSink += wMask.IsBitSet(wRound % MATRIX_SIZE);
+    }
+    auto wEnd = std::chrono::steady_clock::now();
+
+    /* Both flipped the same number of times */
+    for (uint32_t wI = 0; wI < MATRIX_SIZE; wI++)
+    {
+        TEST_ASSERT_EQUAL(wLegacy.IsBitSet(wI), wMask.IsBitSet(wI));
+    }
+
+    char wText[128];
+    snprintf(wText, sizeof(wText), "Flip even rows: bit by bit %.1f ns, bit reversal %.1f ns",
+            std::chrono::duration<double, std::nano>(wMiddle - wStart).count() / mcRounds,
+            std::chrono::duration<double, std::nano>(wEnd - wMiddle).count() / mcRounds);
+    TEST_MESSAGE(wText);
+}
+
+int main(int argc, char** argv)
+{
+    (void) argc;
+    (void) argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bit_matrix_matches_reference);
+    RUN_TEST(test_mask_to_color_benchmark);
+    RUN_TEST(test_flip_rows_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,236 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host benchmark of the task message queue: lock-free RingBufferNS::RingBufferQueue against
+ * the FreeRTOS queue, both used like the lanes of ApplicationNS::MessageQueue. Two producer
+ * tasks add messages, the consumer task waits for a notification and takes all queued
+ * messages. Measures messages per second and the enqueue-to-dispatch latency.
+ *   pio test -e native -f test_lane_queue -v
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <unity.h>
+
+#include <FreeRTOScpp.h>
+#include <QueueCPP.h>
+
+#include "Message.h"
+#include "MessageQueue.h"
+#include "RingBufferQueue.h"
+
+
+/* Producer tasks and messages sent by each of them */
+static constexpr uint8_t  mcProducers = 2;
+static constexpr uint32_t mcMessagesPerProducer = 100000;
+static constexpr uint32_t mcMessages = mcProducers * mcMessagesPerProducer;
+
+/** @brief Queued message with its enqueue time */
+struct tEntry
+{
+    MessageNS::Message mMessage;
+    uint64_t           mTimestampNs;
+};
+
+/** @brief Results of a run */
+struct tResult
+{
+    double   mMessagesPerSecond;
+    uint32_t mMedianNs;
+    uint32_t mP99Ns;
+    uint32_t mFullRetries;
+    uint32_t mNotifications;
+    uint32_t mOutOfOrder;
+};
+
+static uint64_t NowNs(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Producers and consumer of one queue type.
+ *
+ * @details
+ * The FreeRTOS queue notifies the consumer on each message, as MessageQueue::Add() does.
+ * The ring buffer notifies only on the empty-to-non-empty edge.
+ */
+template<class tQueue, bool aEdgeNotify>
+class Bench
+{
+public:
+    tResult Run(void)
+    {
+        mLatencies.assign(mcMessages, 0);
+
+        xTaskCreate(Consumer, "Consumer", 4096, this, 2, &mConsumer);
+        uint64_t wStartNs = NowNs();
+        for (uint8_t wI = 0; wI < mcProducers; wI++)
+        {
+            xTaskCreate(Producer, "Producer", 4096, this, 1, nullptr);
+        }
+
+        while (mDone.load() == false)
+        {
+            vTaskDelay(1);
+        }
+        uint64_t wElapsedNs = NowNs() - wStartNs;
+        while (mProducersDone.load() != mcProducers)
+        {
+            vTaskDelay(1);
+        }
+
+        std::sort(mLatencies.begin(), mLatencies.end());
+
+        tResult wResult;
+        wResult.mMessagesPerSecond = (mcMessages * 1e9) / wElapsedNs;
+        wResult.mMedianNs          = mLatencies[mcMessages / 2];
+        wResult.mP99Ns             = mLatencies[(mcMessages * 99) / 100];
+        wResult.mFullRetries       = mFullRetries.load();
+        wResult.mNotifications     = mNotifications.load();
+        wResult.mOutOfOrder        = mOutOfOrder;
+        return wResult;
+    }
+
+private:
+    static void Producer(void* apParameter)
+    {
+        Bench* wpBench = static_cast<Bench*>(apParameter);
+        uint8_t wProducer = static_cast<uint8_t>(wpBench->mNextProducer.fetch_add(1));
+
+        tEntry wEntry = {};
+        wEntry.mMessage.mSource = static_cast<MessageNS::tAddress>(wProducer);
+        wEntry.mMessage.mId     = MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED;
+
+        for (uint32_t wI = 0; wI < mcMessagesPerProducer; wI++)
+        {
+            memcpy(wEntry.mMessage.mPayload, &wI, sizeof(wI));
+
+            bool wNotify = true;
+            for (;;)
+            {
+                /* Stamp on each attempt, a full queue is back-pressure and not waiting time */
+                wEntry.mTimestampNs = NowNs();
+                bool wAdded;
+                if constexpr (aEdgeNotify)
+                {
+                    wAdded = wpBench->mQueue.add(wEntry, 0, &wNotify);
+                }
+                else
+                {
+                    wAdded = wpBench->mQueue.add(wEntry, 0);
+                }
+                if (wAdded)
+                {
+                    break;
+                }
+                wpBench->mFullRetries++;
+                taskYIELD();
+            }
+
+            if (wNotify)
+            {
+                wpBench->mNotifications++;
+                xTaskNotifyGive(wpBench->mConsumer);
+            }
+        }
+
+        wpBench->mProducersDone++;
+        vTaskDelete(nullptr);
+    }
+
+    static void Consumer(void* apParameter)
+    {
+        Bench* wpBench = static_cast<Bench*>(apParameter);
+        uint32_t wCount = 0;
+        uint32_t wNext[mcProducers] = {};
+        tEntry   wEntry;
+
+        while (wCount < mcMessages)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            /* Take all messages before waiting for the next notification */
+            while (wpBench->mQueue.pop(wEntry, 0))
+            {
+                wpBench->mLatencies[wCount++] = static_cast<uint32_t>(NowNs() - wEntry.mTimestampNs);
+
+                /* Each producer's messages arrive in order */
+                uint32_t wSequence;
+                memcpy(&wSequence, wEntry.mMessage.mPayload, sizeof(wSequence));
+                if (wSequence != wNext[wEntry.mMessage.mSource]++)
+                {
+                    wpBench->mOutOfOrder++;
+                }
+            }
+        }
+
+        wpBench->mDone = true;
+        vTaskDelete(nullptr);
+    }
+
+    tQueue                mQueue;
+    TaskHandle_t          mConsumer = nullptr;
+    std::atomic<uint8_t>  mNextProducer{0};
+    std::atomic<uint8_t>  mProducersDone{0};
+    std::atomic<bool>     mDone{false};
+    std::atomic<uint32_t> mFullRetries{0};
+    std::atomic<uint32_t> mNotifications{0};
+    uint32_t              mOutOfOrder = 0;
+    std::vector<uint32_t> mLatencies;
+};
+
+static void Report(const char* apName, const tResult& arResult)
+{
+    char wText[192];
+    snprintf(wText, sizeof(wText), "%s: %.0f msg/s, latency median %u ns, p99 %u ns, %u notifications, %u full retries",
+            apName, arResult.mMessagesPerSecond, arResult.mMedianNs, arResult.mP99Ns,
+            arResult.mNotifications, arResult.mFullRetries);
+    TEST_MESSAGE(wText);
+}
+
+void setUp(void)
+{
+    // do nothing
+}
+
+void tearDown(void)
+{
+    // do nothing
+}
+
+static void test_freertos_queue(void)
+{
+    static Bench<FreeRTOScpp::Queue<tEntry, ApplicationNS::mDefaultMessageLaneSize>, false> wBench;
+    tResult wResult = wBench.Run();
+
+    TEST_ASSERT_EQUAL_UINT32(0, wResult.mOutOfOrder);
+    Report("FreeRTOS queue", wResult);
+}
+
+static void test_ring_buffer_queue(void)
+{
+    static Bench<RingBufferNS::RingBufferQueue<tEntry, ApplicationNS::mDefaultMessageLaneSize>, true> wBench;
+    tResult wResult = wBench.Run();
+
+    TEST_ASSERT_EQUAL_UINT32(0, wResult.mOutOfOrder);
+    Report("Ring buffer   ", wResult);
+}
+
+int main(int argc, char** argv)
+{
+    (void) argc;
+    (void) argv;
+
+    vTaskStartScheduler();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_freertos_queue);
+    RUN_TEST(test_ring_buffer_queue);
+    return UNITY_END();
+}
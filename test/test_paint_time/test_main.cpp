@@ -0,0 +1,258 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host benchmark of Display::PaintTime(): LED masks from the table generated at compile time
+ * against the previous word lookup with LegacyNS::BitMatrix, both including the expansion of
+ * the mask to the LED colors.
+ *   pio test -e native -f test_paint_time -v
+ */
+#include <chrono>
+#include <unity.h>
+
+#include <FastLED.h>
+
+#include "Configuration.h"
+#include "LedMapping.h"
+#include "TimeMaskTable.h"
+#include "WordClockLayout.h"
+#include "../legacy/LegacyBitMatrix.h"
+
+
+/* Frames per measurement */
+static constexpr uint32_t mcRounds = 200000;
+
+static constexpr TimeMaskNS::tTimeMaskTable mcTimeMaskTable = TimeMaskNS::GenerateTimeMaskTable();
+static constexpr LedMappingNS::LedMap<MATRIX_WIDTH, MATRIX_HEIGHT> mcLedMap(ConfigNS::mcPanelLayout);
+
+static CRGB mLegacyLeds[MATRIX_SIZE];
+static CRGB mLeds[MATRIX_SIZE];
+static LegacyNS::BitMatrix mLegacyMask(MATRIX_WIDTH, MATRIX_HEIGHT);
+
+/* Previous Display::PaintTime() and SetLedColor(BitMatrix&), the settings as parameters */
+static void LegacyPaintTime(const uint8_t aHour, const uint8_t aMinute, const CRGB aColor,
+        tWordClockMode wMode, bool wItIsEnabled, bool wExtraMinutesEnabled)
+{
+    mLegacyMask.ClearAll();
+
+    if ((aHour < 24) && (aMinute < 60))
+    {
+        uint8_t wHour         = aHour;
+        uint8_t wMinute       = aMinute / 5;
+        uint8_t wMinuteExtra  = aMinute % 5;
+
+        tMinuteDisplay wMinuteDisplay = mcWordMinutesTable[wMode][wMinute];
+
+        if ((wMinuteDisplay.mFlags & HOUR_OFFSET_1) == HOUR_OFFSET_1)
+        {
+            wHour += 1;
+        }
+        while (wHour > HOURS_COUNT)
+        {
+            wHour -= HOURS_COUNT;
+        }
+        if (wHour == 12)
+        {
+            wHour = 0;
+        }
+
+        uint8_t wItIsWords = (wItIsEnabled) ? 2 : 0;
+        uint8_t wExtraMinutesWords = (wExtraMinutesEnabled) ? MAX_EXTRA_MINUTE_WORDS : 0;
+
+        tWord wDisplayWords[wItIsWords + MAX_MINUTE_WORDS + MAX_HOUR_WORDS + wExtraMinutesWords] = { WORD_END_OF_WORDS };
+        uint8_t wWordsOffset = 0;
+
+        if (wItIsEnabled)
+        {
+            wDisplayWords[wWordsOffset++] = WORD_ES;
+            wDisplayWords[wWordsOffset++] = WORD_IST;
+        }
+
+        memccpy(&wDisplayWords[wWordsOffset], wMinuteDisplay.wMinuteWords,
+            MAX_MINUTE_WORDS, sizeof(wMinuteDisplay.wMinuteWords));
+        wWordsOffset += MAX_MINUTE_WORDS;
+
+        memccpy(&wDisplayWords[wWordsOffset], mcWordHoursTable[wMinuteDisplay.mHourMode][wHour],
+            MAX_HOUR_WORDS, sizeof(mcWordHoursTable[wMinuteDisplay.mHourMode][wHour]));
+        wWordsOffset += MAX_HOUR_WORDS;
+
+        if (wExtraMinutesEnabled)
+        {
+            memccpy(&wDisplayWords[wWordsOffset], mcWordExtraMinutesTable[wMinuteExtra],
+                wExtraMinutesWords, sizeof(mcWordExtraMinutesTable[wMinuteExtra]));
+            wWordsOffset += wExtraMinutesWords;
+        }
+
+        for (uint8_t wI = 0; wI < wWordsOffset; wI++)
+        {
+            if ((wDisplayWords[wI] > WORD_END_OF_WORDS) &&
+                (wDisplayWords[wI] < WORD_MAX_NUMBER))
+            {
+                tWordData wWordData = mcWordDataArray[wDisplayWords[wI]];
+                mLegacyMask.SetLine(wWordData.mRow, wWordData.mColumn, wWordData.mLength);
+            }
+        }
+    }
+
+    /* Match the logical LED mask to the physical layout (zigzag order) */
+    for (uint8_t wRow = 0; wRow < mLegacyMask.GetHeight(); wRow++)
+    {
+        if ((wRow % 2) == 0)
+        {
+            mLegacyMask.FlipRow(wRow);
+        }
+    }
+
+    for (uint16_t wI = 0; wI < mLegacyMask.GetSize(); wI++)
+    {
+        if (mLegacyMask.IsBitSet(wI))
+        {
+            mLegacyLeds[wI] = aColor;
+        }
+    }
+}
+
+/* Current Display::PaintTime() and SetLedColor(tLedMask&), the settings as parameters */
+static void PaintTime(const uint8_t aHour, const uint8_t aMinute, const CRGB aColor,
+        tWordClockMode wMode, bool wItIsEnabled, bool wExtraMinutesEnabled)
+{
+    TimeMaskNS::tLedMask wLedMask;
+
+    if ((aHour < 24) && (aMinute < 60))
+    {
+        wLedMask = mcTimeMaskTable.mTimeMasks[wMode][aHour % HOURS_COUNT][aMinute / 5];
+
+        if (wItIsEnabled)
+        {
+            wLedMask.Union(mcTimeMaskTable.mItIsMask);
+        }
+        if (wExtraMinutesEnabled)
+        {
+            wLedMask.Union(mcTimeMaskTable.mExtraMinuteMasks[aMinute % 5]);
+        }
+    }
+
+    wLedMask.ForEachSetBit([aColor](uint32_t aLedIndex)
+    {
+        mLeds[mcLedMap.GetLedIndex(static_cast<uint16_t>(aLedIndex))] = aColor;
+    });
+}
+
+void setUp(void)
+{
+    // do nothing
+}
+
+void tearDown(void)
+{
+    // do nothing
+}
+
+/*
+ * The previous memccpy() stopped at WORD_CLOCK_MIN_20 (value 3 equals MAX_MINUTE_WORDS), so the
+ * minute words following it were dropped. The table shows them.
+ */
+static bool LegacyDropsWords(tWordClockMode aMode, uint8_t aMinute)
+{
+    const tMinuteDisplay& wMinuteDisplay = mcWordMinutesTable[aMode][aMinute / 5];
+
+    for (uint8_t wI = 0; (wI + 1) < MAX_MINUTE_WORDS; wI++)
+    {
+        if ((wMinuteDisplay.wMinuteWords[wI] == MAX_MINUTE_WORDS) &&
+            (wMinuteDisplay.wMinuteWords[wI + 1] != WORD_END_OF_WORDS))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void test_paint_time_matches_legacy(void)
+{
+    uint32_t wDroppedWords = 0;
+
+    for (uint8_t wMode = 0; wMode < WORDCLOCK_MODE_NUMBER; wMode++)
+    {
+        for (uint8_t wOptions = 0; wOptions < 4; wOptions++)
+        {
+            for (uint8_t wHour = 0; wHour < 24; wHour++)
+            {
+                for (uint8_t wMinute = 0; wMinute < 60; wMinute++)
+                {
+                    memset(static_cast<void*>(mLegacyLeds), 0, sizeof(mLegacyLeds));
+                    memset(static_cast<void*>(mLeds), 0, sizeof(mLeds));
+
+                    LegacyPaintTime(wHour, wMinute, CRGB::White, static_cast<tWordClockMode>(wMode),
+                            (wOptions & 0x01) != 0, (wOptions & 0x02) != 0);
+                    PaintTime(wHour, wMinute, CRGB::White, static_cast<tWordClockMode>(wMode),
+                            (wOptions & 0x01) != 0, (wOptions & 0x02) != 0);
+
+                    if (LegacyDropsWords(static_cast<tWordClockMode>(wMode), wMinute))
+                    {
+                        /* Same LEDs and the dropped words */
+                        bool wSubset = true;
+                        for (uint16_t wI = 0; wI < MATRIX_SIZE; wI++)
+                        {
+                            if (mLegacyLeds[wI] && !mLeds[wI])
+                            {
+                                wSubset = false;
+                            }
+                        }
+                        TEST_ASSERT_TRUE(wSubset);
+                        TEST_ASSERT_TRUE(memcmp(mLegacyLeds, mLeds, sizeof(mLeds)) != 0);
+                        wDroppedWords++;
+                    }
+                    else
+                    {
+                        TEST_ASSERT_EQUAL_MEMORY(mLegacyLeds, mLeds, sizeof(mLeds));
+                    }
+                }
+            }
+        }
+    }
+
+    char wText[96];
+    snprintf(wText, sizeof(wText), "%u of %u times differ by the minute words dropped by memccpy()",
+            wDroppedWords, WORDCLOCK_MODE_NUMBER * 4 * 24 * 60);
+    TEST_MESSAGE(wText);
+}
+
+static void test_paint_time_benchmark(void)
+{
+    volatile uint8_t wSink = 0;
+    const CRGB wColor(1, 2, 3);
+
+    auto wStart = std::chrono::steady_clock::now();
+    for (uint32_t wI = 0; wI < mcRounds; wI++)
+    {
+        LegacyPaintTime(wI % 24, wI % 60, wColor, WORDCLOCK_MODE_1, true, true);
+        wSink += mLegacyLeds[wI % MATRIX_SIZE].r;
+    }
+    auto wMiddle = std::chrono::steady_clock::now();
+    for (uint32_t wI = 0; wI < mcRounds; wI++)
+    {
+        PaintTime(wI % 24, wI % 60, wColor, WORDCLOCK_MODE_1, true, true);
+        wSink += mLeds[wI % MATRIX_SIZE].r;
+    }
+    auto wEnd = std::chrono::steady_clock::now();
+
+    char wText[128];
+    snprintf(wText, sizeof(wText), "PaintTime: word lookup %.1f ns, mask table %.1f ns per frame, table %u bytes",
+            std::chrono::duration<double, std::nano>(wMiddle - wStart).count() / mcRounds,
+            std::chrono::duration<double, std::nano>(wEnd - wMiddle).count() / mcRounds,
+            static_cast<unsigned>(sizeof(mcTimeMaskTable)));
+    TEST_MESSAGE(wText);
+}
+
+int main(int argc, char** argv)
+{
+    (void) argc;
+    (void) argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_paint_time_matches_legacy);
+    RUN_TEST(test_paint_time_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,141 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host benchmark of taking task messages: eight MessageQueue::Pop() calls against one
+ * MessageQueue::PopBatch() of eight messages. Only the take phase is measured. The lanes
+ * are the ones selected by USE_RINGBUFFER_MSG_QUEUE in the native environment.
+ *   pio test -e native -f test_pop_batch -v
+ */
+#include <chrono>
+#include <unity.h>
+
+#include "MessageQueue.h"
+
+
+/* Messages per round, the maximal batch budget of the tasks */
+static constexpr uint8_t  mcBatchSize = 8;
+/* Rounds per measurement */
+static constexpr uint32_t mcRounds = 200000;
+
+#if (USE_RINGBUFFER_MSG_QUEUE == true)
+static const char* mcLaneType = "ring buffer lanes";
+#else
+static const char* mcLaneType = "FreeRTOS queue lanes";
+#endif /* (USE_RINGBUFFER_MSG_QUEUE == true) */
+
+static ApplicationNS::StaticMessageQueue<mcBatchSize>* mpQueue;
+
+void setUp(void)
+{
+    mpQueue = new ApplicationNS::StaticMessageQueue<mcBatchSize>();
+    mpQueue->SetLane(MessageNS::tMessageId::CMD_WIFI_CONNECT, ApplicationNS::LANE_COMMAND);
+    mpQueue->SetLane(MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED, ApplicationNS::LANE_CRITICAL);
+}
+
+void tearDown(void)
+{
+    delete mpQueue;
+}
+
+/* Fills the lanes with a mix of message IDs, the sequence number in the payload */
+static void Fill(uint32_t aRound)
+{
+    static const MessageNS::tMessageId mcIds[] =
+    {
+        MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED,
+        MessageNS::tMessageId::CMD_WIFI_CONNECT,
+        MessageNS::tMessageId::MGS_EVENT_DATETIME_CHANGED,
+    };
+
+    MessageNS::Message wMessage = {};
+    bool wNotify;
+
+    for (uint8_t wI = 0; wI < mcBatchSize; wI++)
+    {
+        wMessage.mId         = mcIds[wI % 3];
+        wMessage.mPayload[0] = static_cast<uint8_t>(aRound);
+        wMessage.mPayload[1] = wI;
+        mpQueue->Add(wMessage, wNotify);
+    }
+}
+
+static void test_pop_batch_takes_like_pop(void)
+{
+    MessageNS::Message wSingle[mcBatchSize];
+    MessageNS::Message wBatch[mcBatchSize];
+
+    for (uint32_t wRound = 0; wRound < 16; wRound++)
+    {
+        Fill(wRound);
+        for (uint8_t wI = 0; wI < mcBatchSize; wI++)
+        {
+            TEST_ASSERT_TRUE(mpQueue->Pop(wSingle[wI]));
+        }
+        TEST_ASSERT_TRUE(mpQueue->Empty());
+
+        Fill(wRound);
+        TEST_ASSERT_EQUAL_UINT8(mcBatchSize, mpQueue->PopBatch(wBatch, mcBatchSize));
+        TEST_ASSERT_TRUE(mpQueue->Empty());
+
+        /* Same messages in the same lane order */
+        for (uint8_t wI = 0; wI < mcBatchSize; wI++)
+        {
+            TEST_ASSERT_EQUAL_UINT8(wSingle[wI].mId, wBatch[wI].mId);
+            TEST_ASSERT_EQUAL_UINT8(wSingle[wI].mPayload[1], wBatch[wI].mPayload[1]);
+        }
+    }
+}
+
+static void test_pop_batch_benchmark(void)
+{
+    MessageNS::Message wMessages[mcBatchSize];
+    double wTakeNs[2] = {};
+
+    for (uint8_t wMode = 0; wMode < 2; wMode++)
+    {
+        for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+        {
+            Fill(wRound);
+
+            auto wStart = std::chrono::steady_clock::now();
+            if (wMode == 0)
+            {
+                for (uint8_t wI = 0; wI < mcBatchSize; wI++)
+                {
+                    mpQueue->Pop(wMessages[wI]);
+                }
+            }
+            else
+            {
+                mpQueue->PopBatch(wMessages, mcBatchSize);
+            }
+            wTakeNs[wMode] += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wStart).count();
+        }
+    }
+
+    TEST_ASSERT_TRUE(mpQueue->Empty());
+    TEST_ASSERT_EQUAL_UINT32(2 * mcRounds * mcBatchSize,
+            mpQueue->GetStatistics(ApplicationNS::LANE_CRITICAL).mDequeued +
+            mpQueue->GetStatistics(ApplicationNS::LANE_COMMAND).mDequeued +
+            mpQueue->GetStatistics(ApplicationNS::LANE_BACKGROUND).mDequeued);
+
+    char wText[128];
+    snprintf(wText, sizeof(wText), "%s: Pop x %u %.1f ns, PopBatch(%u) %.1f ns per message taken",
+            mcLaneType, mcBatchSize, wTakeNs[0] / (mcRounds * mcBatchSize),
+            mcBatchSize, wTakeNs[1] / (mcRounds * mcBatchSize));
+    TEST_MESSAGE(wText);
+}
+
+int main(int argc, char** argv)
+{
+    (void) argc;
+    (void) argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_pop_batch_takes_like_pop);
+    RUN_TEST(test_pop_batch_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,179 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: hocki
+ *
+ * Host benchmark of the message fan-out: PublishMessage() with the subscriber bitmask
+ * against the previous loop of SendMessage() calls, one per destination.
+ *   pio test -e native -f test_publish_dispatch -v
+ */
+#include <chrono>
+#include <unity.h>
+
+#include "Communication.h"
+
+
+/* Number of messages per measurement */
+static constexpr uint32_t mcRounds = 1000000;
+
+/* Receivers of the measurements, lowest address first */
+static const MessageNS::tAddress mcDestinations[] =
+{
+    MessageNS::tAddress::APPLICATION_MANAGER,
+    MessageNS::tAddress::DISPLAY_MANAGER,
+    MessageNS::tAddress::TIME_MANAGER,
+    MessageNS::tAddress::WEB_MANAGER,
+};
+
+/**
+ * @brief Receiver which only records the delivered messages.
+ */
+class Receiver : public CommunicationNS::NotificationCallback
+{
+public:
+    void NotifyMessage(const MessageNS::Message& arMessage) override
+    {
+        mCount++;
+        mChecksum += (arMessage.mDestination + 1) * arMessage.mPayload[0];
+    }
+    void NotifyFastEvent(MessageNS::tFastEvent aEvent) override { (void) aEvent; }
+
+    uint32_t mCount    = 0;
+    uint32_t mChecksum = 0;
+};
+
+static CommunicationNS::CommunicationManager* mpManager;
+static Receiver mReceivers[MessageNS::tAddress::NB_OF_ADDRESSES];
+
+void setUp(void)
+{
+    mpManager = new CommunicationNS::CommunicationManager();
+    for (uint8_t wI = 0; wI < MessageNS::tAddress::NB_OF_ADDRESSES; wI++)
+    {
+        mReceivers[wI] = Receiver();
+        mpManager->RegisterCallback(static_cast<MessageNS::tAddress>(wI), &mReceivers[wI]);
+    }
+}
+
+void tearDown(void)
+{
+    delete mpManager;
+}
+
+static MessageNS::Message CreateMessage(void)
+{
+    MessageNS::Message wMessage;
+    wMessage.mSource        = MessageNS::tAddress::WIFI_MANAGER;
+    wMessage.mDestination   = MessageNS::tAddress::APPLICATION_MANAGER;
+    wMessage.mId            = MessageNS::tMessageId::MSG_EVENT_WIFI_STA_CONNECTED;
+    wMessage.mPayloadLength = 1;
+    wMessage.mPayload[0]    = 1;
+    return wMessage;
+}
+
+/* Delivers each message with one SendMessage() per destination, as the producers did before */
+static double SendLoop(uint8_t aReceivers)
+{
+    MessageNS::Message wMessage = CreateMessage();
+
+    auto wStart = std::chrono::steady_clock::now();
+    for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+    {
+        wMessage.mPayload[0] = static_cast<uint8_t>(wRound);
+        for (uint8_t wI = 0; wI < aReceivers; wI++)
+        {
+            wMessage.mDestination = mcDestinations[wI];
+            mpManager->SendMessage(wMessage);
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wStart).count() / mcRounds;
+}
+
+/* Delivers each message with one PublishMessage() to the subscribers */
+static double Publish(uint8_t aReceivers)
+{
+    MessageNS::Message wMessage = CreateMessage();
+
+    for (uint8_t wI = 0; wI < aReceivers; wI++)
+    {
+        mpManager->Subscribe(wMessage.mId, mcDestinations[wI]);
+    }
+
+    auto wStart = std::chrono::steady_clock::now();
+    for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+    {
+        wMessage.mPayload[0] = static_cast<uint8_t>(wRound);
+        mpManager->PublishMessage(wMessage);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wStart).count() / mcRounds;
+}
+
+/* Counts and checksum of all receivers */
+static void Snapshot(uint32_t* apCounts, uint32_t* apChecksums)
+{
+    for (uint8_t wI = 0; wI < MessageNS::tAddress::NB_OF_ADDRESSES; wI++)
+    {
+        apCounts[wI]    = mReceivers[wI].mCount;
+        apChecksums[wI] = mReceivers[wI].mChecksum;
+        mReceivers[wI]  = Receiver();
+    }
+}
+
+static void test_publish_delivers_like_send_loop(void)
+{
+    for (uint8_t wReceivers = 1; wReceivers <= (sizeof(mcDestinations) / sizeof(mcDestinations[0])); wReceivers++)
+    {
+        uint32_t wSendCounts[MessageNS::tAddress::NB_OF_ADDRESSES];
+        uint32_t wSendChecksums[MessageNS::tAddress::NB_OF_ADDRESSES];
+        uint32_t wPublishCounts[MessageNS::tAddress::NB_OF_ADDRESSES];
+        uint32_t wPublishChecksums[MessageNS::tAddress::NB_OF_ADDRESSES];
+
+        double wSendNs = SendLoop(wReceivers);
+        Snapshot(wSendCounts, wSendChecksums);
+        double wPublishNs = Publish(wReceivers);
+        Snapshot(wPublishCounts, wPublishChecksums);
+
+        /* Both paths deliver the same messages to the same receivers */
+        TEST_ASSERT_EQUAL_MEMORY(wSendCounts, wPublishCounts, sizeof(wSendCounts));
+        TEST_ASSERT_EQUAL_MEMORY(wSendChecksums, wPublishChecksums, sizeof(wSendChecksums));
+
+        char wText[128];
+        snprintf(wText, sizeof(wText), "%u receivers: SendMessage loop %.1f ns, PublishMessage %.1f ns per message",
+                wReceivers, wSendNs, wPublishNs);
+        TEST_MESSAGE(wText);
+    }
+}
+
+static void test_publish_without_subscribers(void)
+{
+    /* The WiFi events were sent to the time and web managers, also without interest */
+    MessageNS::Message wMessage = CreateMessage();
+
+    auto wStart = std::chrono::steady_clock::now();
+    for (uint32_t wRound = 0; wRound < mcRounds; wRound++)
+    {
+        mpManager->PublishMessage(wMessage);
+    }
+    double wPublishNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wStart).count() / mcRounds;
+
+    for (const Receiver& wReceiver : mReceivers)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0, wReceiver.mCount);
+    }
+
+    char wText[128];
+    snprintf(wText, sizeof(wText), "0 subscribers: PublishMessage %.1f ns per message, no copy delivered", wPublishNs);
+    TEST_MESSAGE(wText);
+}
+
+int main(int argc, char** argv)
+{
+    (void) argc;
+    (void) argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_publish_delivers_like_send_loop);
+    RUN_TEST(test_publish_without_subscribers);
+    return UNITY_END();
+}